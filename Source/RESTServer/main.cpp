@@ -62,6 +62,8 @@
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/REST/PipelineJobQueue.h"
+#include "SIMPLib/REST/PreflightResultCache.h"
 #include "SIMPLib/REST/SIMPLRequestMapper.h"
 #include "SIMPLib/REST/V1Controllers/SIMPLStaticFileController.h"
 
@@ -144,6 +146,11 @@ int main(int argc, char* argv[])
   // Configure static file controller
   SIMPLStaticFileController::CreateInstance(&serverSettings, &app);
 
+  // Configure the worker threads that execute submitted pipelines
+  PipelineJobQueue::CreateInstance(config);
+  // Configure the cache that answers repeated preflights of the same pipeline
+  PreflightResultCache::CreateInstance(config);
+
   // Configure and start the TCP listener
   QSharedPointer<HttpListener> httpListener = QSharedPointer<HttpListener>(new HttpListener(&serverSettings, new SIMPLRequestMapper(&app), &app));
 
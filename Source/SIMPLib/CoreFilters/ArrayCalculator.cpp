@@ -53,6 +53,7 @@
 #include "util/ATanOperator.h"
 #include "util/AdditionOperator.h"
 #include "util/CalculatorArray.hpp"
+#include "util/CalculatorKernel.h"
 #include "util/CeilOperator.h"
 #include "util/CommaSeparator.h"
 #include "util/CosOperator.h"
@@ -73,61 +74,61 @@
 #include "util/SubtractionOperator.h"
 #include "util/TanOperator.h"
 
-#define CREATE_CALCULATOR_ARRAY(itemPtr, iDataArrayPtr)                                                                                                                                                \
+#define CREATE_CALCULATOR_ARRAY(itemPtr, iDataArrayPtr, allocate)                                                                                                                                      \
   if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(iDataArrayPtr))                                                                                                                                 \
   {                                                                                                                                                                                                    \
     FloatArrayType::Pointer arrayCast = std::dynamic_pointer_cast<FloatArrayType>(iDataArrayPtr);                                                                                                      \
-    itemPtr = CalculatorArray<float>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                      \
+    itemPtr = CalculatorArray<float>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                               \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(iDataArrayPtr))                                                                                                                           \
   {                                                                                                                                                                                                    \
     DoubleArrayType::Pointer arrayCast = std::dynamic_pointer_cast<DoubleArrayType>(iDataArrayPtr);                                                                                                    \
-    itemPtr = CalculatorArray<double>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                     \
+    itemPtr = CalculatorArray<double>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                              \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(iDataArrayPtr))                                                                                                                             \
   {                                                                                                                                                                                                    \
     Int8ArrayType::Pointer arrayCast = std::dynamic_pointer_cast<Int8ArrayType>(iDataArrayPtr);                                                                                                        \
-    itemPtr = CalculatorArray<int8_t>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                     \
+    itemPtr = CalculatorArray<int8_t>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                              \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(iDataArrayPtr))                                                                                                                            \
   {                                                                                                                                                                                                    \
     UInt8ArrayType::Pointer arrayCast = std::dynamic_pointer_cast<UInt8ArrayType>(iDataArrayPtr);                                                                                                      \
-    itemPtr = CalculatorArray<uint8_t>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                    \
+    itemPtr = CalculatorArray<uint8_t>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                             \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(iDataArrayPtr))                                                                                                                            \
   {                                                                                                                                                                                                    \
     Int16ArrayType::Pointer arrayCast = std::dynamic_pointer_cast<Int16ArrayType>(iDataArrayPtr);                                                                                                      \
-    itemPtr = CalculatorArray<int16_t>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                    \
+    itemPtr = CalculatorArray<int16_t>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                             \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(iDataArrayPtr))                                                                                                                           \
   {                                                                                                                                                                                                    \
     UInt16ArrayType::Pointer arrayCast = std::dynamic_pointer_cast<UInt16ArrayType>(iDataArrayPtr);                                                                                                    \
-    itemPtr = CalculatorArray<uint16_t>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                   \
+    itemPtr = CalculatorArray<uint16_t>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                            \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(iDataArrayPtr))                                                                                                                            \
   {                                                                                                                                                                                                    \
     Int32ArrayType::Pointer arrayCast = std::dynamic_pointer_cast<Int32ArrayType>(iDataArrayPtr);                                                                                                      \
-    itemPtr = CalculatorArray<int32_t>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                    \
+    itemPtr = CalculatorArray<int32_t>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                             \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(iDataArrayPtr))                                                                                                                           \
   {                                                                                                                                                                                                    \
     UInt32ArrayType::Pointer arrayCast = std::dynamic_pointer_cast<UInt32ArrayType>(iDataArrayPtr);                                                                                                    \
-    itemPtr = CalculatorArray<uint32_t>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                   \
+    itemPtr = CalculatorArray<uint32_t>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                            \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(iDataArrayPtr))                                                                                                                            \
   {                                                                                                                                                                                                    \
     Int64ArrayType::Pointer arrayCast = std::dynamic_pointer_cast<Int64ArrayType>(iDataArrayPtr);                                                                                                      \
-    itemPtr = CalculatorArray<int64_t>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                    \
+    itemPtr = CalculatorArray<int64_t>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                             \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(iDataArrayPtr))                                                                                                                           \
   {                                                                                                                                                                                                    \
     UInt64ArrayType::Pointer arrayCast = std::dynamic_pointer_cast<UInt64ArrayType>(iDataArrayPtr);                                                                                                    \
-    itemPtr = CalculatorArray<uint64_t>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                   \
+    itemPtr = CalculatorArray<uint64_t>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                            \
   }                                                                                                                                                                                                    \
   else if(TemplateHelpers::CanDynamicCast<DataArray<bool>>()(iDataArrayPtr))                                                                                                                           \
   {                                                                                                                                                                                                    \
     DataArray<bool>::Pointer arrayCast = std::dynamic_pointer_cast<DataArray<bool>>(iDataArrayPtr);                                                                                                    \
-    itemPtr = CalculatorArray<bool>::New(arrayCast, ICalculatorArray::Array, !getInPreflight());                                                                                                       \
+    itemPtr = CalculatorArray<bool>::New(arrayCast, ICalculatorArray::Array, allocate);                                                                                                                \
   }
 
 enum createdPathID : RenameDataPath::DataID_t
@@ -234,7 +235,8 @@ void ArrayCalculator::dataCheck()
     return;
   }
 
-  QVector<CalculatorItem::Pointer> parsedInfix = parseInfixEquation();
+  // The data check only needs the structure of the expression, so the arrays are never converted here
+  QVector<CalculatorItem::Pointer> parsedInfix = parseInfixEquation(false);
   if(parsedInfix.isEmpty())
   {
     return;
@@ -391,8 +393,17 @@ void ArrayCalculator::execute()
   }
   initialize();
 
+  if(executeFusedKernel())
+  {
+    return;
+  }
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
   // Parse the infix expression from the user interface
-  QVector<CalculatorItem::Pointer> parsedInfix = parseInfixEquation();
+  QVector<CalculatorItem::Pointer> parsedInfix = parseInfixEquation(true);
 
   // Convert the parsed infix expression into RPN
   QVector<CalculatorItem::Pointer> rpn = toRPN(parsedInfix);
@@ -469,6 +480,50 @@ void ArrayCalculator::execute()
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ArrayCalculator::executeFusedKernel()
+{
+  AttributeMatrix::Pointer selectedAM = getDataContainerArray()->getAttributeMatrix(m_SelectedAttributeMatrix);
+  DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
+  AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
+  if(nullptr == selectedAM || nullptr == createdAM)
+  {
+    return false;
+  }
+
+  IDataArray::Pointer outputArray = createdAM->getAttributeArray(m_CalculatedArray.getDataArrayName());
+  size_t numTuples = selectedAM->getNumberOfTuples();
+
+  // Single tuple results are broadcast differently by the operators, so leave those to the operator-by-operator path
+  if(nullptr == outputArray || numTuples <= 1 || outputArray->getNumberOfTuples() != numTuples)
+  {
+    return false;
+  }
+
+  // Parse the infix expression without converting the input arrays; the kernel reads them in their native type
+  QVector<CalculatorItem::Pointer> parsedInfix = parseInfixEquation(false);
+  if(getErrorCode() < 0)
+  {
+    return false;
+  }
+  QVector<CalculatorItem::Pointer> rpn = toRPN(parsedInfix);
+  if(getErrorCode() < 0 || rpn.isEmpty())
+  {
+    return false;
+  }
+
+  CalculatorKernel::Pointer kernel = CalculatorKernel::Compile(rpn, m_Units == Degrees, numTuples, static_cast<size_t>(outputArray->getNumberOfComponents()));
+  if(nullptr == kernel)
+  {
+    return false;
+  }
+
+  notifyStatusMessage("Computing fused expression");
+  return kernel->execute(outputArray);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -653,7 +708,7 @@ void ArrayCalculator::createSymbolMap()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QVector<CalculatorItem::Pointer> ArrayCalculator::parseInfixEquation()
+QVector<CalculatorItem::Pointer> ArrayCalculator::parseInfixEquation(bool allocate)
 {
   int err = 0;
 
@@ -684,7 +739,7 @@ QVector<CalculatorItem::Pointer> ArrayCalculator::parseInfixEquation()
     else if(strItem.contains("[") && strItem.contains("]"))
     {
       // This is an index operator
-      if(!parseIndexOperator(strItem, parsedInfix))
+      if(!parseIndexOperator(strItem, parsedInfix, allocate))
       {
         return QVector<CalculatorItem::Pointer>();
       }
@@ -711,7 +766,7 @@ QVector<CalculatorItem::Pointer> ArrayCalculator::parseInfixEquation()
       }
       else if(selectedAM->getAttributeArrayNames().contains(strItem) || (!strItem.isEmpty() && strItem[0] == '\"' && strItem[strItem.size() - 1] == '\"'))
       {
-        if(!parseArray(strItem, parsedInfix, selectedAM))
+        if(!parseArray(strItem, parsedInfix, selectedAM, allocate))
         {
           return QVector<CalculatorItem::Pointer>();
         }
@@ -796,7 +851,7 @@ void ArrayCalculator::parseNumericValue(QString token, QVector<CalculatorItem::P
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::Pointer>& parsedInfix)
+bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::Pointer>& parsedInfix, bool allocate)
 {
   int idx = parsedInfix.size() - 1;
 
@@ -840,10 +895,16 @@ bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::
 
   parsedInfix.pop_back();
 
-  DoubleArrayType::Pointer reducedArray = calcArray->reduceToOneComponent(index, !getInPreflight());
+  DoubleArrayType::Pointer reducedArray = calcArray->reduceToOneComponent(index, allocate);
   CalculatorItem::Pointer itemPtr;
 
-  CREATE_CALCULATOR_ARRAY(itemPtr, reducedArray)
+  CREATE_CALCULATOR_ARRAY(itemPtr, reducedArray, allocate)
+  ICalculatorArray::Pointer reducedCalcArray = std::dynamic_pointer_cast<ICalculatorArray>(itemPtr);
+  if(nullptr != reducedCalcArray)
+  {
+    reducedCalcArray->setSourceArray(calcArray->getSourceArray());
+    reducedCalcArray->setSourceComponent(index);
+  }
   parsedInfix.push_back(itemPtr);
 
   QString ss = QObject::tr("Item '%1' in the infix expression is the name of an array in the selected Attribute Matrix, but it is currently being used as an indexing operator").arg(token);
@@ -887,7 +948,7 @@ bool ArrayCalculator::parseCommaOperator(QString token, QVector<CalculatorItem::
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-bool ArrayCalculator::parseArray(QString token, QVector<CalculatorItem::Pointer>& parsedInfix, const AttributeMatrixShPtrType& selectedAM)
+bool ArrayCalculator::parseArray(QString token, QVector<CalculatorItem::Pointer>& parsedInfix, const AttributeMatrixShPtrType& selectedAM, bool allocate)
 {
   int firstArray_NumTuples = -1;
   QString firstArray_Name = "";
@@ -915,7 +976,12 @@ bool ArrayCalculator::parseArray(QString token, QVector<CalculatorItem::Pointer>
 
   CalculatorItem::Pointer itemPtr;
 
-  CREATE_CALCULATOR_ARRAY(itemPtr, dataArray)
+  CREATE_CALCULATOR_ARRAY(itemPtr, dataArray, allocate)
+  ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(itemPtr);
+  if(nullptr != calcArray)
+  {
+    calcArray->setSourceArray(dataArray);
+  }
   parsedInfix.push_back(itemPtr);
   return true;
 }
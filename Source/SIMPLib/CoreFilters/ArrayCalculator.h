@@ -253,6 +253,13 @@ protected:
    */
   IDataArrayShPtrType convertArrayType(const IDataArrayShPtrType& inputArray, SIMPL::ScalarTypes::Type scalarType);
 
+  /**
+   * @brief Evaluates the expression with a single fused kernel that reads the input arrays in their
+   * native type and writes directly into the output array created by dataCheck().
+   * @return False if the expression cannot be evaluated this way and the operator-by-operator path must be used
+   */
+  bool executeFusedKernel();
+
 private:
   DataArrayPath m_SelectedAttributeMatrix = {"", "", ""};
   QString m_InfixEquation = {QString()};
@@ -265,7 +272,12 @@ private:
 
   void createSymbolMap();
 
-  QVector<CalculatorItemShPtrType> parseInfixEquation();
+  /**
+   * @brief Parses the infix expression into CalculatorItems
+   * @param allocate Whether the referenced arrays are converted into the double arrays used by the operators
+   * @return
+   */
+  QVector<CalculatorItemShPtrType> parseInfixEquation(bool allocate);
   QVector<CalculatorItemShPtrType> toRPN(QVector<CalculatorItemShPtrType> infixEquation);
 
   void checkForAmbiguousArrayName(QString itemStr, QString warningMsg);
@@ -295,9 +307,9 @@ private:
    * @brief parseIndexOperator
    * @param token
    * @param parsedInfix
-   * @param number
+   * @param allocate
    */
-  bool parseIndexOperator(QString token, QVector<CalculatorItemShPtrType>& parsedInfix);
+  bool parseIndexOperator(QString token, QVector<CalculatorItemShPtrType>& parsedInfix, bool allocate);
 
   /**
    * @brief parseCommaOperator
@@ -312,9 +324,10 @@ private:
    * @param token
    * @param parsedInfix
    * @param selectedAM
+   * @param allocate
    * @return
    */
-  bool parseArray(QString token, QVector<CalculatorItemShPtrType>& parsedInfix, const AttributeMatrixShPtrType& selectedAM);
+  bool parseArray(QString token, QVector<CalculatorItemShPtrType>& parsedInfix, const AttributeMatrixShPtrType& selectedAM, bool allocate);
 
 public:
   ArrayCalculator(const ArrayCalculator&) = delete;            // Copy Constructor Not Implemented
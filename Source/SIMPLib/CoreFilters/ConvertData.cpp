@@ -43,149 +43,12 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/NumericTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 
-#define CHECK_AND_CONVERT(Type, DataContainer, ScalarType, Array, AttributeMatrixName, OutputName)                                                                                                     \
-  if(false == completed)                                                                                                                                                                               \
-  {                                                                                                                                                                                                    \
-    Type::Pointer Type##Ptr = std::dynamic_pointer_cast<Type>(Array);                                                                                                                                  \
-    if(nullptr != Type##Ptr)                                                                                                                                                                           \
-    {                                                                                                                                                                                                  \
-      std::vector<size_t> dims = Array->getComponentDimensions();                                                                                                                                      \
-      Detail::ConvertData<Type>(this, Type##Ptr.get(), dims, DataContainer, ScalarType, AttributeMatrixName, OutputName);                                                                              \
-      completed = true;                                                                                                                                                                                \
-    }                                                                                                                                                                                                  \
-  }
-
-namespace Detail
-{
-template <typename T>
-/**
- * @brief ConvertData Templated function that converts an IDataArray to a given primitive type
- * @param ptr IDataArray instance pointer
- * @param dims Component dimensions
- * @param m DataContainer instance pointer
- * @param scalarType Primitive type to convert to
- * @param attributeMatrixName Name of target AttributeMatrix
- * @param name Name of converted array
- */
-void ConvertData(AbstractFilter* filter, T* ptr, const std::vector<size_t>& dims, DataContainer::Pointer m, SIMPL::NumericTypes::Type scalarType, const QString attributeMatrixName,
-                 const QString& name)
-{
-  size_t voxels = ptr->getNumberOfTuples();
-  size_t size = ptr->getSize();
-
-  if(scalarType == SIMPL::NumericTypes::Type::Int8)
-  {
-    Int8ArrayType::Pointer p = Int8ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int8_t>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::UInt8)
-  {
-    UInt8ArrayType::Pointer p = UInt8ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint8_t>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::Int16)
-  {
-    Int16ArrayType::Pointer p = Int16ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int16_t>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::UInt16)
-  {
-    UInt16ArrayType::Pointer p = UInt16ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint16_t>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::Int32)
-  {
-    Int32ArrayType::Pointer p = Int32ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int32_t>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::UInt32)
-  {
-    UInt32ArrayType::Pointer p = UInt32ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint32_t>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::Int64)
-  {
-    Int64ArrayType::Pointer p = Int64ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int64_t>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::UInt64)
-  {
-    UInt64ArrayType::Pointer p = UInt64ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint64_t>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::Float)
-  {
-    FloatArrayType::Pointer p = FloatArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<float>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::Double)
-  {
-    DoubleArrayType::Pointer p = DoubleArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<double>(ptr->getValue(v)));
-    }
-  }
-  else if(scalarType == SIMPL::NumericTypes::Type::Bool)
-  {
-    BoolArrayType::Pointer p = BoolArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<bool>(ptr->getValue(v)));
-    }
-  }
-  else
-  {
-    QString ss =
-        QString("Error Converting DataArray '%1/%2' from type %3 to type %4").arg(attributeMatrixName).arg(ptr->getName()).arg(static_cast<int>(ptr->getType())).arg(static_cast<int>(scalarType));
-    filter->setErrorCondition(-399, ss);
-  }
-}
-} // End Namespace Detail
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -205,6 +68,11 @@ void ConvertData::setupFilterParameters()
 
   parameters.push_back(SIMPL_NEW_NUMERICTYPE_FP("Scalar Type", ScalarType, FilterParameter::Category::Parameter, ConvertData));
 
+  {
+    std::vector<QString> choices = {"Cast", "Clamp to Range", "Normalize to Range"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Conversion Mode", ConversionMode, FilterParameter::Category::Parameter, ConvertData, choices, false));
+  }
+
   {
     DataArraySelectionFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array to Convert", SelectedCellArrayPath, FilterParameter::Category::RequiredArray, ConvertData, req));
@@ -225,6 +93,7 @@ void ConvertData::readFilterParameters(AbstractFilterParametersReader* reader, i
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setScalarType(static_cast<SIMPL::NumericTypes::Type>(reader->readValue("ScalarType", static_cast<int>(getScalarType()))));
   setOutputArrayName(reader->readString("OutputArrayName", getOutputArrayName()));
+  setConversionMode(reader->readValue("ConversionMode", getConversionMode()));
   reader->closeFilterGroup();
 }
 
@@ -253,6 +122,13 @@ void ConvertData::dataCheck()
     return;
   }
 
+  if(m_ConversionMode < static_cast<int>(IDataArray::ConversionMode::Cast) || m_ConversionMode > static_cast<int>(IDataArray::ConversionMode::Normalize))
+  {
+    ss = QObject::tr("The conversion mode must be 0 (Cast), 1 (Clamp to Range) or 2 (Normalize to Range)");
+    setErrorCondition(-397, ss);
+    return;
+  }
+
   if(getInPreflight())
   {
     AttributeMatrix::Pointer cellAttrMat = getDataContainerArray()->getPrereqAttributeMatrixFromPath(this, m_SelectedCellArrayPath, -301);
@@ -339,19 +215,18 @@ void ConvertData::execute()
     return;
   }
 
-  bool completed = false;
-  CHECK_AND_CONVERT(Int8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-
-  CHECK_AND_CONVERT(UInt8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(UInt16ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(Int16ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(UInt32ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(Int32ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(UInt64ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(Int64ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(FloatArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(DoubleArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(BoolArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  IDataArray::Pointer p = iArray->convertTo(m_ScalarType, m_OutputArrayName, static_cast<IDataArray::ConversionMode>(m_ConversionMode));
+  if(nullptr == p.get())
+  {
+    QString ss = QString("Error Converting DataArray '%1/%2' from type %3 to type %4")
+                     .arg(m_SelectedCellArrayPath.getAttributeMatrixName())
+                     .arg(iArray->getName())
+                     .arg(iArray->getTypeAsString())
+                     .arg(static_cast<int>(m_ScalarType));
+    setErrorCondition(-399, ss);
+    return;
+  }
+  am->insertOrAssign(p);
 }
 // -----------------------------------------------------------------------------
 //
@@ -489,3 +364,15 @@ DataArrayPath ConvertData::getSelectedCellArrayPath() const
 {
   return m_SelectedCellArrayPath;
 }
+
+// -----------------------------------------------------------------------------
+void ConvertData::setConversionMode(int value)
+{
+  m_ConversionMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int ConvertData::getConversionMode() const
+{
+  return m_ConversionMode;
+}
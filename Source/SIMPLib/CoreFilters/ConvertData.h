@@ -39,6 +39,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 /**
@@ -56,6 +57,7 @@ class SIMPLib_EXPORT ConvertData : public AbstractFilter
   PYB11_PROPERTY(SIMPL::NumericTypes::Type ScalarType READ getScalarType WRITE setScalarType)
   PYB11_PROPERTY(QString OutputArrayName READ getOutputArrayName WRITE setOutputArrayName)
   PYB11_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
+  PYB11_PROPERTY(int ConversionMode READ getConversionMode WRITE setConversionMode)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -116,6 +118,18 @@ public:
 
   Q_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
 
+  /**
+   * @brief Setter property for ConversionMode
+   */
+  void setConversionMode(int value);
+  /**
+   * @brief Getter property for ConversionMode
+   * @return Value of ConversionMode
+   */
+  int getConversionMode() const;
+
+  Q_PROPERTY(int ConversionMode READ getConversionMode WRITE setConversionMode)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -198,4 +212,5 @@ private:
   SIMPL::NumericTypes::Type m_ScalarType = {SIMPL::NumericTypes::Type::Int8};
   QString m_OutputArrayName = {""};
   DataArrayPath m_SelectedCellArrayPath = {"", "", ""};
+  int m_ConversionMode = {static_cast<int>(IDataArray::ConversionMode::Cast)};
 };
@@ -192,32 +192,6 @@ void CropVertexGeometry::dataCheck()
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, std::vector<int64_t>& croppedPoints)
-{
-  typename DataArray<T>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
-  T* inputData = static_cast<T*>(inputDataPtr->getPointer(0));
-  typename DataArray<T>::Pointer croppedDataPtr = std::dynamic_pointer_cast<DataArray<T>>(outDataPtr);
-  T* croppedData = static_cast<T*>(croppedDataPtr->getPointer(0));
-
-  size_t nComps = inDataPtr->getNumberOfComponents();
-  size_t tmpIndex = 0;
-  size_t ptrIndex = 0;
-
-  for(std::vector<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
-  {
-    for(size_t d = 0; d < nComps; d++)
-    {
-      tmpIndex = nComps * i + d;
-      ptrIndex = nComps * croppedPoints[i] + d;
-      croppedData[tmpIndex] = inputData[ptrIndex];
-    }
-  }
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -276,21 +250,14 @@ void CropVertexGeometry::execute()
       AttributeMatrix::Type tempAttrMatType = tmpAttrMat->getType();
       if(tempAttrMatType == AttributeMatrix::Type::Vertex)
       {
-        tmpAttrMat->resizeAttributeArrays(tDims);
-        QList<QString> srcDataArrays = tmpAttrMat->getAttributeArrayNames();
         AttributeMatrix::Pointer srcAttrMat = m->getAttributeMatrix(tmpAttrMat->getName());
         assert(srcAttrMat);
 
-        for(auto&& data_array : srcDataArrays)
+        if(!tmpAttrMat->gatherAttributeArrays(*srcAttrMat, croppedPoints, tDims, this))
         {
-          IDataArray::Pointer src = srcAttrMat->getAttributeArray(data_array);
-          IDataArray::Pointer dest = tmpAttrMat->getAttributeArray(data_array);
-
-          assert(src);
-          assert(dest);
-          assert(src->getNumberOfComponents() == dest->getNumberOfComponents());
-
-          EXECUTE_FUNCTION_TEMPLATE(this, copyDataToCroppedGeometry, src, src, dest, croppedPoints)
+          QString ss = QObject::tr("Failed to copy the cropped vertex data into Attribute Matrix '%1'").arg(tmpAttrMat->getName());
+          setErrorCondition(-302, ss);
+          return;
         }
       }
     }
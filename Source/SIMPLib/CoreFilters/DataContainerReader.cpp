@@ -34,6 +34,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "DataContainerReader.h"
 
+#include <algorithm>
+
 #include <QtCore/QDebug>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
@@ -51,10 +53,13 @@
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Montages/MontageSupport.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
+#include "SIMPLib/Utilities/SIMPLH5Mutex.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -87,6 +92,9 @@ void DataContainerReader::setupFilterParameters()
     parameter->setFilter(this);
     parameters.push_back(parameter);
   }
+  std::vector<QString> linkedProps = {"MontageMemoryBudget"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Load Montage Tiles on Demand", LazyMontageLoading, FilterParameter::Category::Parameter, DataContainerReader, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Montage Memory Budget (MB)", MontageMemoryBudget, FilterParameter::Category::Parameter, DataContainerReader));
 
   setFilterParameters(parameters);
 }
@@ -101,6 +109,8 @@ void DataContainerReader::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileDataContainerArrayProxy(reader->readDataContainerArrayProxy("InputFileDataContainerArrayProxy", getInputFileDataContainerArrayProxy()));
   syncProxies(); // Sync the file proxy and currently cached proxy together into one proxy
   setOverwriteExistingDataContainers(reader->readValue("OverwriteExistingDataContainers", getOverwriteExistingDataContainers()));
+  setLazyMontageLoading(reader->readValue("LazyMontageLoading", getLazyMontageLoading()));
+  setMontageMemoryBudget(reader->readValue("MontageMemoryBudget", getMontageMemoryBudget()));
   reader->closeFilterGroup();
 }
 
@@ -184,12 +194,54 @@ void DataContainerReader::dataCheck()
     setWarningCondition(1000, msg);
   }
 
+  if(getMontageMemoryBudget() < 0)
+  {
+    ss = QObject::tr("The montage memory budget must be 0 (unlimited) or greater");
+    setErrorCondition(-391, ss);
+    return;
+  }
+
+  // Montage tiles only have their structure read when they are loaded on demand
+  DataContainerArrayProxy proxy = m_InputFileDataContainerArrayProxy;
+  DataContainerArrayProxy tileProxy;
+  if(getLazyMontageLoading())
+  {
+    const DataContainerArray::MontageCollection lazyMontages = readMontageGroup(DataContainerArray::NullPointer());
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    for(const auto& montage : lazyMontages)
+    {
+      for(const QString& dcName : montage->getDataContainerNames())
+      {
+        if(proxy.contains(dcName) && proxy.getDataContainerProxy(dcName).getFlag() != Qt::Unchecked && !tileProxy.contains(dcName))
+        {
+          tileProxy.insertDataContainer(dcName, proxy.getDataContainerProxy(dcName));
+          proxy.getDataContainerProxy(dcName).setFlag(Qt::Unchecked);
+        }
+      }
+    }
+  }
+
   // Read either the structure or all the data depending on the preflight status
-  DataContainerArray::Pointer tempDCA = readData(m_InputFileDataContainerArrayProxy);
+  DataContainerArray::Pointer tempDCA = readData(proxy);
   if(tempDCA.get() == nullptr)
   {
     return;
   }
+  if(!tileProxy.getDataContainers().empty())
+  {
+    DataContainerArray::Pointer tileDCA = readMontageTileStructure(tileProxy);
+    if(tileDCA.get() == nullptr)
+    {
+      return;
+    }
+    for(const DataContainer::Pointer& tile : tileDCA->getDataContainers())
+    {
+      tempDCA->addOrReplaceDataContainer(tile);
+    }
+  }
 
   DataContainerArray::Container tempContainers = tempDCA->getDataContainers();
   for(DataContainer::Pointer container : tempContainers)
@@ -259,6 +311,7 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
     return DataContainerArray::New();
   }
 
+  SIMPLH5Mutex::LockType h5Lock = SIMPLH5Mutex::Lock();
   hid_t fileId = QH5Utilities::openFile(getInputFile(), true); // Open the file Read Only
   if(fileId < 0)
   {
@@ -282,11 +335,27 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   return dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer DataContainerReader::readMontageTileStructure(DataContainerArrayProxy& tileProxy)
+{
+  SIMPLH5DataReader::Pointer simplReader = SIMPLH5DataReader::New();
+  connect(simplReader.get(), &SIMPLH5DataReader::errorGenerated, [=](const QString& title, const QString& msg, int code) { setErrorCondition(code, msg); });
+
+  if(!simplReader->openFile(getInputFile()))
+  {
+    return DataContainerArray::NullPointer();
+  }
+  return simplReader->readSIMPLDataUsingProxy(tileProxy, true);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 DataContainerArray::MontageCollection DataContainerReader::readMontageGroup(const DataContainerArray::Pointer& dca)
 {
+  SIMPLH5Mutex::LockType h5Lock = SIMPLH5Mutex::Lock();
   hid_t fileId = QH5Utilities::openFile(getInputFile(), true); // Open the file Read Only
   if(fileId < 0)
   {
@@ -299,7 +368,9 @@ DataContainerArray::MontageCollection DataContainerReader::readMontageGroup(cons
   hid_t groupId = QH5Utilities::openHDF5Object(fileId, SIMPL::StringConstants::MontageGroupName);
   sentinel.addGroupId(groupId);
   int err = 0;
-  DataContainerArray::MontageCollection montages = MontageSupport::IO::ReadMontagesFromHDF5(groupId, dca, err);
+  GridMontage::TileLoaderType tileLoader = getLazyMontageLoading() ? createMontageTileLoader() : nullptr;
+  size_t memoryBudget = static_cast<size_t>(std::max(getMontageMemoryBudget(), 0)) * 1024 * 1024;
+  DataContainerArray::MontageCollection montages = MontageSupport::IO::ReadMontagesFromHDF5(groupId, dca, err, tileLoader, memoryBudget);
   if(err < 0)
   {
     QString ss = QObject::tr("Error reading montage collection");
@@ -308,6 +379,47 @@ DataContainerArray::MontageCollection DataContainerReader::readMontageGroup(cons
   return montages;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+GridMontage::TileLoaderType DataContainerReader::createMontageTileLoader() const
+{
+  const QString inputFile = getInputFile();
+  const DataContainerArrayProxy::StorageType dcProxies = m_InputFileDataContainerArrayProxy.getDataContainers();
+  if(getInPreflight())
+  {
+    // The tiles in the DataContainerArray already hold their structure during preflight
+    return [](const QString& dcName) -> DataContainer::Pointer {
+      Q_UNUSED(dcName)
+      return DataContainer::NullPointer();
+    };
+  }
+
+  return [inputFile, dcProxies](const QString& dcName) -> DataContainer::Pointer {
+    if(!dcProxies.contains(dcName) || dcProxies.value(dcName).getFlag() == Qt::Unchecked)
+    {
+      return nullptr;
+    }
+
+    // Read only the requested tile with the arrays selected for it
+    DataContainerArrayProxy tileProxy;
+    DataContainerProxy dcProxy = dcProxies.value(dcName);
+    tileProxy.insertDataContainer(dcName, dcProxy);
+
+    SIMPLH5DataReader::Pointer simplReader = SIMPLH5DataReader::New();
+    if(!simplReader->openFile(inputFile))
+    {
+      return nullptr;
+    }
+    DataContainerArray::Pointer tileDca = simplReader->readSIMPLDataUsingProxy(tileProxy, false);
+    if(nullptr == tileDca)
+    {
+      return nullptr;
+    }
+    return tileDca->getDataContainer(dcName);
+  };
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -609,6 +721,30 @@ bool DataContainerReader::getOverwriteExistingDataContainers() const
   return m_OverwriteExistingDataContainers;
 }
 
+// -----------------------------------------------------------------------------
+void DataContainerReader::setLazyMontageLoading(bool value)
+{
+  m_LazyMontageLoading = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerReader::getLazyMontageLoading() const
+{
+  return m_LazyMontageLoading;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerReader::setMontageMemoryBudget(int value)
+{
+  m_MontageMemoryBudget = value;
+}
+
+// -----------------------------------------------------------------------------
+int DataContainerReader::getMontageMemoryBudget() const
+{
+  return m_MontageMemoryBudget;
+}
+
 // -----------------------------------------------------------------------------
 void DataContainerReader::setLastFileRead(const QString& value)
 {
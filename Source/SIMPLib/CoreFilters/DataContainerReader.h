@@ -44,6 +44,7 @@
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Montages/GridMontage.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 class DataContainerArray;
 using DataContainerArrayShPtrType = std::shared_ptr<DataContainerArray>;
@@ -67,6 +68,8 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
   PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
   PYB11_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
   PYB11_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
+  PYB11_PROPERTY(bool LazyMontageLoading READ getLazyMontageLoading WRITE setLazyMontageLoading)
+  PYB11_PROPERTY(int MontageMemoryBudget READ getMontageMemoryBudget WRITE setMontageMemoryBudget)
   PYB11_METHOD(DataContainerArrayProxy readDataContainerArrayStructure ARGS path)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -152,6 +155,30 @@ public:
 
   Q_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
 
+  /**
+   * @brief Setter property for LazyMontageLoading
+   */
+  void setLazyMontageLoading(bool value);
+  /**
+   * @brief Getter property for LazyMontageLoading
+   * @return Value of LazyMontageLoading
+   */
+  bool getLazyMontageLoading() const;
+
+  Q_PROPERTY(bool LazyMontageLoading READ getLazyMontageLoading WRITE setLazyMontageLoading)
+
+  /**
+   * @brief Setter property for MontageMemoryBudget
+   */
+  void setMontageMemoryBudget(int value);
+  /**
+   * @brief Getter property for MontageMemoryBudget
+   * @return Value of MontageMemoryBudget
+   */
+  int getMontageMemoryBudget() const;
+
+  Q_PROPERTY(int MontageMemoryBudget READ getMontageMemoryBudget WRITE setMontageMemoryBudget)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -286,6 +313,21 @@ protected:
    */
   DataContainerArray::MontageCollection readMontageGroup(const DataContainerArray::Pointer& dca);
 
+  /**
+   * @brief Reads only the structure of the lazily loaded montage tiles selected in the given proxy.
+   * @param tileProxy
+   * @return
+   */
+  DataContainerArray::Pointer readMontageTileStructure(DataContainerArrayProxy& tileProxy);
+
+  /**
+   * @brief Returns a loader that reads a single montage tile from the input file using
+   * the selection in the input file proxy. Unselected tiles are not read. During preflight
+   * the loader reads nothing since the tiles already hold their structure.
+   * @return
+   */
+  GridMontage::TileLoaderType createMontageTileLoader() const;
+
 protected Q_SLOTS:
   /**
    * @brief Cleans up the filter after execution
@@ -298,6 +340,8 @@ private:
   QString m_LastFileRead = {""};
   QDateTime m_LastRead = {QDateTime::currentDateTime()};
   DataContainerArrayProxy m_InputFileDataContainerArrayProxy = {};
+  bool m_LazyMontageLoading = {false};
+  int m_MontageMemoryBudget = {0};
 
   FilterPipeline::Pointer m_PipelineFromFile;
 
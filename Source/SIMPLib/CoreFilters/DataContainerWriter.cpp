@@ -47,11 +47,16 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/HDF5/H5ChunkedDatasetWriter.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/Montages/GridMontage.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
+#include "SIMPLib/Utilities/SIMPLH5Mutex.h"
 
 #ifdef _WIN32
 extern Q_CORE_EXPORT int qt_ntfs_permission_lookup;
@@ -77,6 +82,12 @@ void DataContainerWriter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Category::Parameter, DataContainerWriter, "*.dream3d", ""));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Write Xdmf File", WriteXdmfFile, FilterParameter::Category::Parameter, DataContainerWriter));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Include Xdmf Time Markers", WriteTimeSeries, FilterParameter::Category::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Chunk Arrays", ChunkArrays, FilterParameter::Category::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Chunk Size (KB)", ChunkSize, FilterParameter::Category::Parameter, DataContainerWriter));
+  std::vector<QString> linkedProps = {"CompressionLevel", "ShuffleBytes"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Compress Arrays", CompressArrays, FilterParameter::Category::Parameter, DataContainerWriter, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level (1-9)", CompressionLevel, FilterParameter::Category::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Shuffle Bytes Before Compressing", ShuffleBytes, FilterParameter::Category::Parameter, DataContainerWriter));
 
   setFilterParameters(parameters);
 }
@@ -89,6 +100,11 @@ void DataContainerWriter::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteXdmfFile(reader->readValue("WriteXdmfFile", getWriteXdmfFile()));
+  setChunkArrays(reader->readValue("ChunkArrays", getChunkArrays()));
+  setChunkSize(reader->readValue("ChunkSize", getChunkSize()));
+  setCompressArrays(reader->readValue("CompressArrays", getCompressArrays()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
+  setShuffleBytes(reader->readValue("ShuffleBytes", getShuffleBytes()));
   reader->closeFilterGroup();
 }
 
@@ -114,6 +130,17 @@ void DataContainerWriter::dataCheck()
     m_OutputFile.append(".dream3d");
   }
   FileSystemPathHelper::CheckOutputFile(this, "Output File Path", getOutputFile(), true);
+
+  if((m_ChunkArrays || m_CompressArrays) && m_ChunkSize < 1)
+  {
+    ss = QObject::tr("The chunk size must be at least 1 KB");
+    setErrorCondition(-11114, ss);
+  }
+  if(m_CompressArrays && (m_CompressionLevel < 1 || m_CompressionLevel > 9))
+  {
+    ss = QObject::tr("The compression level must be between 1 and 9");
+    setErrorCondition(-11115, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -139,6 +166,7 @@ void DataContainerWriter::execute()
     return;
   }
 
+  SIMPLH5Mutex::LockType h5Lock = SIMPLH5Mutex::Lock();
   hid_t fileId = -1;
 
   // Try to open a file to append data into
@@ -200,10 +228,30 @@ void DataContainerWriter::execute()
   hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
   scopedFileSentinel.addGroupId(dcaGid);
 
+  // Every DataArray written below picks up the chunking and compression options
+  H5ChunkedDatasetWriter::Options storageOptions;
+  storageOptions.chunked = m_ChunkArrays;
+  storageOptions.chunkBytes = static_cast<size_t>(m_ChunkSize) * 1024;
+  storageOptions.compressionLevel = m_CompressArrays ? m_CompressionLevel : 0;
+  storageOptions.shuffle = m_ShuffleBytes;
+  H5ChunkedDatasetWriter::ScopedOptions storageOptionsScope(storageOptions);
+
   QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
+  DataContainerArray::MontageCollection montages = getDataContainerArray()->getMontageCollection();
   for(int iter = 0; iter < getDataContainerArray()->getNumDataContainers(); iter++)
   {
     DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcNames[iter]);
+
+    // Tiles of lazily loaded montages only hold their structure until they are read
+    for(const auto& montage : montages)
+    {
+      GridMontage::Pointer gridMontage = std::dynamic_pointer_cast<GridMontage>(montage);
+      if(nullptr != gridMontage && gridMontage->isLazyLoading() && gridMontage->loadDataContainer(dc))
+      {
+        break;
+      }
+    }
+
     IGeometry::Pointer geometry = dc->getGeometry();
     err = H5Utilities::createGroupsFromPath(dcNames[iter].toLatin1().data(), dcaGid);
     if(err < 0)
@@ -568,3 +616,63 @@ bool DataContainerWriter::getAppendToExisting() const
 {
   return m_AppendToExisting;
 }
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setChunkArrays(bool value)
+{
+  m_ChunkArrays = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerWriter::getChunkArrays() const
+{
+  return m_ChunkArrays;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setChunkSize(int value)
+{
+  m_ChunkSize = value;
+}
+
+// -----------------------------------------------------------------------------
+int DataContainerWriter::getChunkSize() const
+{
+  return m_ChunkSize;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setCompressArrays(bool value)
+{
+  m_CompressArrays = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerWriter::getCompressArrays() const
+{
+  return m_CompressArrays;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setCompressionLevel(int value)
+{
+  m_CompressionLevel = value;
+}
+
+// -----------------------------------------------------------------------------
+int DataContainerWriter::getCompressionLevel() const
+{
+  return m_CompressionLevel;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setShuffleBytes(bool value)
+{
+  m_ShuffleBytes = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerWriter::getShuffleBytes() const
+{
+  return m_ShuffleBytes;
+}
@@ -61,6 +61,11 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
   PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
   PYB11_PROPERTY(bool WriteXdmfFile READ getWriteXdmfFile WRITE setWriteXdmfFile)
   PYB11_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
+  PYB11_PROPERTY(bool ChunkArrays READ getChunkArrays WRITE setChunkArrays)
+  PYB11_PROPERTY(int ChunkSize READ getChunkSize WRITE setChunkSize)
+  PYB11_PROPERTY(bool CompressArrays READ getCompressArrays WRITE setCompressArrays)
+  PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+  PYB11_PROPERTY(bool ShuffleBytes READ getShuffleBytes WRITE setShuffleBytes)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -131,6 +136,66 @@ public:
 
   Q_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
 
+  /**
+   * @brief Setter property for ChunkArrays
+   */
+  void setChunkArrays(bool value);
+  /**
+   * @brief Getter property for ChunkArrays
+   * @return Value of ChunkArrays
+   */
+  bool getChunkArrays() const;
+
+  Q_PROPERTY(bool ChunkArrays READ getChunkArrays WRITE setChunkArrays)
+
+  /**
+   * @brief Setter property for ChunkSize, the target size of each chunk in KB
+   */
+  void setChunkSize(int value);
+  /**
+   * @brief Getter property for ChunkSize
+   * @return Value of ChunkSize
+   */
+  int getChunkSize() const;
+
+  Q_PROPERTY(int ChunkSize READ getChunkSize WRITE setChunkSize)
+
+  /**
+   * @brief Setter property for CompressArrays
+   */
+  void setCompressArrays(bool value);
+  /**
+   * @brief Getter property for CompressArrays
+   * @return Value of CompressArrays
+   */
+  bool getCompressArrays() const;
+
+  Q_PROPERTY(bool CompressArrays READ getCompressArrays WRITE setCompressArrays)
+
+  /**
+   * @brief Setter property for CompressionLevel
+   */
+  void setCompressionLevel(int value);
+  /**
+   * @brief Getter property for CompressionLevel
+   * @return Value of CompressionLevel
+   */
+  int getCompressionLevel() const;
+
+  Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
+  /**
+   * @brief Setter property for ShuffleBytes
+   */
+  void setShuffleBytes(bool value);
+  /**
+   * @brief Getter property for ShuffleBytes
+   * @return Value of ShuffleBytes
+   */
+  bool getShuffleBytes() const;
+
+  Q_PROPERTY(bool ShuffleBytes READ getShuffleBytes WRITE setShuffleBytes)
+
   /**
    * @brief Setter property for AppendToExisting
    */
@@ -251,6 +316,11 @@ private:
   bool m_WriteXdmfFile = {true};
   bool m_WriteTimeSeries = {false};
   bool m_AppendToExisting = {false};
+  bool m_ChunkArrays = {false};
+  int m_ChunkSize = {1024};
+  bool m_CompressArrays = {false};
+  int m_CompressionLevel = {5};
+  bool m_ShuffleBytes = {true};
 
 public:
   DataContainerWriter(const DataContainerWriter&) = delete;            // Copy Constructor Not Implemented
@@ -48,6 +48,7 @@
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
+#include "SIMPLib/Utilities/ParallelTextWriter.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -228,12 +229,13 @@ void FeatureDataCSVWriter::execute()
     numTuples = data[0]->getNumberOfTuples();
   }
 
+  // The rows are formatted in parallel and written after everything the stream holds
+  outFile.flush();
+  ParallelTextWriter textWriter;
+  const char delimiter = m_Delimiter;
   float threshold = 0.0f;
-
-  // Skip feature 0
-  for(size_t i = 1; i < numTuples; ++i)
-  {
-    float percentIncrement = static_cast<float>(i) / static_cast<float>(numTuples) * 100.0f;
+  auto progress = [this, numTuples, &threshold](size_t rowsWritten) {
+    float percentIncrement = static_cast<float>(rowsWritten) / static_cast<float>(numTuples) * 100.0f;
     if(percentIncrement > threshold)
     {
       QString ss = QObject::tr("Writing Feature Data || %1% Complete").arg(static_cast<double>(percentIncrement));
@@ -244,44 +246,55 @@ void FeatureDataCSVWriter::execute()
         threshold = percentIncrement;
       }
     }
+  };
 
-    // Print the feature id
-    outFile << i;
-    // Print a row of data
-    for(std::vector<IDataArray::Pointer>::iterator p = data.begin(); p != data.end(); ++p)
-    {
-      outFile << m_Delimiter;
-      (*p)->printTuple(outFile, i, m_Delimiter);
-    }
-    outFile << "\n";
-  }
-
-  if(m_WriteNeighborListData)
+  // Skip feature 0
+  bool written = textWriter.writeRows(file, 1, numTuples,
+                                      [&data, delimiter](size_t i, std::string& buffer) {
+                                        // Print the feature id
+                                        ParallelTextWriter::AppendValue(buffer, i);
+                                        // Print a row of data
+                                        for(const auto& p : data)
+                                        {
+                                          buffer.push_back(delimiter);
+                                          p->appendTuple(buffer, i, delimiter);
+                                        }
+                                        buffer.push_back('\n');
+                                      },
+                                      progress);
+
+  if(written && m_WriteNeighborListData)
   {
     // Print the FeatureIds Header before the rest of the headers
     // Loop throught the list and print the rest of the headers, ignoring those we don't want
-    for(QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
+    for(QList<QString>::iterator iter = headers.begin(); iter != headers.end() && written; ++iter)
     {
       // Only get the array if the name does NOT match those listed
       IDataArray::Pointer p = cellFeatureAttrMat->getAttributeArray(*iter);
       if(p->getNameOfClass().compare(neighborlistPtr->getNameOfClass()) == 0)
       {
         outFile << SIMPL::FeatureData::FeatureID << m_Delimiter << SIMPL::FeatureData::NumNeighbors << m_Delimiter << (*iter) << "\n";
+        outFile.flush();
         numTuples = p->getNumberOfTuples();
 
         // Skip feature 0
-        for(size_t i = 1; i < numTuples; ++i)
-        {
+        written = textWriter.writeRows(file, 1, numTuples, [&p, delimiter](size_t i, std::string& buffer) {
           // Print the feature id
-          outFile << i;
+          ParallelTextWriter::AppendValue(buffer, i);
           // Print a row of data
-          outFile << m_Delimiter;
-          p->printTuple(outFile, i, m_Delimiter);
-          outFile << "\n";
-        }
+          buffer.push_back(delimiter);
+          p->appendTuple(buffer, i, delimiter);
+          buffer.push_back('\n');
+        });
       }
     }
   }
+
+  if(!written)
+  {
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getFeatureDataFile());
+    setErrorCondition(-101, ss);
+  }
   file.close();
 }
 
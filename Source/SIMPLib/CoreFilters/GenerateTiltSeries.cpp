@@ -32,22 +32,17 @@
 
 #include "GenerateTiltSeries.h"
 
+#include <algorithm>
 #include <cmath>
-#include <thread>
+#include <type_traits>
 
 #define GTS_GENERATE_DEBUG_ARRAYS 0
-// If we are writing out all the arrays for debugging then we MUST be single threaded.
-#if(GTS_GENERATE_DEBUG_ARRAYS == 1)
-#undef SIMPL_USE_PARALLEL_ALGORITHMS
-#endif
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/task_group.h>
-#endif
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
@@ -59,6 +54,7 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #ifndef DREAM3D_PASSIVE_ROTATION
 #define DREAM3D_PASSIVE_ROTATION 1
@@ -87,228 +83,430 @@ namespace Detail
 
 const QString k_AttributeMatrixName("Slice Data");
 
-class ResampleGrid
+using AxisAngleType = std::array<float, 4>;
+using OrientationMatrixType = std::array<float, 9>;
+
+/**
+ * @brief The GridSampler class caches the origin, spacing and dimensions of an ImageGeom so
+ * that cell lookups inside the parallel loops do not go through the geometry object.
+ */
+class GridSampler
 {
 public:
-  using AxisAngleType = std::array<float, 4>;
-  using CoordinateType = FloatVec3Type;
-  using OrientationMatrixType = std::vector<float>;
+  explicit GridSampler(const ImageGeom& geom)
+  : m_Origin(geom.getOrigin())
+  , m_Spacing(geom.getSpacing())
+  , m_Dims(geom.getDimensions())
+  {
+  }
 
-  ResampleGrid(GenerateTiltSeries* filter, const FloatArrayType::Pointer& inputGrid, const DataContainer::Pointer& outDc, const AxisAngleType& rotationAxis
-#if GTS_GENERATE_DEBUG_ARRAYS
-               ,
-               size_t gridIndex
-#endif
-               )
-  : m_Filter(filter)
-  , m_Coords(inputGrid)
-  , m_OutputDC(outDc)
-  , m_RotationAxis(rotationAxis)
-#if GTS_GENERATE_DEBUG_ARRAYS
-  , m_GridIndex(gridIndex)
-#endif
+  /**
+   * @brief Computes the linear index of the cell that contains the coordinate.
+   * @return false if the coordinate lies outside of the geometry
+   */
+  bool cellIndex(const float coord[3], size_t& index) const
   {
+    size_t cell[3] = {0, 0, 0};
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(coord[i] < m_Origin[i])
+      {
+        return false;
+      }
+      cell[i] = static_cast<size_t>((coord[i] - m_Origin[i]) / m_Spacing[i]);
+      if(cell[i] >= m_Dims[i])
+      {
+        return false;
+      }
+    }
+    index = (m_Dims[0] * m_Dims[1] * cell[2]) + (m_Dims[0] * cell[1]) + cell[0];
+    return true;
   }
-  ~ResampleGrid() = default;
 
-  ResampleGrid(const ResampleGrid&) = default;
-  ResampleGrid(ResampleGrid&&) noexcept = default;
-  ResampleGrid& operator=(const ResampleGrid&) = delete; // Copy Assignment Not Implemented
-  ResampleGrid& operator=(ResampleGrid&&) = delete;      // Move Assignment Not Implemented
+  /**
+   * @brief Computes the 8 cells and weights used to trilinearly interpolate between cell
+   * centers at the coordinate. Neighbors are clamped at the faces of the geometry.
+   * @return false if the coordinate lies outside of the geometry
+   */
+  bool trilinearStencil(const float coord[3], std::array<size_t, 8>& indices, std::array<float, 8>& weights) const
+  {
+    std::array<size_t, 3> lo = {0, 0, 0};
+    std::array<size_t, 3> hi = {0, 0, 0};
+    std::array<float, 3> frac = {0.0f, 0.0f, 0.0f};
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(coord[i] < m_Origin[i] || coord[i] >= m_Origin[i] + m_Dims[i] * m_Spacing[i])
+      {
+        return false;
+      }
+      float u = (coord[i] - m_Origin[i]) / m_Spacing[i] - 0.5f;
+      if(u <= 0.0f)
+      {
+        continue;
+      }
+      size_t cell = static_cast<size_t>(u);
+      if(cell + 1 >= m_Dims[i])
+      {
+        lo[i] = m_Dims[i] - 1;
+        hi[i] = lo[i];
+        continue;
+      }
+      lo[i] = cell;
+      hi[i] = cell + 1;
+      frac[i] = u - static_cast<float>(cell);
+    }
+
+    for(size_t corner = 0; corner < 8; corner++)
+    {
+      bool bx = (corner & 1) != 0;
+      bool by = (corner & 2) != 0;
+      bool bz = (corner & 4) != 0;
+      indices[corner] = (m_Dims[0] * m_Dims[1] * (bz ? hi[2] : lo[2])) + (m_Dims[0] * (by ? hi[1] : lo[1])) + (bx ? hi[0] : lo[0]);
+      weights[corner] = (bx ? frac[0] : 1.0f - frac[0]) * (by ? frac[1] : 1.0f - frac[1]) * (bz ? frac[2] : 1.0f - frac[2]);
+    }
+    return true;
+  }
 
-  void operator()() const
+  /**
+   * @brief Returns the length of the diagonal of the geometry's bounding box
+   */
+  float diagonalLength() const
   {
+    float sum = 0.0f;
+    for(size_t i = 0; i < 3; i++)
+    {
+      float length = m_Dims[i] * m_Spacing[i];
+      sum += length * length;
+    }
+    return std::sqrt(sum);
+  }
 
-    //========= Input Data Structure Elements
-    DataContainerArray::Pointer dca = m_Filter->getDataContainerArray();
-    IDataArray::Pointer inputData = dca->getPrereqIDataArrayFromPath(m_Filter, m_Filter->getInputDataArrayPath());
-    DataArrayPath inputDataArrayPath = m_Filter->getInputDataArrayPath();
-    DataContainer::Pointer inputDC = dca->getDataContainer(inputDataArrayPath.getDataContainerName());
-    ImageGeom::Pointer inputImageGeom = inputDC->getGeometryAs<ImageGeom>();
-    FloatVec6Type inBounds = inputImageGeom->getBoundingBox();
-    FloatVec3Type inCenter = {(inBounds[1] - inBounds[0]) / 2.0f + inBounds[0], (inBounds[3] - inBounds[2]) / 2.0f + inBounds[2], (inBounds[5] - inBounds[4]) / 2.0f + inBounds[4]};
+  /**
+   * @brief Returns the smallest spacing of the geometry
+   */
+  float minSpacing() const
+  {
+    return std::min({m_Spacing[0], m_Spacing[1], m_Spacing[2]});
+  }
 
-    //  printf("inCenter %f %f %f\n", inCenter[0], inCenter[1], inCenter[2]);
+  /**
+   * @brief Returns the largest spacing of the geometry
+   */
+  float maxSpacing() const
+  {
+    return std::max({m_Spacing[0], m_Spacing[1], m_Spacing[2]});
+  }
 
-    //========= Output Data Structure Elements
-    ImageGeom::Pointer outputImageGeom = m_OutputDC->getGeometryAs<ImageGeom>();
-    FloatVec6Type bounds = outputImageGeom->getBoundingBox();
-    FloatVec3Type center = {(bounds[1] - bounds[0]) / 2.0f + bounds[0], (bounds[3] - bounds[2]) / 2.0f + bounds[2], (bounds[5] - bounds[4]) / 2.0f + bounds[4]};
+private:
+  FloatVec3Type m_Origin;
+  FloatVec3Type m_Spacing;
+  SizeVec3Type m_Dims;
+};
 
-    //  printf("outCenter %f %f %f\n", center[0], center[1], center[2]);
+// -----------------------------------------------------------------------------
+template <typename T, typename K>
+K transformCoordinate(const T& orientationMatrix, const K& coord)
+{
+  K outCoord = {0, 0, 0};
 
-    AttributeMatrix::Pointer attrMat = m_OutputDC->getAttributeMatrix(Detail::k_AttributeMatrixName);
-    IDataArray::Pointer outputData = attrMat->getAttributeArray(m_Filter->getInputDataArrayPath().getDataArrayName());
-    outputData->initializeWithZeros();
-#if GTS_GENERATE_DEBUG_ARRAYS
-    SizeTArrayType::Pointer inputVoxIndexXYZ = SizeTArrayType::CreateArray(outputData->getNumberOfTuples(), {3}, "Input Voxel XYZ Index", true);
-    inputVoxIndexXYZ->initializeWithZeros();
-    attrMat->insertOrAssign(inputVoxIndexXYZ);
+  outCoord[0] = orientationMatrix[0] * coord[0] + orientationMatrix[1] * coord[1] + orientationMatrix[2] * coord[2];
+  outCoord[1] = orientationMatrix[3] * coord[0] + orientationMatrix[4] * coord[1] + orientationMatrix[5] * coord[2];
+  outCoord[2] = orientationMatrix[6] * coord[0] + orientationMatrix[7] * coord[1] + orientationMatrix[8] * coord[2];
 
-    SizeTArrayType::Pointer inputVoxIndex = SizeTArrayType::CreateArray(outputData->getNumberOfTuples(), {1}, "Input Voxel Index", true);
-    inputVoxIndex->initializeWithZeros();
-    attrMat->insertOrAssign(inputVoxIndex);
+  return outCoord;
+}
 
-    FloatArrayType::Pointer inputVoxCoord = FloatArrayType::CreateArray(outputData->getNumberOfTuples(), {3}, "Input Voxel Coord", true);
-    inputVoxCoord->initializeWithZeros();
-    attrMat->insertOrAssign(inputVoxCoord);
+// -----------------------------------------------------------------------------
+template <typename InputType, typename OutputType>
+OutputType ax2om(const InputType& a)
+{
+  OutputType res = {};
+  typename OutputType::value_type q = 0.0L;
+  typename OutputType::value_type c = 0.0L;
+  typename OutputType::value_type s = 0.0L;
+  typename OutputType::value_type omc = 0.0L;
+
+  c = cos(a[3]);
+  s = sin(a[3]);
+
+  omc = 1.0f - c;
+
+  res[0] = a[0] * a[0] * omc + c;
+  res[4] = a[1] * a[1] * omc + c;
+  res[8] = a[2] * a[2] * omc + c;
+  size_t _01 = 1;
+  size_t _10 = 3;
+  size_t _12 = 5;
+  size_t _21 = 7;
+  size_t _02 = 2;
+  size_t _20 = 6;
+  // Check to see if we need to transpose
+  if(Rotations::Constants::epsijk == 1.0f)
+  {
+    _01 = 3;
+    _10 = 1;
+    _12 = 7;
+    _21 = 5;
+    _02 = 6;
+    _20 = 2;
+  }
 
-#endif
-    // Generate the Rotation Matrix
-    OrientationMatrixType om = ax2om<AxisAngleType, OrientationMatrixType>(m_RotationAxis);
-#if GTS_GENERATE_DEBUG_ARRAYS
-    FloatArrayType::Pointer copyOfGrid = std::dynamic_pointer_cast<FloatArrayType>(m_Coords->deepCopy());
-    IDataArray::Pointer vertexOutputData = outputData->createNewArray(copyOfGrid->getNumberOfTuples(), outputData->getComponentDimensions(), outputData->getName(), true);
-    vertexOutputData->initializeWithZeros();
-#endif
-    ImageGeom::ErrorType err;
-    size_t numTuples = m_Coords->getNumberOfTuples();
-    //  int32_t numComp = m_Coords->getNumberOfComponents();
-    for(size_t tupleIndex = 0; tupleIndex < numTuples; tupleIndex++)
+  q = omc * a[0] * a[1];
+  res[_01] = q + s * a[2];
+  res[_10] = q - s * a[2];
+  q = omc * a[1] * a[2];
+  res[_12] = q + s * a[0];
+  res[_21] = q - s * a[0];
+  q = omc * a[2] * a[0];
+  res[_02] = q - s * a[1];
+  res[_20] = q + s * a[1];
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T convertInterpolatedValue(double value)
+{
+  if constexpr(std::is_same<T, bool>::value)
+  {
+    return value >= 0.5;
+  }
+  else if constexpr(std::is_integral<T>::value)
+  {
+    return static_cast<T>(std::round(value));
+  }
+  else
+  {
+    return static_cast<T>(value);
+  }
+}
+
+/**
+ * @brief The RotatedGrid struct holds everything needed to map a point on the sampling
+ * grid into the input volume for a single tilt angle.
+ */
+struct RotatedGrid
+{
+  RotatedGrid(const float* coords, const ImageGeom& inputGeom, const ImageGeom& outputGeom, const OrientationMatrixType& orientationMatrix, const FloatVec3Type& rotationCenter, int32_t interpolationType)
+  : gridCoords(coords)
+  , inputGrid(inputGeom)
+  , outputGrid(outputGeom)
+  , om(orientationMatrix)
+  , center(rotationCenter)
+  , interpolation(interpolationType)
+  {
+  }
+
+  const float* gridCoords = nullptr;
+  GridSampler inputGrid;
+  GridSampler outputGrid;
+  OrientationMatrixType om = {};
+  FloatVec3Type center;
+  int32_t interpolation = GenerateTiltSeries::k_NearestNeighbor;
+
+  // -----------------------------------------------------------------------------
+  FloatVec3Type rotatePoint(const float* coord) const
+  {
+    // Transform the Point via translation to move it to a relative position to (0,0,0)
+    FloatVec3Type inCoord(coord[0] - center[0], coord[1] - center[1], coord[2] - center[2]);
+
+    // Transform the point using the Orientation Matrix
+    FloatVec3Type outCoord = transformCoordinate<OrientationMatrixType, FloatVec3Type>(om, inCoord);
+
+    // Translate back to the actual grid
+    outCoord[0] = outCoord[0] + center[0];
+    outCoord[1] = outCoord[1] + center[1];
+    outCoord[2] = outCoord[2] + center[2];
+    return outCoord;
+  }
+};
+
+/**
+ * @brief The ResampleGridImpl class copies (or interpolates) the input cell values at every
+ * rotated grid point into the output slice.
+ */
+template <typename T>
+class ResampleGridImpl
+{
+public:
+  ResampleGridImpl(const RotatedGrid& grid, const T* inputData, T* outputData, size_t numComps)
+  : m_Grid(grid)
+  , m_InputData(inputData)
+  , m_OutputData(outputData)
+  , m_NumComps(numComps)
+  {
+  }
+  ~ResampleGridImpl() = default;
+
+  ResampleGridImpl(const ResampleGridImpl&) = default;
+  ResampleGridImpl(ResampleGridImpl&&) noexcept = default;
+  ResampleGridImpl& operator=(const ResampleGridImpl&) = delete; // Copy Assignment Not Implemented
+  ResampleGridImpl& operator=(ResampleGridImpl&&) = delete;      // Move Assignment Not Implemented
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::array<size_t, 8> indices = {};
+    std::array<float, 8> weights = {};
+    for(size_t tupleIndex = range.min(); tupleIndex < range.max(); tupleIndex++)
     {
-      size_t outputVoxelIndex = 0;
-      size_t inputVoxelIndex = 0;
+      const float* gridCoord = m_Grid.gridCoords + tupleIndex * 3;
 
-      // Get the original point as a copy
-      FloatVec3Type inCoord(m_Coords->getComponent(tupleIndex, 0), m_Coords->getComponent(tupleIndex, 1), m_Coords->getComponent(tupleIndex, 2));
-#if GTS_GENERATE_DEBUG_ARRAYS
-      inputVoxCoord->setTuple(tupleIndex, inCoord.data());
-#endif
       // Find the voxel that data will be copied into
-      err = outputImageGeom->computeCellIndex(inCoord.data(), outputVoxelIndex);
-      if(err != ImageGeom::ErrorType::NoError)
+      size_t outputVoxelIndex = 0;
+      if(!m_Grid.outputGrid.cellIndex(gridCoord, outputVoxelIndex))
       {
         continue;
       }
-      //   std::cout << tupleIndex << "\tCoord:" << inCoord[0] << ", " << inCoord[1] << ", " << inCoord[2];
-
-      // Transform the Point via translation to move it to a relative position to (0,0,0)
-      inCoord[0] = inCoord[0] - center[0];
-      inCoord[1] = inCoord[1] - center[1];
-      inCoord[2] = inCoord[2] - center[2];
+      FloatVec3Type outCoord = m_Grid.rotatePoint(gridCoord);
+      T* dest = m_OutputData + outputVoxelIndex * m_NumComps;
 
-      // Transform the point using the Orientation Matrix
-      CoordinateType outCoord = transformCoordinate<OrientationMatrixType, FloatVec3Type>(om, inCoord);
-
-      // Translate back to the actual grid
-      outCoord[0] = outCoord[0] + center[0];
-      outCoord[1] = outCoord[1] + center[1];
-      outCoord[2] = outCoord[2] + center[2];
-
-// Set the transformed coordinate into the copy of the grid Vertex List
-#if GTS_GENERATE_DEBUG_ARRAYS
-      copyOfGrid->setTuple(tupleIndex, outCoord.data());
-#endif
-
-      //    std::cout << "\t InputVoxelIndex: " << inputVoxelIndices[0] << ", " << inputVoxelIndices[1] << ", " << inputVoxelIndices[2] << std::endl;
-#if GTS_GENERATE_DEBUG_ARRAYS
-      SizeVec3Type inputVoxelIndices;
-      err = inputImageGeom->computeCellIndex(outCoord.data(), inputVoxelIndices.data());
-      inputVoxIndexXYZ->setTuple(tupleIndex, inputVoxelIndices.data());
-#endif
-      err = inputImageGeom->computeCellIndex(outCoord.data(), inputVoxelIndex);
+      if(m_Grid.interpolation == GenerateTiltSeries::k_NearestNeighbor)
+      {
+        size_t inputVoxelIndex = 0;
+        if(m_Grid.inputGrid.cellIndex(outCoord.data(), inputVoxelIndex))
+        {
+          std::copy_n(m_InputData + inputVoxelIndex * m_NumComps, m_NumComps, dest);
+        }
+        continue;
+      }
 
-#if GTS_GENERATE_DEBUG_ARRAYS
-      // This line is OK to have before the error condition is checked because we are writing the value not
-      // using it to step into an array. This also allows us to debug the data coming out of this
-      // algorithm
-      inputVoxIndex->setTuple(tupleIndex, &inputVoxelIndex);
-#endif
-      if(err != ImageGeom::ErrorType::NoError)
+      if(!m_Grid.inputGrid.trilinearStencil(outCoord.data(), indices, weights))
       {
         continue;
       }
-      outputData->copyFromArray(outputVoxelIndex, inputData, inputVoxelIndex, 1);
-#if GTS_GENERATE_DEBUG_ARRAYS
-      // Write the selected cell value array from the input data onto the Vertex Cell Array
-      // This allows us to visualize the data more easily in ParaView
-      vertexOutputData->copyFromArray(tupleIndex, inputData, inputVoxelIndex, 1);
-#endif
+      for(size_t comp = 0; comp < m_NumComps; comp++)
+      {
+        double value = 0.0;
+        for(size_t corner = 0; corner < 8; corner++)
+        {
+          value += weights[corner] * static_cast<double>(m_InputData[indices[corner] * m_NumComps + comp]);
+        }
+        dest[comp] = convertInterpolatedValue<T>(value);
+      }
     }
-
-#if GTS_GENERATE_DEBUG_ARRAYS
-    // Write out the sampling grid
-    QString dcName = QString("%1 Vertex Grid %2").arg(m_Filter->getOutputPrefix()).arg(m_GridIndex);
-    DataContainer::Pointer gridGeomDC = DataContainer::New(dcName);
-    VertexGeom::Pointer gridVertGeom = VertexGeom::CreateGeometry(copyOfGrid->getNumberOfTuples(), "Grid Geometry", true);
-    gridVertGeom->setVertices(copyOfGrid);
-    gridGeomDC->setGeometry(gridVertGeom);
-    dca->insertOrAssign(gridGeomDC);
-    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New({copyOfGrid->getNumberOfTuples()}, Detail::k_AttributeMatrixName, AttributeMatrix::Type::Vertex);
-    gridGeomDC->insertOrAssign(cellAttrMat);
-    cellAttrMat->insertOrAssign(vertexOutputData);
-#endif
   }
 
-  template <typename T, typename K>
-  K transformCoordinate(const T& orientationMatrix, const K& coord) const
-  {
-    K outCoord = {0, 0, 0};
-
-    outCoord[0] = orientationMatrix[0] * coord[0] + orientationMatrix[1] * coord[1] + orientationMatrix[2] * coord[2];
-    outCoord[1] = orientationMatrix[3] * coord[0] + orientationMatrix[4] * coord[1] + orientationMatrix[5] * coord[2];
-    outCoord[2] = orientationMatrix[6] * coord[0] + orientationMatrix[7] * coord[1] + orientationMatrix[8] * coord[2];
-
-    return outCoord;
-  }
+private:
+  const RotatedGrid& m_Grid;
+  const T* m_InputData = nullptr;
+  T* m_OutputData = nullptr;
+  size_t m_NumComps = 1;
+};
 
-  template <typename InputType, typename OutputType>
-  OutputType ax2om(const InputType& a) const
+/**
+ * @brief The ProjectGridImpl class integrates the input values along the rotated slice
+ * normal through every grid point, producing one projection image of the tilt series
+ * without resampling the volume.
+ */
+template <typename T>
+class ProjectGridImpl
+{
+public:
+  ProjectGridImpl(const RotatedGrid& grid, const FloatVec3Type& rayDirection, const T* inputData, float* outputData, size_t numComps)
+  : m_Grid(grid)
+  , m_RayDirection(rayDirection)
+  , m_InputData(inputData)
+  , m_OutputData(outputData)
+  , m_NumComps(numComps)
   {
-    OutputType res(9);
-    typename OutputType::value_type q = 0.0L;
-    typename OutputType::value_type c = 0.0L;
-    typename OutputType::value_type s = 0.0L;
-    typename OutputType::value_type omc = 0.0L;
-
-    c = cos(a[3]);
-    s = sin(a[3]);
+    // Sample at the finest input spacing along a ray that is long enough to cross the whole volume
+    m_StepSize = m_Grid.inputGrid.minSpacing();
+    float rayLength = m_Grid.inputGrid.diagonalLength() + 2.0f * m_Grid.inputGrid.maxSpacing();
+    m_NumSteps = static_cast<size_t>(std::ceil(rayLength / m_StepSize));
+    m_RayStart = -0.5f * static_cast<float>(m_NumSteps) * m_StepSize;
+  }
+  ~ProjectGridImpl() = default;
 
-    omc = 1.0f - c;
+  ProjectGridImpl(const ProjectGridImpl&) = default;
+  ProjectGridImpl(ProjectGridImpl&&) noexcept = default;
+  ProjectGridImpl& operator=(const ProjectGridImpl&) = delete; // Copy Assignment Not Implemented
+  ProjectGridImpl& operator=(ProjectGridImpl&&) = delete;      // Move Assignment Not Implemented
 
-    res[0] = a[0] * a[0] * omc + c;
-    res[4] = a[1] * a[1] * omc + c;
-    res[8] = a[2] * a[2] * omc + c;
-    size_t _01 = 1;
-    size_t _10 = 3;
-    size_t _12 = 5;
-    size_t _21 = 7;
-    size_t _02 = 2;
-    size_t _20 = 6;
-    // Check to see if we need to transpose
-    if(Rotations::Constants::epsijk == 1.0f)
+  void operator()(const SIMPLRange& range) const
+  {
+    std::array<size_t, 8> indices = {};
+    std::array<float, 8> weights = {};
+    for(size_t tupleIndex = range.min(); tupleIndex < range.max(); tupleIndex++)
     {
-      _01 = 3;
-      _10 = 1;
-      _12 = 7;
-      _21 = 5;
-      _02 = 6;
-      _20 = 2;
-    }
+      const float* gridCoord = m_Grid.gridCoords + tupleIndex * 3;
 
-    q = omc * a[0] * a[1];
-    res[_01] = q + s * a[2];
-    res[_10] = q - s * a[2];
-    q = omc * a[1] * a[2];
-    res[_12] = q + s * a[0];
-    res[_21] = q - s * a[0];
-    q = omc * a[2] * a[0];
-    res[_02] = q - s * a[1];
-    res[_20] = q + s * a[1];
+      size_t outputVoxelIndex = 0;
+      if(!m_Grid.outputGrid.cellIndex(gridCoord, outputVoxelIndex))
+      {
+        continue;
+      }
+      FloatVec3Type rayOrigin = m_Grid.rotatePoint(gridCoord);
+      float* dest = m_OutputData + outputVoxelIndex * m_NumComps;
 
-    return res;
+      for(size_t step = 0; step < m_NumSteps; step++)
+      {
+        float t = m_RayStart + (static_cast<float>(step) + 0.5f) * m_StepSize;
+        FloatVec3Type sample(rayOrigin[0] + t * m_RayDirection[0], rayOrigin[1] + t * m_RayDirection[1], rayOrigin[2] + t * m_RayDirection[2]);
+
+        if(m_Grid.interpolation == GenerateTiltSeries::k_NearestNeighbor)
+        {
+          size_t inputVoxelIndex = 0;
+          if(!m_Grid.inputGrid.cellIndex(sample.data(), inputVoxelIndex))
+          {
+            continue;
+          }
+          for(size_t comp = 0; comp < m_NumComps; comp++)
+          {
+            dest[comp] += static_cast<float>(m_InputData[inputVoxelIndex * m_NumComps + comp]) * m_StepSize;
+          }
+          continue;
+        }
+
+        if(!m_Grid.inputGrid.trilinearStencil(sample.data(), indices, weights))
+        {
+          continue;
+        }
+        for(size_t comp = 0; comp < m_NumComps; comp++)
+        {
+          float value = 0.0f;
+          for(size_t corner = 0; corner < 8; corner++)
+          {
+            value += weights[corner] * static_cast<float>(m_InputData[indices[corner] * m_NumComps + comp]);
+          }
+          dest[comp] += value * m_StepSize;
+        }
+      }
+    }
   }
 
 private:
-  GenerateTiltSeries* m_Filter = nullptr;
-  FloatArrayType::Pointer m_Coords;
-  DataContainer::Pointer m_OutputDC;
-  std::array<float, 4> m_RotationAxis;
-#if GTS_GENERATE_DEBUG_ARRAYS
-  size_t m_GridIndex = 0;
-#endif
+  const RotatedGrid& m_Grid;
+  FloatVec3Type m_RayDirection;
+  const T* m_InputData = nullptr;
+  float* m_OutputData = nullptr;
+  size_t m_NumComps = 1;
+  float m_StepSize = 1.0f;
+  size_t m_NumSteps = 0;
+  float m_RayStart = 0.0f;
 };
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void resampleTilt(const RotatedGrid& grid, const FloatVec3Type& rayDirection, size_t numGridPoints, const IDataArray::Pointer& inputArray, const IDataArray::Pointer& outputArray, int32_t outputType)
+{
+  const DataArray<T>& inputData = dynamic_cast<const DataArray<T>&>(*inputArray);
+  size_t numComps = inputData.getNumberOfComponents();
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numGridPoints);
+  if(outputType == GenerateTiltSeries::k_LineIntegralProjection)
+  {
+    FloatArrayType& outputData = dynamic_cast<FloatArrayType&>(*outputArray);
+    dataAlg.execute(ProjectGridImpl<T>(grid, rayDirection, inputData.getConstPointer(0), outputData.getPointer(0), numComps));
+  }
+  else
+  {
+    DataArray<T>& outputData = dynamic_cast<DataArray<T>&>(*outputArray);
+    dataAlg.execute(ResampleGridImpl<T>(grid, inputData.getConstPointer(0), outputData.getPointer(0), numComps));
+  }
+}
+
 } // namespace Detail
 
 // -----------------------------------------------------------------------------
@@ -357,6 +555,34 @@ void GenerateTiltSeries::setupFilterParameters()
   }
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Rotation Limits (Start, Stop, Increment) Degrees", RotationLimits, FilterParameter::Category::Parameter, GenerateTiltSeries));
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Resample Spacing", Spacing, FilterParameter::Category::Parameter, GenerateTiltSeries));
+  {
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Interpolation");
+    parameter->setPropertyName("InterpolationType");
+
+    std::vector<QString> choices;
+    choices.push_back("Nearest Neighbor");
+    choices.push_back("Trilinear");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(GenerateTiltSeries, this, InterpolationType));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(GenerateTiltSeries, this, InterpolationType));
+    parameters.push_back(parameter);
+  }
+  {
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Output Type");
+    parameter->setPropertyName("OutputType");
+
+    std::vector<QString> choices;
+    choices.push_back("Resampled Slice");
+    choices.push_back("Line Integral Projection");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(GenerateTiltSeries, this, OutputType));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(GenerateTiltSeries, this, OutputType));
+    parameters.push_back(parameter);
+  }
   //  DataArrayCreationFilterParameter::RequirementType dacReq;
   //  parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Created Array Path", CreatedArrayPath, FilterParameter::Category::Parameter, GenerateTiltSeries, dacReq));
   DataArraySelectionFilterParameter::RequirementType dasReq;
@@ -385,6 +611,19 @@ void GenerateTiltSeries::dataCheck()
     return;
   }
 
+  if(getInterpolationType() != k_NearestNeighbor && getInterpolationType() != k_Trilinear)
+  {
+    QString ss = QObject::tr("The Interpolation Type must be 0 (Nearest Neighbor) or 1 (Trilinear)");
+    setErrorCondition(-3010, ss);
+    return;
+  }
+  if(getOutputType() != k_ResampledSlice && getOutputType() != k_LineIntegralProjection)
+  {
+    QString ss = QObject::tr("The Output Type must be 0 (Resampled Slice) or 1 (Line Integral Projection)");
+    setErrorCondition(-3011, ss);
+    return;
+  }
+
   // Generate Data Structure
   std::pair<FloatArrayType::Pointer, ImageGeom::Pointer> gridPair;
   if(getRotationAxis() == k_XAxis)
@@ -419,8 +658,16 @@ void GenerateTiltSeries::dataCheck()
     AttributeMatrix::Pointer cellAttr = AttributeMatrix::New({gridDims[0], gridDims[1], gridDims[2]}, Detail::k_AttributeMatrixName, AttributeMatrix::Type::Cell);
     gridDC->insertOrAssign(cellAttr);
 
-    IDataArray::Pointer outputData =
-        inputData->createNewArray(gridDims[0] * gridDims[1] * gridDims[2], inputData->getComponentDimensions(), getInputDataArrayPath().getDataArrayName(), !getInPreflight());
+    // Projections accumulate path lengths so they are always stored as floats
+    IDataArray::Pointer outputData;
+    if(getOutputType() == k_LineIntegralProjection)
+    {
+      outputData = FloatArrayType::CreateArray(gridDims[0] * gridDims[1] * gridDims[2], inputData->getComponentDimensions(), getInputDataArrayPath().getDataArrayName(), !getInPreflight());
+    }
+    else
+    {
+      outputData = inputData->createNewArray(gridDims[0] * gridDims[1] * gridDims[2], inputData->getComponentDimensions(), getInputDataArrayPath().getDataArrayName(), !getInPreflight());
+    }
     cellAttr->insertOrAssign(outputData);
     getDataContainerArray()->insertOrAssign(gridDC);
 
@@ -461,20 +708,29 @@ void GenerateTiltSeries::execute()
   }
   FloatArrayType::Pointer gridCoords = gridPair.first;
   ImageGeom::Pointer gridGeometry = gridPair.second;
+  if(nullptr == gridCoords)
+  {
+    return;
+  }
   DataContainerArray::Pointer dca = getDataContainerArray();
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-  // C++11 RIGHT HERE....
-  int32_t nthreads = static_cast<int32_t>(std::thread::hardware_concurrency()); // Returns ZERO if not defined on this platform
-  int32_t threadCount = 0;
-#endif
+  IDataArray::Pointer inputData = dca->getPrereqIDataArrayFromPath(this, getInputDataArrayPath());
+  ImageGeom::Pointer inputImageGeom = dca->getDataContainer(getInputDataArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>();
   int32_t rotAxisSelection = getRotationAxis();
 
-  // Now Start Rotating the grid around the axis
+  // The slice is a single cell thick along this axis, which is also the direction the projection is integrated along
+  FloatVec3Type sliceNormal(0.0f, 0.0f, 0.0f);
+  sliceNormal[(rotAxisSelection + 2) % 3] = 1.0f;
+
+  // Now Start Rotating the grid around the axis. The angles are processed one at a time and the
+  // points of each slice are spread over all available cores.
   size_t gridIndex = 0;
   for(float currentDeg = m_RotationLimits[0]; currentDeg < m_RotationLimits[1]; currentDeg += m_RotationLimits[2])
   {
+    if(getCancel())
+    {
+      return;
+    }
     QString msg;
     QTextStream out(&msg);
     out << "Generating Tilt " << currentDeg << " (Deg)";
@@ -482,7 +738,7 @@ void GenerateTiltSeries::execute()
     QString gridDCName = m_OutputPrefix + QString::number(gridIndex);
     DataContainer::Pointer gridDC = dca->getDataContainer(gridDCName);
 
-    std::array<float, 4> rotationAxis = {0.0f, 0.0f, 0.0f, 0.0f};
+    Detail::AxisAngleType rotationAxis = {0.0f, 0.0f, 0.0f, 0.0f};
     float radians = currentDeg * SIMPLib::Constants::k_PiOver180D;
     if(k_XAxis == rotAxisSelection)
     {
@@ -497,38 +753,24 @@ void GenerateTiltSeries::execute()
       rotationAxis = {0.0f, 0.0f, 1.0f, radians};
     }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    g->run(Detail::ResampleGrid(this, gridCoords, gridDC, rotationAxis
-#if GTS_GENERATE_DEBUG_ARRAYS
-                                ,
-                                gridIndex
-#endif
-                                ));
-    threadCount++;
-    if(threadCount == nthreads)
-    {
-      g->wait();
-      threadCount = 0;
-    }
-#else
-    //    std::cout << "Resample Deg = " << currentDeg << std::endl;
-    Detail::ResampleGrid impl(this, gridCoords, gridDC, rotationAxis
-#if GTS_GENERATE_DEBUG_ARRAYS
-                              ,
-                              gridIndex
-#endif
-    );
-    impl();
-#endif
+    ImageGeom::Pointer outputImageGeom = gridDC->getGeometryAs<ImageGeom>();
+    FloatVec6Type bounds = outputImageGeom->getBoundingBox();
+    FloatVec3Type center = {(bounds[1] - bounds[0]) / 2.0f + bounds[0], (bounds[3] - bounds[2]) / 2.0f + bounds[2], (bounds[5] - bounds[4]) / 2.0f + bounds[4]};
+
+    AttributeMatrix::Pointer attrMat = gridDC->getAttributeMatrix(Detail::k_AttributeMatrixName);
+    IDataArray::Pointer outputData = attrMat->getAttributeArray(getInputDataArrayPath().getDataArrayName());
+    outputData->initializeWithZeros();
+
+    // Generate the Rotation Matrix
+    Detail::OrientationMatrixType om = Detail::ax2om<Detail::AxisAngleType, Detail::OrientationMatrixType>(rotationAxis);
+    FloatVec3Type rayDirection = Detail::transformCoordinate<Detail::OrientationMatrixType, FloatVec3Type>(om, sliceNormal);
+
+    Detail::RotatedGrid grid(gridCoords->getConstPointer(0), *inputImageGeom, *outputImageGeom, om, center, getInterpolationType());
+    EXECUTE_FUNCTION_TEMPLATE(this, Detail::resampleTilt, inputData, grid, rayDirection, gridCoords->getNumberOfTuples(), inputData, outputData, getOutputType())
 
     gridIndex++;
   }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  // This will spill over if the number of files to process does not divide evenly by the number of threads.
-  g->wait();
-#endif
-
 #if GTS_GENERATE_DEBUG_ARRAYS
   // Write out the sampling grid
   {
@@ -1000,3 +1242,27 @@ QString GenerateTiltSeries::getOutputPrefix() const
 {
   return m_OutputPrefix;
 }
+
+// -----------------------------------------------------------------------------
+void GenerateTiltSeries::setInterpolationType(int value)
+{
+  m_InterpolationType = value;
+}
+
+// -----------------------------------------------------------------------------
+int GenerateTiltSeries::getInterpolationType() const
+{
+  return m_InterpolationType;
+}
+
+// -----------------------------------------------------------------------------
+void GenerateTiltSeries::setOutputType(int value)
+{
+  m_OutputType = value;
+}
+
+// -----------------------------------------------------------------------------
+int GenerateTiltSeries::getOutputType() const
+{
+  return m_OutputType;
+}
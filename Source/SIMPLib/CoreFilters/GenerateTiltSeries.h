@@ -58,6 +58,8 @@ class SIMPLib_EXPORT GenerateTiltSeries : public AbstractFilter
   PYB11_PROPERTY(float Spacing READ getSpacing WRITE setSpacing)
   PYB11_PROPERTY(DataArrayPath InputDataArrayPath READ getInputDataArrayPath WRITE setInputDataArrayPath)
   PYB11_PROPERTY(QString OutputPrefix READ getOutputPrefix WRITE setOutputPrefix)
+  PYB11_PROPERTY(int InterpolationType READ getInterpolationType WRITE setInterpolationType)
+  PYB11_PROPERTY(int OutputType READ getOutputType WRITE setOutputType)
   PYB11_END_BINDINGS()
   // clang-format on
   // End Python bindings declarations
@@ -88,6 +90,12 @@ public:
   static constexpr int32_t k_YAxis = 1;
   static constexpr int32_t k_ZAxis = 2;
 
+  static constexpr int32_t k_NearestNeighbor = 0;
+  static constexpr int32_t k_Trilinear = 1;
+
+  static constexpr int32_t k_ResampledSlice = 0;
+  static constexpr int32_t k_LineIntegralProjection = 1;
+
   /**
    * @brief Setter property for RotationAxis
    */
@@ -148,6 +156,30 @@ public:
 
   Q_PROPERTY(QString OutputPrefix READ getOutputPrefix WRITE setOutputPrefix)
 
+  /**
+   * @brief Setter property for InterpolationType
+   */
+  void setInterpolationType(int value);
+  /**
+   * @brief Getter property for InterpolationType
+   * @return Value of InterpolationType
+   */
+  int getInterpolationType() const;
+
+  Q_PROPERTY(int InterpolationType READ getInterpolationType WRITE setInterpolationType)
+
+  /**
+   * @brief Setter property for OutputType
+   */
+  void setOutputType(int value);
+  /**
+   * @brief Getter property for OutputType
+   * @return Value of OutputType
+   */
+  int getOutputType() const;
+
+  Q_PROPERTY(int OutputType READ getOutputType WRITE setOutputType)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -226,6 +258,8 @@ private:
   FloatVec3Type m_Spacing = FloatVec3Type(1.0, 1.0, 1.0);
   DataArrayPath m_InputDataArrayPath = DataArrayPath("DataContainer", "AttributeMatrix", "FeatureIds");
   QString m_OutputPrefix = {"Rotation_"};
+  int m_InterpolationType = k_NearestNeighbor;
+  int m_OutputType = k_ResampledSlice;
 
   static constexpr unsigned Dimension = 3;
 
@@ -48,6 +48,7 @@
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/SIMPLH5Mutex.h"
 
 namespace Detail
 {
@@ -164,6 +165,7 @@ void ImportHDF5Dataset::dataCheck()
     return;
   }
 
+  SIMPLH5Mutex::LockType h5Lock = SIMPLH5Mutex::Lock();
   hid_t fileId = H5Utilities::openFile(m_HDF5FilePath.toStdString(), true);
   if(fileId < 0)
   {
@@ -44,7 +44,7 @@
 #include "SIMPLib/FilterParameters/ComparisonSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdEngine.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -191,55 +191,32 @@ void MultiThresholdObjects::execute()
   DataContainerArray::Pointer dca = getDataContainerArray();
   DataContainer::Pointer m = dca->getDataContainer(dcName);
 
-  // Prime our output array with the result of the first comparison
-  {
-    ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(comp_0.compOperator), comp_0.compValue, m_DestinationPtr.lock().get());
-    // Run the first threshold and store the results in our output array
-    int32_t err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comp_0.attributeArrayName), m_DestinationPtr.lock().get());
-    if(err < 0)
-    {
-      DataArrayPath tempPath(comp_0.dataContainerName, comp_0.attributeMatrixName, comp_0.attributeArrayName);
-      QString ss = QObject::tr("Error Executing threshold filter on first array. The path is %1").arg(tempPath.serialize());
-      setErrorCondition(-13001, ss);
-      return;
-    }
-  }
+  AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(amName);
 
-  if(m_SelectedThresholds.size() > 1)
+  // All comparisons are combined with And and evaluated together in a single pass over the arrays
+  ThresholdEngine engine(attrMat->getNumberOfTuples());
+  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
   {
-    // Get the total number of tuples, create and initialize an array to use for these results
-    int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-    BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-    // Loop on the remaining Comparison objects updating our final result array as we go
-    for(int32_t i = 1; i < m_SelectedThresholds.size(); ++i)
+    ComparisonInput_t& compRef = m_SelectedThresholds[i];
+    if(!engine.addComparison(SIMPL::Union::Operator_And, attrMat->getAttributeArray(compRef.attributeArrayName), static_cast<SIMPL::Comparison::Enumeration>(compRef.compOperator),
+                             compRef.compValue))
     {
-      // Initialize the array to false
-      currentArrayPtr->initializeWithZeros();
-      // Get the pointer to the front of the array. Raw Pointers = fast access = NO Bounds Checking!!!
-      bool* currentArray = currentArrayPtr->getPointer(0);
-
-      ComparisonInput_t& compRef = m_SelectedThresholds[i];
-
-      ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compRef.compOperator), compRef.compValue, currentArrayPtr.get());
-
-      int32_t err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(compRef.attributeArrayName), currentArrayPtr.get());
-      if(err < 0)
+      DataArrayPath tempPath(compRef.dataContainerName, compRef.attributeMatrixName, compRef.attributeArrayName);
+      if(i == 0)
       {
-        DataArrayPath tempPath(compRef.dataContainerName, compRef.attributeMatrixName, compRef.attributeArrayName);
-        QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-        setErrorCondition(-13002, ss);
-        return;
+        QString ss = QObject::tr("Error Executing threshold filter on first array. The path is %1").arg(tempPath.serialize());
+        setErrorCondition(-13001, ss);
       }
-      for(int64_t p = 0; p < totalTuples; ++p)
+      else
       {
-        if(!m_Destination[p] || !currentArray[p])
-        {
-          m_Destination[p] = false;
-        }
+        QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+        setErrorCondition(-13002, ss);
       }
+      return;
     }
   }
+
+  engine.execute(m_Destination);
 }
 
 // -----------------------------------------------------------------------------
@@ -45,7 +45,7 @@
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdEngine.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -198,221 +198,54 @@ void MultiThresholdObjects2::execute()
     return;
   }
 
-  bool invert = m_SelectedThresholds.shouldInvert();
+  AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(amName);
 
-  int64_t thresholdSize;
-  BoolArrayType::Pointer thresholdArray;
-
-  createBoolArray(thresholdSize, thresholdArray);
-  bool firstValueFound = false;
-
-  int32_t err = 0;
-
-  // Loop on the remaining Comparison objects updating our final result array as we go
-  for(int32_t i = 0; i < m_SelectedThresholds.size() && err >= 0; ++i)
+  // The whole comparison tree is evaluated in a single pass over the arrays
+  ThresholdEngine engine(attrMat->getNumberOfTuples());
+  engine.setInvertResult(m_SelectedThresholds.shouldInvert());
+  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
   {
-    if(std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]))
+    if(!addComparison(m_SelectedThresholds[i], attrMat, engine))
     {
-      ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]);
-      thresholdSet(comparisonSet, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]))
-    {
-      ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]);
-      thresholdValue(comparisonValue, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-  }
-
-  if(invert)
-  {
-    invertThreshold(thresholdSize, thresholdArray);
-  }
-
-  bool* threshold = thresholdArray->getPointer(0);
-  for(int64_t p = 0; p < thresholdSize; p++)
-  {
-    m_Destination[p] = threshold[p];
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
-{
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
-{
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
-  {
-    // invert the current comparison if necessary
-    if(inverse)
-    {
-      newArray[i] = !newArray[i];
-    }
-
-    if(SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if(!currentArray[i] || !newArray[i])
-    {
-      currentArray[i] = false;
+      return;
     }
   }
-}
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
-{
-  bool* threshold = thresholdArray->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
-  {
-    threshold[i] = !threshold[i];
-  }
+  engine.execute(m_Destination);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t& err, bool replaceInput, bool inverse)
+bool MultiThresholdObjects2::addComparison(const AbstractComparison::Pointer& comparison, const AttributeMatrix::Pointer& attrMat, ThresholdEngine& engine)
 {
-  if(nullptr == comparisonSet)
-  {
-    return;
-  }
-
-  if(inverse)
-  {
-    inverse = !comparisonSet->getInvertComparison();
-  }
-  else
-  {
-    inverse = comparisonSet->getInvertComparison();
-  }
-
-  int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
-
-  createBoolArray(setArraySize, setThresholdArray);
-  bool firstValueFound = false;
-
-  QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
-  for(int i = 0; i < comparisons.size(); i++)
+  if(std::dynamic_pointer_cast<ComparisonSet>(comparison))
   {
-    // Check all contents of child Comparison Sets
-    if(std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i)))
-    {
-      ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i));
-      thresholdSet(childSet, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    // Check Comparison Values
-    if(std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i)))
-    {
-      ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i));
-      thresholdValue(childValue, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-
-    if(err < 0)
+    ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison);
+    engine.beginSet(comparisonSet->getUnionOperator(), comparisonSet->getInvertComparison());
+    QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
+    for(const auto& childComparison : comparisons)
     {
-      return;
+      if(!addComparison(childComparison, attrMat, engine))
+      {
+        return false;
+      }
     }
+    engine.endSet();
   }
-
-  if(replaceInput)
+  else if(std::dynamic_pointer_cast<ComparisonValue>(comparison))
   {
-    if(inverse)
+    ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison);
+    IDataArray::Pointer inputData = attrMat->getAttributeArray(comparisonValue->getAttributeArrayName());
+    if(!engine.addComparison(comparisonValue->getUnionOperator(), inputData, static_cast<SIMPL::Comparison::Enumeration>(comparisonValue->getCompOperator()), comparisonValue->getCompValue()))
     {
-      invertThreshold(setArraySize, setThresholdArray);
+      DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
+      QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+      setErrorCondition(-13002, ss);
+      return false;
     }
-    currentThreshold.swap(setThresholdArray);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(setArraySize, currentThreshold, comparisonSet->getUnionOperator(), setThresholdArray, inverse);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput, bool inverse)
-{
-  if(nullptr == comparisonValue)
-  {
-    return;
-  }
-
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
-
-  // bool* currentArray = currentArrayPtr->getPointer(0);
-  int compOperator = comparisonValue->getCompOperator();
-  double compValue = comparisonValue->getCompValue();
-
-  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, currentArrayPtr.get());
-
-  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()), currentArrayPtr.get());
-  if(err < 0)
-  {
-    DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
-    QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-    setErrorCondition(-13002, ss);
-    return;
-  }
-
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      invertThreshold(totalTuples, currentArrayPtr);
-    }
-    inputThreshold.swap(currentArrayPtr);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(totalTuples, inputThreshold, comparisonValue->getUnionOperator(), currentArrayPtr, inverse);
   }
+  return true;
 }
 
 // -----------------------------------------------------------------------------
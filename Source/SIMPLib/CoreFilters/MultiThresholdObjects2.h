@@ -44,6 +44,10 @@
 #include "SIMPLib/Filtering/ComparisonSet.h"
 #include "SIMPLib/Filtering/ComparisonValue.h"
 
+class AttributeMatrix;
+using AttributeMatrixShPtrType = std::shared_ptr<AttributeMatrix>;
+class ThresholdEngine;
+
 /**
  * @brief The MultiThresholdObjects2 class. See [Filter documentation](@ref multithresholdobjects2) for details.
  */
@@ -179,46 +183,13 @@ protected:
   void initialize();
 
   /**
-   * @brief Creates and returns a DataArray<bool> for the given AttributeMatrix and the number of tuples
-   */
-  void createBoolArray(int64_t& numItems, BoolArrayType::Pointer& thresholdArrayPtr);
-
-  /**
-   * @brief Merges two DataArray<bool>s of a given size using a union operator AND / OR and inverts the second DataArray if requested
-   * @param numItems Number of values in both DataArrays
-   * @param currentArray DataArray<bool> to merge values into
-   * @param unionOperator Union operator used to merge into currentArray
-   * @param newArray DataArray<bool> of values to merge into the currentArray
-   * @param inverse Should newArray have its boolean values flipped before being merged in
-   */
-  void insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArray, int unionOperator, const BoolArrayType::Pointer newArray, bool inverse);
-
-  /**
-   * @brief Flips the boolean values for a DataArray<bool>
-   * @param numItems Number of tuples in the DataArray
-   * @param thresholdArray DataArray to invert
-   */
-  void invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray);
-
-  /**
-   * @brief Performs a check on a ComparisonSet and either merges the result into the DataArray passed in or replaces the DataArray
-   * @param comparisonSet The set of comparisons used for setting the threshold
-   * @param inputThreshold DataArray<bool> merged into or replaced after finding the ComparisonSet's threshould output
-   * @param err Return any error code given
-   * @param replaceInput Specifies whether or not the result gets merged into inputThreshold or replaces it
-   * @param inverse Specifies whether or not the results need to be flipped before merging or replacing inputThreshold
-   */
-  void thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput = false, bool inverse = false);
-
-  /**
-   * @brief Performs a check on a single ComparisonValue and either merges the result into the DataArray passed in or replaces the DataArray
-   * @param comparisonValue The comparison operator and value used for caluculating the threshold
-   * @param inputThreshold DataArray<bool> merged into or replaced after finding the ComparisonSet's threshould output
-   * @param err Return any error code given
-   * @param replaceInput Specifies whether or not the result gets merged into inputThreshold or replaces it
-   * @param inverse Specifies whether or not the results need to be flipped before merging or replacing inputThreshold
+   * @brief Adds a ComparisonValue or, recursively, the contents of a ComparisonSet to the ThresholdEngine
+   * @param comparison The comparison to add
+   * @param attrMat AttributeMatrix holding the compared arrays
+   * @param engine ThresholdEngine that evaluates all comparisons in a single pass
+   * @return false if a compared array could not be used. The error condition is set.
    */
-  void thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput = false, bool inverse = false);
+  bool addComparison(const AbstractComparison::Pointer& comparison, const AttributeMatrixShPtrType& attrMat, ThresholdEngine& engine);
 
 private:
   std::weak_ptr<DataArray<bool>> m_DestinationPtr;
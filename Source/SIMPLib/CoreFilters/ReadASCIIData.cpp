@@ -14,8 +14,8 @@
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
 #include "SIMPLib/Utilities/SIMPLDataPathValidator.h"
-#include "SIMPLib/Utilities/StringOperations.h"
 
+#include "SIMPLib/CoreFilters/util/ASCIIDataStreamParser.h"
 #include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -433,7 +433,6 @@ void ReadASCIIData::execute()
   QStringList headers = wizardData.dataHeaders;
   QStringList dataTypes = wizardData.dataTypes;
   QList<char> delimiters = wizardData.delimiters;
-  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
   int numLines = wizardData.numberOfLines;
   int beginIndex = wizardData.beginIndex;
 
@@ -511,74 +510,25 @@ void ReadASCIIData::execute()
     }
   }
 
-  int insertIndex = 0;
+  // Empty tokens are always dropped, so the consecutive delimiters setting does not change how the lines are split
+  ASCIIDataStreamParser streamParser(dataParsers, dataTypes.size(), delimiters);
+  ASCIIDataStreamParser::ParseError parseError = streamParser.parse(inputFilePath, beginIndex, numLines, this);
 
-  QFile inputFile(inputFilePath);
-  if(inputFile.open(QIODevice::ReadOnly))
+  if(parseError.type == ASCIIDataStreamParser::ErrorType::InconsistentColumns)
   {
-    QTextStream in(&inputFile);
-
-    for(int i = 1; i < beginIndex; i++)
-    {
-      // Skip to the first data line
-      in.readLine();
-    }
-
-    float threshold = 0.0f;
-    size_t numTuples = numLines - beginIndex + 1;
-
-    for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
-    {
-      QString line = in.readLine();
-      QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
-
-      if(dataTypes.size() != tokens.size())
-      {
-        QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
-        QTextStream out(&ss);
-        out << "Expecting " << dataTypes.size() << " but found " << tokens.size() << "\n";
-        out << "Input line was:\n";
-        out << line;
-        setErrorCondition(INCONSISTENT_COLS, ss);
-        return;
-      }
-
-      for(int i = 0; i < dataParsers.size(); i++)
-      {
-        AbstractDataParser::Pointer parser = dataParsers[i];
-        int index = parser->getColumnIndex();
-
-        ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
-        if(!obj.ok)
-        {
-          QString errorMessage = obj.errorMessage;
-          QString ss = errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
-          setErrorCondition(CONVERSION_FAILURE, ss);
-          return;
-        }
-      }
-
-      const float percentCompleted = (static_cast<float>(lineNum) / numTuples) * 100.0f;
-      if(percentCompleted > threshold)
-      {
-        // Print the status of the import
-        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg(static_cast<double>(percentCompleted), 0, 'f', 0);
-        notifyStatusMessage(ss);
-        threshold = threshold + 5.0f;
-        if(threshold < percentCompleted)
-        {
-          threshold = percentCompleted;
-        }
-      }
-
-      if(getCancel())
-      {
-        return;
-      }
-
-      insertIndex++;
-    }
-    inputFile.close();
+    QString ss = "Line " + QString::number(parseError.lineNumber) + " has an inconsistent number of columns.\n";
+    QTextStream out(&ss);
+    out << "Expecting " << dataTypes.size() << " but found " << parseError.tokenCount << "\n";
+    out << "Input line was:\n";
+    out << parseError.line;
+    setErrorCondition(INCONSISTENT_COLS, ss);
+    return;
+  }
+  if(parseError.type == ASCIIDataStreamParser::ErrorType::ConversionFailure)
+  {
+    QString ss = parseError.message + "(line " + QString::number(parseError.lineNumber) + ", column " + QString::number(parseError.columnIndex) + ").";
+    setErrorCondition(CONVERSION_FAILURE, ss);
+    return;
   }
 }
 
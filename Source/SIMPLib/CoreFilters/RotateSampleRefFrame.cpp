@@ -37,6 +37,7 @@
 #include "RotateSampleRefFrame.h"
 
 #include <cmath>
+#include <vector>
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range3d.h>
@@ -231,14 +232,14 @@ void updateGeometry(ImageGeom& imageGeom, const RotateArgs& params)
  */
 class SampleRefFrameRotator
 {
-  DataArray<int64_t>::Pointer m_NewIndicesPtr;
+  int64_t* m_NewIndices = nullptr;
   float m_RotMatrixInv[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
   bool m_SliceBySlice = false;
   RotateArgs m_Params;
 
 public:
-  SampleRefFrameRotator(DataArray<int64_t>::Pointer newindices, const RotateArgs& args, const Matrix3fR& rotationMatrix, bool sliceBySlice)
-  : m_NewIndicesPtr(newindices)
+  SampleRefFrameRotator(int64_t* newindices, const RotateArgs& args, const Matrix3fR& rotationMatrix, bool sliceBySlice)
+  : m_NewIndices(newindices)
   , m_SliceBySlice(sliceBySlice)
   , m_Params(args)
   {
@@ -253,7 +254,7 @@ public:
 
   void convert(int64_t zStart, int64_t zEnd, int64_t yStart, int64_t yEnd, int64_t xStart, int64_t xEnd) const
   {
-    int64_t* newindicies = m_NewIndicesPtr->getPointer(0);
+    int64_t* newindicies = m_NewIndices;
 
     for(int64_t k = zStart; k < zEnd; k++)
     {
@@ -553,58 +554,28 @@ void RotateSampleRefFrame::execute()
 
   int64_t newNumCellTuples = p_Impl->m_Params.xpNew * p_Impl->m_Params.ypNew * p_Impl->m_Params.zpNew;
 
-  DataArray<int64_t>::Pointer newIndiciesPtr = DataArray<int64_t>::CreateArray(newNumCellTuples, std::string("_INTERNAL_USE_ONLY_RotateSampleRef_NewIndicies"), true);
-  newIndiciesPtr->initializeWithValue(-1);
-  int64_t* newindicies = newIndiciesPtr->getPointer(0);
+  std::vector<int64_t> newIndicies(static_cast<size_t>(newNumCellTuples), -1);
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::parallel_for(tbb::blocked_range3d<int64_t, int64_t, int64_t>(0, p_Impl->m_Params.zpNew, 0, p_Impl->m_Params.ypNew, 0, p_Impl->m_Params.xpNew),
-                    SampleRefFrameRotator(newIndiciesPtr, p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice), tbb::auto_partitioner());
+                    SampleRefFrameRotator(newIndicies.data(), p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice), tbb::auto_partitioner());
 #else
   {
-    SampleRefFrameRotator serial(newIndiciesPtr, p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice);
+    SampleRefFrameRotator serial(newIndicies.data(), p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice);
     serial.convert(0, p_Impl->m_Params.zpNew, 0, p_Impl->m_Params.ypNew, 0, p_Impl->m_Params.xpNew);
   }
 #endif
 
-  // This could technically be parallelized also where each thread takes an array to adjust. Except
-  // that the DataContainer is NOT thread safe or re-entrant so that would actually be a BAD idea.
-
+  // The arrays are remapped concurrently into new arrays. The new arrays are swapped into the Attribute Matrix
+  // from this thread after each batch since the DataContainer is NOT thread safe or re-entrant.
   QString attrMatName = getCellAttributeMatrixPath().getAttributeMatrixName();
-  QList<QString> voxelArrayNames = m->getAttributeMatrix(attrMatName)->getAttributeArrayNames();
-
-  for(const auto& attrArrayName : voxelArrayNames)
+  AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(attrMatName);
+  std::vector<size_t> tDims = {static_cast<size_t>(p_Impl->m_Params.xpNew), static_cast<size_t>(p_Impl->m_Params.ypNew), static_cast<size_t>(p_Impl->m_Params.zpNew)};
+  if(!cellAttrMat->gatherAttributeArrays(*cellAttrMat, newIndicies, tDims, this))
   {
-    IDataArray::Pointer p = m->getAttributeMatrix(attrMatName)->getAttributeArray(attrArrayName);
-
-    // Make a copy of the 'p' array that has the same name. When placed into
-    // the data container this will over write the current array with
-    // the same name.
-
-    IDataArray::Pointer data = p->createNewArray(newNumCellTuples, p->getComponentDimensions(), p->getName());
-    int64_t newIndicies_I = 0;
-    for(size_t i = 0; i < static_cast<size_t>(newNumCellTuples); i++)
-    {
-      newIndicies_I = newindicies[i];
-      if(newIndicies_I >= 0)
-      {
-        if(!data->copyFromArray(i, p, newIndicies_I, 1))
-        {
-          QString ss = QObject::tr("copyFromArray Failed: ");
-          QTextStream out(&ss);
-          out << "Source Array Name: " << p->getName() << " Source Tuple Index: " << newIndicies_I << "\n";
-          out << "Dest Array Name: " << data->getName() << "  Dest. Tuple Index: " << i << "\n";
-          setErrorCondition(-45102, ss);
-          return;
-        }
-      }
-      else
-      {
-        int var = 0;
-        data->initializeTuple(i, &var);
-      }
-    }
-    m->getAttributeMatrix(attrMatName)->insertOrAssign(data);
+    QString ss = QObject::tr("Failed to copy the rotated data into the arrays of Attribute Matrix '%1'").arg(attrMatName);
+    setErrorCondition(-45102, ss);
+    return;
   }
 }
 
@@ -239,6 +239,55 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void FusedExpressionArrayCalculatorTest()
+  {
+    // Use enough tuples that the expression is evaluated over several blocks
+    const size_t numTuples = 5000;
+    DataArrayPath arrayPath("DataContainer", "LargeMatrix", "NewArray");
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numTuples), "LargeMatrix", AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer floatArray = FloatArrayType::CreateArray(numTuples, std::string("Angles"), true);
+    Int16ArrayType::Pointer vectorArray = Int16ArrayType::CreateArray(std::vector<size_t>(1, numTuples), std::vector<size_t>(1, 3), "Vectors", true);
+    for(size_t t = 0; t < numTuples; t++)
+    {
+      floatArray->setValue(t, static_cast<float>(t % 360));
+      vectorArray->setComponent(t, 0, static_cast<int16_t>(t % 7));
+      vectorArray->setComponent(t, 1, static_cast<int16_t>(-static_cast<int32_t>(t % 11)));
+      vectorArray->setComponent(t, 2, static_cast<int16_t>(t % 5));
+    }
+    am->insertOrAssign(floatArray);
+    am->insertOrAssign(vectorArray);
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+
+    ArrayCalculator::Pointer filter = ArrayCalculator::New();
+    filter->setDataContainerArray(dca);
+    filter->setSelectedAttributeMatrix(DataArrayPath("DataContainer", "LargeMatrix", ""));
+    filter->setCalculatedArray(arrayPath);
+    filter->setUnits(ArrayCalculator::Degrees);
+    filter->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    filter->setInfixEquation("sin(Angles) * Vectors[0] - abs(Vectors[1]) / (Vectors[2] + 1) + root(Angles + 1, 2)");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), static_cast<int>(CalculatorItem::ErrorCode::SUCCESS));
+
+    FloatArrayType::Pointer arrayPtr = dca->getPrereqArrayFromPath<FloatArrayType>(filter.get(), arrayPath);
+    DREAM3D_REQUIRE_VALID_POINTER(arrayPtr.get())
+    DREAM3D_REQUIRE_EQUAL(arrayPtr->getNumberOfTuples(), numTuples)
+    DREAM3D_REQUIRE_EQUAL(arrayPtr->getNumberOfComponents(), 1)
+    for(size_t t = 0; t < numTuples; t++)
+    {
+      double angle = floatArray->getValue(t);
+      double expected = sin(angle * (M_PI / 180.0)) * vectorArray->getComponent(t, 0) - fabs(static_cast<double>(vectorArray->getComponent(t, 1))) / (vectorArray->getComponent(t, 2) + 1.0) +
+                        pow(angle + 1.0, 1.0 / 2.0);
+      DREAM3D_REQUIRED(SIMPLibMath::closeEnough<double>(arrayPtr->getValue(t), expected, 0.0001), ==, true)
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -942,6 +991,7 @@ public:
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(SingleComponentArrayCalculatorTest())
     DREAM3D_REGISTER_TEST(MultiComponentArrayCalculatorTest())
+    DREAM3D_REGISTER_TEST(FusedExpressionArrayCalculatorTest())
   }
 
 private:
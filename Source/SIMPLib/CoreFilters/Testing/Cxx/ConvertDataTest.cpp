@@ -37,6 +37,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <limits>
 #include <vector>
 
 #include "SIMPLib/SIMPLib.h"
@@ -605,6 +606,73 @@ public:
     DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestClampMode()
+  {
+    ConvertData::Pointer filter = createFilter();
+    filter->setDataContainerArray(createDataContainerArray(SIMPL::NumericTypes::Type::Float));
+    AttributeMatrix::Pointer am = filter->getDataContainerArray()->getDataContainer("DataContainer")->getAttributeMatrix("AttributeMatrix");
+    FloatArrayType::Pointer input = getDataArray<float>(am, "DataArray");
+    input->setValue(0, -10.5f);
+    input->setValue(1, 12.7f);
+    input->setValue(2, 300.7f);
+    input->setValue(3, std::numeric_limits<float>::quiet_NaN());
+
+    setValues(filter, "DataArray", SIMPL::NumericTypes::Type::UInt8, "Clamped");
+    filter->setConversionMode(static_cast<int>(IDataArray::ConversionMode::Clamp));
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+
+    UInt8ArrayType::Pointer clamped = getDataArray<uint8_t>(am, "Clamped");
+    DREAM3D_REQUIRE(nullptr != clamped.get());
+    DREAM3D_REQUIRE_EQUAL(clamped->getValue(0), 0);
+    DREAM3D_REQUIRE_EQUAL(clamped->getValue(1), 12);
+    DREAM3D_REQUIRE_EQUAL(clamped->getValue(2), 255);
+    DREAM3D_REQUIRE_EQUAL(clamped->getValue(3), 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNormalizeMode()
+  {
+    ConvertData::Pointer filter = createFilter();
+    filter->setDataContainerArray(createDataContainerArray(SIMPL::NumericTypes::Type::Int32));
+    AttributeMatrix::Pointer am = filter->getDataContainerArray()->getDataContainer("DataContainer")->getAttributeMatrix("AttributeMatrix");
+    Int32ArrayType::Pointer input = getDataArray<int32_t>(am, "DataArray");
+    input->setValue(0, 0);
+    input->setValue(1, 50);
+    input->setValue(2, 100);
+    input->setValue(3, 25);
+    filter->setConversionMode(static_cast<int>(IDataArray::ConversionMode::Normalize));
+
+    setValues(filter, "DataArray", SIMPL::NumericTypes::Type::UInt8, "NormalizedUInt8");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+    UInt8ArrayType::Pointer normalizedUInt8 = getDataArray<uint8_t>(am, "NormalizedUInt8");
+    DREAM3D_REQUIRE(nullptr != normalizedUInt8.get());
+    DREAM3D_REQUIRE_EQUAL(normalizedUInt8->getValue(0), 0);
+    DREAM3D_REQUIRE_EQUAL(normalizedUInt8->getValue(1), 128);
+    DREAM3D_REQUIRE_EQUAL(normalizedUInt8->getValue(2), 255);
+    DREAM3D_REQUIRE_EQUAL(normalizedUInt8->getValue(3), 64);
+
+    setValues(filter, "DataArray", SIMPL::NumericTypes::Type::Float, "NormalizedFloat");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+    FloatArrayType::Pointer normalizedFloat = getDataArray<float>(am, "NormalizedFloat");
+    DREAM3D_REQUIRE(nullptr != normalizedFloat.get());
+    DREAM3D_REQUIRE_EQUAL(normalizedFloat->getValue(0), 0.0f);
+    DREAM3D_REQUIRE_EQUAL(normalizedFloat->getValue(1), 0.5f);
+    DREAM3D_REQUIRE_EQUAL(normalizedFloat->getValue(2), 1.0f);
+    DREAM3D_REQUIRE_EQUAL(normalizedFloat->getValue(3), 0.25f);
+
+    filter->setConversionMode(3);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -397);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -643,6 +711,8 @@ public:
 
     DREAM3D_REGISTER_TEST(TestInvalidDataArray());
     DREAM3D_REGISTER_TEST(TestOverwriteArray());
+    DREAM3D_REGISTER_TEST(TestClampMode());
+    DREAM3D_REGISTER_TEST(TestNormalizeMode());
   }
 
 private:
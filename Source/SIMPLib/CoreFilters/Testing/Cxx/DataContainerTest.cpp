@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include <cstdlib>
+#include <cstring>
 #include <tuple>
 
 #include <QtCore/QDir>
@@ -43,6 +44,9 @@
 #include <QtCore/QString>
 #include <QtCore/QVector>
 
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
 #include "SIMPLib/CoreFilters/DataContainerWriter.h"
@@ -109,6 +113,16 @@ QString TestFile3()
   return TestDir() + QString::fromLatin1("/DataContainerIOTest_Subset.h5");
 }
 
+QString TestFile4()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Compressed.h5");
+}
+
+QString TestFile5()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Slab.h5");
+}
+
 QString JsonFile()
 {
   return TestDir() + QString::fromLatin1("/DataContainerProxyTest.json");
@@ -143,6 +157,8 @@ public:
     QFile::remove(DataContainerIOTest::TestFile());
     QFile::remove(DataContainerIOTest::TestFile2());
     QFile::remove(DataContainerIOTest::TestFile3());
+    QFile::remove(DataContainerIOTest::TestFile4());
+    QFile::remove(DataContainerIOTest::TestFile5());
     QFile::remove(DataContainerIOTest::JsonFile());
     QFile::remove(DataContainerIOTest::H5File());
 
@@ -469,6 +485,204 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ReadDataContainerArray(const QString& filePath)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(filePath);
+    reader->setDataContainerArray(dca);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(filePath));
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCompressedDataContainerWriter()
+  {
+    DataContainerArray::Pointer dca = ReadDataContainerArray(DataContainerIOTest::TestFile());
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::TestFile4());
+    writer->setWriteXdmfFile(false);
+    writer->setCompressArrays(true);
+    writer->setCompressionLevel(6);
+    // A small chunk size splits the arrays into several chunks, including partial chunks at the edges
+    writer->setChunkSize(1);
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+
+    // The arrays must be stored chunked and compressed
+    {
+      hid_t fileId = QH5Utilities::openFile(DataContainerIOTest::TestFile4(), true);
+      DREAM3D_REQUIRE(fileId >= 0)
+      H5ScopedFileSentinel sentinel(fileId, true);
+      QString datasetPath = QString("%1/%2/%3/%4").arg(SIMPL::StringConstants::DataContainerGroupName, SIMPL::Defaults::DataContainerName, getCellFeatureAttributeMatrixName(), SIMPL::CellData::FeatureIds);
+      hid_t datasetId = H5Dopen(fileId, datasetPath.toLatin1().constData(), H5P_DEFAULT);
+      DREAM3D_REQUIRE(datasetId >= 0)
+      hid_t dcplId = H5Dget_create_plist(datasetId);
+      DREAM3D_REQUIRE_EQUAL(H5Pget_layout(dcplId), H5D_CHUNKED)
+      DREAM3D_REQUIRE(H5Pget_nfilters(dcplId) > 0)
+      H5Pclose(dcplId);
+      H5Dclose(datasetId);
+    }
+
+    // Reading the compressed file back must give exactly the same data
+    DataContainerArray::Pointer dca2 = ReadDataContainerArray(DataContainerIOTest::TestFile4());
+    QList<QString> dcNames = dca->getDataContainerNames();
+    for(const QString& dcName : dcNames)
+    {
+      DataContainer::Pointer dc = dca->getDataContainer(dcName);
+      for(const AttributeMatrix::Pointer& am : dc->getChildren())
+      {
+        for(const IDataArray::Pointer& array : am->getChildren())
+        {
+          IDataArray::Pointer array2 = dca2->getAttributeMatrix(DataArrayPath(dcName, am->getName(), ""))->getAttributeArray(array->getName());
+          DREAM3D_REQUIRE_VALID_POINTER(array2.get())
+          DREAM3D_REQUIRE_EQUAL(array2->getNumberOfTuples(), array->getNumberOfTuples())
+          DREAM3D_REQUIRE_EQUAL(array2->getNumberOfComponents(), array->getNumberOfComponents())
+          if(nullptr == std::dynamic_pointer_cast<StringDataArray>(array))
+          {
+            size_t numBytes = array->getSize() * array->getTypeSize();
+            DREAM3D_REQUIRE_EQUAL(std::memcmp(array->getVoidPointer(0), array2->getVoidPointer(0), numBytes), 0)
+          }
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTupleSubsetReader()
+  {
+    const size_t nx = 7;
+    const size_t ny = 6;
+    const size_t nz = 5;
+    std::vector<size_t> tDims = {nx, ny, nz};
+
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+      dca->addOrReplaceDataContainer(dc);
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(nx, ny, nz);
+      image->setOrigin(1.0f, 2.0f, 3.0f);
+      image->setSpacing(0.5f, 0.25f, 2.0f);
+      dc->setGeometry(image);
+
+      AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+      dc->addOrReplaceAttributeMatrix(cellAttrMat);
+      size_t numTuples = nx * ny * nz;
+      Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numTuples, SIMPL::CellData::FeatureIds, true);
+      FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(numTuples, std::vector<size_t>(1, 3), SIMPL::CellData::EulerAngles, true);
+      StringDataArray::Pointer labels = StringDataArray::CreateArray(numTuples, std::string("Labels"), true);
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        featureIds->setValue(i, static_cast<int32_t>(i));
+        eulers->setComponent(i, 0, static_cast<float>(i));
+        eulers->setComponent(i, 1, static_cast<float>(i) * 2.0f);
+        eulers->setComponent(i, 2, static_cast<float>(i) * 3.0f);
+        labels->setValue(i, QString::number(i));
+      }
+      cellAttrMat->insertOrAssign(featureIds);
+      cellAttrMat->insertOrAssign(eulers);
+      cellAttrMat->insertOrAssign(labels);
+
+      DataContainerWriter::Pointer writer = DataContainerWriter::New();
+      writer->setDataContainerArray(dca);
+      writer->setOutputFile(DataContainerIOTest::TestFile5());
+      writer->setWriteXdmfFile(false);
+      writer->execute();
+      DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+    }
+
+    // Ask for a 3x2x2 box that does not touch any face of the volume
+    std::vector<size_t> start = {2, 3, 1};
+    std::vector<size_t> count = {3, 2, 2};
+
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    DataContainerArrayProxy dcaProxy = reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile5());
+    AttributeMatrixProxy& amProxy = dcaProxy.getDataContainerProxy(SIMPL::Defaults::ImageDataContainerName).getAttributeMatrixProxy(SIMPL::Defaults::CellAttributeMatrixName);
+    amProxy.setTupleSubset(start, count);
+    DREAM3D_REQUIRE(amProxy.hasTupleSubset())
+
+    // The subset must survive a round trip through the pipeline json
+    {
+      QJsonObject json;
+      amProxy.writeJson(json);
+      AttributeMatrixProxy amProxy2;
+      DREAM3D_REQUIRE(amProxy2.readJson(json))
+      DREAM3D_REQUIRE(amProxy2 == amProxy)
+    }
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    reader->setInputFile(DataContainerIOTest::TestFile5());
+    reader->setDataContainerArray(dca);
+    reader->setInputFileDataContainerArrayProxy(dcaProxy);
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCode() >= 0)
+
+    DataContainer::Pointer dc = dca->getDataContainer(SIMPL::Defaults::ImageDataContainerName);
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(image.get())
+    SizeVec3Type dims = image->getDimensions();
+    FloatVec3Type origin = image->getOrigin();
+    DREAM3D_REQUIRE_EQUAL(dims[0], count[0])
+    DREAM3D_REQUIRE_EQUAL(dims[1], count[1])
+    DREAM3D_REQUIRE_EQUAL(dims[2], count[2])
+    DREAM3D_REQUIRE_EQUAL(origin[0], 2.0f)
+    DREAM3D_REQUIRE_EQUAL(origin[1], 2.75f)
+    DREAM3D_REQUIRE_EQUAL(origin[2], 5.0f)
+
+    AttributeMatrix::Pointer cellAttrMat = dc->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName);
+    DREAM3D_REQUIRE_VALID_POINTER(cellAttrMat.get())
+    DREAM3D_REQUIRE(cellAttrMat->getTupleDimensions() == count)
+    Int32ArrayType::Pointer featureIds = cellAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    FloatArrayType::Pointer eulers = cellAttrMat->getAttributeArrayAs<FloatArrayType>(SIMPL::CellData::EulerAngles);
+    StringDataArray::Pointer labels = cellAttrMat->getAttributeArrayAs<StringDataArray>("Labels");
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    DREAM3D_REQUIRE_VALID_POINTER(eulers.get())
+    DREAM3D_REQUIRE_VALID_POINTER(labels.get())
+    DREAM3D_REQUIRE_EQUAL(featureIds->getNumberOfTuples(), count[0] * count[1] * count[2])
+    DREAM3D_REQUIRE_EQUAL(labels->getNumberOfTuples(), count[0] * count[1] * count[2])
+
+    size_t index = 0;
+    for(size_t z = 0; z < count[2]; z++)
+    {
+      for(size_t y = 0; y < count[1]; y++)
+      {
+        for(size_t x = 0; x < count[0]; x++)
+        {
+          size_t fileIndex = ((z + start[2]) * ny + (y + start[1])) * nx + (x + start[0]);
+          DREAM3D_REQUIRE_EQUAL(featureIds->getValue(index), static_cast<int32_t>(fileIndex))
+          DREAM3D_REQUIRE_EQUAL(eulers->getComponent(index, 0), static_cast<float>(fileIndex))
+          DREAM3D_REQUIRE_EQUAL(eulers->getComponent(index, 2), static_cast<float>(fileIndex) * 3.0f)
+          DREAM3D_REQUIRE_EQUAL(labels->getValue(index), QString::number(fileIndex))
+          index++;
+        }
+      }
+    }
+
+    // A box that reaches outside of the volume must fail instead of reading garbage
+    count[2] = nz;
+    amProxy.setTupleSubset(start, count);
+    DataContainerArray::Pointer dca2 = DataContainerArray::New();
+    DataContainerReader::Pointer reader2 = DataContainerReader::New();
+    reader2->setInputFile(DataContainerIOTest::TestFile5());
+    reader2->setDataContainerArray(dca2);
+    reader2->setInputFileDataContainerArrayProxy(dcaProxy);
+    reader2->execute();
+    DREAM3D_REQUIRE(reader2->getErrorCode() < 0)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1196,6 +1410,8 @@ public:
     DREAM3D_REGISTER_TEST(TestDataContainerArrayProxy())
 
     DREAM3D_REGISTER_TEST(TestDataContainerReader())
+    DREAM3D_REGISTER_TEST(TestCompressedDataContainerWriter())
+    DREAM3D_REGISTER_TEST(TestTupleSubsetReader())
     DREAM3D_REGISTER_TEST(TestDataArrayPath())
 
 #if REMOVE_TEST_FILES
@@ -32,11 +32,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+
 #include "SIMPLib/CoreFilters/GenerateTiltSeries.h"
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -167,6 +171,54 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLineIntegralProjection()
+  {
+    // A 10 x 8 x 6 block of ones projects to its thickness along the ray
+    const SizeVec3Type dims = {10, 8, 6};
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Volume");
+    ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    imageGeom->setDimensions(dims);
+    imageGeom->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+    imageGeom->setOrigin(FloatVec3Type(0.0f, 0.0f, 0.0f));
+    dc->setGeometry(imageGeom);
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New({dims[0], dims[1], dims[2]}, "CellData", AttributeMatrix::Type::Cell);
+    dc->insertOrAssign(cellAttrMat);
+    UInt8ArrayType::Pointer data = UInt8ArrayType::CreateArray(dims[0] * dims[1] * dims[2], std::string("Density"), true);
+    data->initializeWithValue(1);
+    cellAttrMat->insertOrAssign(data);
+    dca->insertOrAssign(dc);
+
+    GenerateTiltSeries::Pointer generateTiltSeries = GenerateTiltSeries::New();
+    generateTiltSeries->setDataContainerArray(dca);
+    generateTiltSeries->setInputDataArrayPath(DataArrayPath("Volume", "CellData", "Density"));
+    generateTiltSeries->setRotationAxis(GenerateTiltSeries::k_XAxis);
+    generateTiltSeries->setRotationLimits({0.0f, 180.0f, 90.0f});
+    generateTiltSeries->setInterpolationType(GenerateTiltSeries::k_Trilinear);
+    generateTiltSeries->setOutputType(GenerateTiltSeries::k_LineIntegralProjection);
+    generateTiltSeries->setOutputPrefix("Projection_");
+    generateTiltSeries->execute();
+    int err = generateTiltSeries->getErrorCode();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    // 0 degrees looks down Z, 90 degrees looks down Y
+    const std::array<float, 2> thickness = {static_cast<float>(dims[2]), static_cast<float>(dims[1])};
+    for(size_t i = 0; i < thickness.size(); i++)
+    {
+      DataArrayPath projectionPath("Projection_" + QString::number(i), k_SliceDataName, "Density");
+      FloatArrayType::Pointer projection = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, projectionPath);
+      DREAM3D_REQUIRE_VALID_POINTER(projection)
+
+      float maxValue = *std::max_element(projection->begin(), projection->end());
+      DREAM3D_REQUIRE(std::fabs(maxValue - thickness[i]) < 1.0E-3f)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -175,6 +227,7 @@ public:
     int err = EXIT_SUCCESS;
 
     DREAM3D_REGISTER_TEST(TestGenerateTiltSeriesTest())
+    DREAM3D_REGISTER_TEST(TestLineIntegralProjection())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -39,6 +39,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
@@ -48,6 +49,7 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Filtering/ThresholdEngine.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
@@ -355,6 +357,57 @@ public:
     return 1;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunThresholdEngineTest()
+  {
+    // Enough tuples for several blocks and a partial last block and packed word
+    const size_t numTuples = 3 * ThresholdEngine::k_BlockSize + 77;
+    FloatArrayType::Pointer dataf = FloatArrayType::CreateArray(numTuples, std::string("Float"), true);
+    Int32ArrayType::Pointer datai = Int32ArrayType::CreateArray(numTuples, std::string("Int"), true);
+    BoolArrayType::Pointer datab = BoolArrayType::CreateArray(numTuples, std::string("Bool"), true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      dataf->setValue(i, static_cast<float>((i * 37) % 1000) / 10.0f);
+      datai->setValue(i, static_cast<int32_t>((i * 13) % 20));
+      datab->setValue(i, (i % 3) == 0);
+    }
+
+    // Float > 20 OR NOT(Int < 5 AND Bool == 1 OR <empty set>) AND Int != 7
+    ThresholdEngine engine(numTuples);
+    DREAM3D_REQUIRE(engine.addComparison(SIMPL::Union::Operator_And, dataf, SIMPL::Comparison::Operator_GreaterThan, 20.0))
+    engine.beginSet(SIMPL::Union::Operator_Or, true);
+    DREAM3D_REQUIRE(engine.addComparison(SIMPL::Union::Operator_And, datai, SIMPL::Comparison::Operator_LessThan, 5.0))
+    DREAM3D_REQUIRE(engine.addComparison(SIMPL::Union::Operator_And, datab, SIMPL::Comparison::Operator_Equal, 1.0))
+    engine.beginSet(SIMPL::Union::Operator_Or, false);
+    engine.endSet();
+    engine.endSet();
+    DREAM3D_REQUIRE(engine.addComparison(SIMPL::Union::Operator_And, datai, SIMPL::Comparison::Operator_NotEqual, 7.0))
+
+    BoolArrayType::Pointer output = BoolArrayType::CreateArray(numTuples, std::string("Output"), true);
+    engine.execute(output->getPointer(0));
+    std::vector<uint64_t> packed = engine.executePacked();
+    DREAM3D_REQUIRE_EQUAL(packed.size(), (numTuples + 63) / 64)
+
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      bool inner = !(datai->getValue(i) < 5 && datab->getValue(i));
+      bool expected = (dataf->getValue(i) > 20.0f || inner) && datai->getValue(i) != 7;
+      DREAM3D_REQUIRE_EQUAL(output->getValue(i), expected)
+      DREAM3D_REQUIRE_EQUAL(((packed[i / 64] >> (i % 64)) & 1) != 0, expected)
+    }
+    DREAM3D_REQUIRE_EQUAL(packed.back() >> (numTuples % 64), 0)
+
+    // Arrays of another size or an unsupported type are rejected
+    Int32ArrayType::Pointer shortArray = Int32ArrayType::CreateArray(numTuples - 1, std::string("Short"), true);
+    DREAM3D_REQUIRE_EQUAL(engine.addComparison(SIMPL::Union::Operator_And, shortArray, SIMPL::Comparison::Operator_Equal, 0.0), false)
+    StringDataArray::Pointer stringArray = StringDataArray::CreateArray(numTuples, QString("String"), true);
+    DREAM3D_REQUIRE_EQUAL(engine.addComparison(SIMPL::Union::Operator_And, stringArray, SIMPL::Comparison::Operator_Equal, 0.0), false)
+
+    return 1;
+  }
+
   /**
    * @brief
    */
@@ -364,6 +417,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
     DREAM3D_REGISTER_TEST(RunComparisonValueTests())
     DREAM3D_REGISTER_TEST(RunComparisonSetTests())
+    DREAM3D_REGISTER_TEST(RunThresholdEngineTest())
   }
 
 private:
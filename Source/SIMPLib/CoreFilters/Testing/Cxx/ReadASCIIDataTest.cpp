@@ -33,12 +33,14 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include <cmath>
+#include <limits>
 
 #include <QtCore/QFile>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/CoreFilters/ReadASCIIData.h"
+#include "SIMPLib/CoreFilters/util/ASCIIDataStreamParser.h"
 #include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
@@ -427,6 +429,98 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteStreamParserFile(const QString& filePath, size_t numRows, size_t badValueRow, size_t badColumnsRow)
+  {
+    QFile data(filePath);
+    if(data.open(QFile::WriteOnly))
+    {
+      QTextStream out(&data);
+      out << "Index,Value,Name\n";
+      for(size_t row = 0; row < numRows; row++)
+      {
+        if(row == badColumnsRow)
+        {
+          out << row << "," << row * 0.5;
+        }
+        else if(row == badValueRow)
+        {
+          out << row << ",abc," << "Name_" << row;
+        }
+        else
+        {
+          out << row << "," << row * 0.5 << ",Name_" << row;
+        }
+        // Mix Windows and Unix line endings and leave the last line without one
+        if(row + 1 < numRows)
+        {
+          out << ((row % 3 == 0) ? "\r\n" : "\n");
+        }
+      }
+      data.close();
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestStreamParser()
+  {
+    const size_t numRows = 5000;
+    const size_t noRow = std::numeric_limits<size_t>::max();
+
+    Int32ArrayType::Pointer indices = Int32ArrayType::CreateArray(numRows, QString("Index"), true);
+    DoubleArrayType::Pointer values = DoubleArrayType::CreateArray(numRows, QString("Value"), true);
+    StringDataArray::Pointer names = StringDataArray::CreateArray(numRows, QString("Name"), true);
+
+    QList<AbstractDataParser::Pointer> parsers;
+    parsers.push_back(Int32ParserType::New(indices, "Index", 0));
+    parsers.push_back(DoubleParserType::New(values, "Value", 1));
+    parsers.push_back(StringParserType::New(names, "Name", 2));
+
+    QList<char> delimiters;
+    delimiters.push_back(',');
+
+    // A tiny block size forces lines to be carried over between many blocks
+    ASCIIDataStreamParser streamParser(parsers, 3, delimiters);
+    streamParser.setBlockSize(97);
+
+    WriteStreamParserFile(UnitTest::ReadASCIIDataTest::TestFile2, numRows, noRow, noRow);
+    ASCIIDataStreamParser::ParseError error = streamParser.parse(UnitTest::ReadASCIIDataTest::TestFile2, 2, static_cast<int>(numRows) + 1);
+    DREAM3D_REQUIRE(error.type == ASCIIDataStreamParser::ErrorType::None)
+    for(size_t i = 0; i < numRows; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(indices->getValue(i), static_cast<int32_t>(i))
+      DREAM3D_REQUIRE_EQUAL(values->getValue(i), i * 0.5)
+      DREAM3D_REQUIRE_EQUAL(names->getValue(i), QString("Name_%1").arg(i))
+    }
+
+    // The first bad line must be reported even though later lines are parsed by other threads
+    WriteStreamParserFile(UnitTest::ReadASCIIDataTest::TestFile2, numRows, 4000, 3000);
+    error = streamParser.parse(UnitTest::ReadASCIIDataTest::TestFile2, 2, static_cast<int>(numRows) + 1);
+    DREAM3D_REQUIRE(error.type == ASCIIDataStreamParser::ErrorType::InconsistentColumns)
+    DREAM3D_REQUIRE_EQUAL(error.lineNumber, 3002)
+    DREAM3D_REQUIRE_EQUAL(error.tokenCount, 2)
+
+    WriteStreamParserFile(UnitTest::ReadASCIIDataTest::TestFile2, numRows, 2500, 3000);
+    streamParser.setBlockSize(ASCIIDataStreamParser::k_DefaultBlockSize);
+    error = streamParser.parse(UnitTest::ReadASCIIDataTest::TestFile2, 2, static_cast<int>(numRows) + 1);
+    DREAM3D_REQUIRE(error.type == ASCIIDataStreamParser::ErrorType::ConversionFailure)
+    DREAM3D_REQUIRE_EQUAL(error.lineNumber, 2502)
+    DREAM3D_REQUIRE_EQUAL(error.columnIndex, 1)
+
+    // Asking for more lines than the file holds reads the missing lines as empty lines
+    WriteStreamParserFile(UnitTest::ReadASCIIDataTest::TestFile2, numRows - 1, noRow, noRow);
+    error = streamParser.parse(UnitTest::ReadASCIIDataTest::TestFile2, 2, static_cast<int>(numRows) + 1);
+    DREAM3D_REQUIRE(error.type == ASCIIDataStreamParser::ErrorType::InconsistentColumns)
+    DREAM3D_REQUIRE_EQUAL(error.lineNumber, static_cast<int>(numRows) + 1)
+    DREAM3D_REQUIRE_EQUAL(error.tokenCount, 0)
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -460,6 +554,8 @@ public:
 
     DREAM3D_REGISTER_TEST(RunTest())
 
+    DREAM3D_REGISTER_TEST(TestStreamParser())
+
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 
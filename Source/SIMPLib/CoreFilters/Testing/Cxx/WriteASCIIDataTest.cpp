@@ -38,6 +38,11 @@
 #include <iostream>
 #include <string>
 
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QString>
 
 #include "SIMPLib/SIMPLib.h"
@@ -79,6 +84,7 @@ public:
 #if REMOVE_TEST_FILES
     QFile::remove(UnitTest::TestTempDir + "/" + k_ArrayName + k_Extension);
     QFile::remove(UnitTest::TestTempDir + "/" + "SingleFileMode.csv");
+    QDir(UnitTest::TestTempDir + "/" + "BinaryColumns").removeRecursively();
 #endif
   }
 
@@ -138,6 +144,56 @@ public:
     err = writer->getErrorCode();
     DREAM3D_REQUIRE(err >= 0)
 
+    // Test Binary Columns mode
+    FloatArrayType::Pointer floatArray = FloatArrayType::CreateArray(k_ArraySize, std::vector<size_t>(1, 3), "FloatArray", true);
+    for(size_t i = 0; i < floatArray->getSize(); i++)
+    {
+      floatArray->setValue(i, static_cast<float>(i) * 0.5f);
+    }
+    am->insertOrAssign(floatArray);
+
+    QString binaryDir = UnitTest::TestTempDir + "/" + "BinaryColumns";
+    writer->setOutputStyle(WriteASCIIData::BinaryColumns);
+    writer->setBinaryOutputPath(binaryDir);
+    writer->setSelectedDataArrayPaths({DataArrayPath("DataContainer", "TestAttributeMatrix", "ASCII_Data"), DataArrayPath("DataContainer", "TestAttributeMatrix", "FloatArray")});
+    writer->preflight();
+    err = writer->getErrorCode();
+    DREAM3D_REQUIRE(err >= 0)
+
+    writer->execute();
+    err = writer->getErrorCode();
+    DREAM3D_REQUIRE(err >= 0)
+
+    {
+      QFile floatFile(binaryDir + "/FloatArray.bin");
+      DREAM3D_REQUIRE(floatFile.open(QIODevice::ReadOnly))
+      QByteArray bytes = floatFile.readAll();
+      DREAM3D_REQUIRE_EQUAL(bytes.size(), static_cast<int>(k_ArraySize * 3 * sizeof(float)))
+      const float* values = reinterpret_cast<const float*>(bytes.constData());
+      DREAM3D_REQUIRE_EQUAL(values[7], 3.5f)
+
+      QFile offsetsFile(binaryDir + "/ASCII_Data.offsets.bin");
+      DREAM3D_REQUIRE(offsetsFile.open(QIODevice::ReadOnly))
+      bytes = offsetsFile.readAll();
+      DREAM3D_REQUIRE_EQUAL(bytes.size(), static_cast<int>((k_ArraySize + 1) * sizeof(int64_t)))
+      const int64_t* offsets = reinterpret_cast<const int64_t*>(bytes.constData());
+      DREAM3D_REQUIRE_EQUAL(offsets[1], 3)
+      DREAM3D_REQUIRE_EQUAL(offsets[2], 6)
+
+      QFile manifestFile(binaryDir + "/TestAttributeMatrix.json");
+      DREAM3D_REQUIRE(manifestFile.open(QIODevice::ReadOnly))
+      QJsonObject manifest = QJsonDocument::fromJson(manifestFile.readAll()).object();
+      DREAM3D_REQUIRE_EQUAL(manifest["NumberOfTuples"].toInt(), static_cast<int>(k_ArraySize))
+      QJsonArray columns = manifest["Columns"].toArray();
+      DREAM3D_REQUIRE_EQUAL(columns.size(), 2)
+      DREAM3D_REQUIRE_EQUAL(columns[1].toObject()["Type"].toString(), QString("float"))
+    }
+
+    writer->setBinaryOutputPath("");
+    writer->preflight();
+    err = writer->getErrorCode();
+    DREAM3D_REQUIRED(err, ==, -11014)
+
     // Back to MultiFile mode
     writer->setOutputStyle(WriteASCIIData::MultiFile);
 
@@ -34,7 +34,12 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "WriteASCIIData.h"
 
+#include <algorithm>
+
 #include <QtCore/QDir>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
@@ -52,6 +57,7 @@
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ParallelTextWriter.h"
 
 /**
  * @brief The ExportDataPrivate class is a templated class that implements a method to generically
@@ -89,39 +95,70 @@ public:
       return;
     }
 
-    QTextStream out(&file);
-
-    int32_t nComp = inputArray->getNumberOfComponents();
-
-    TInputType* inputArrayPtr = inputArray->getPointer(0);
-    size_t nTuples = inputArray->getNumberOfTuples();
-
-    int32_t recCount = 0;
-    for(size_t i = 0; i < nTuples; i++)
-    {
-      for(int32_t j = 0; j < nComp; j++)
+    const size_t nComp = inputArray->getNumberOfComponents();
+    const TInputType* inputArrayPtr = inputArray->getConstPointer(0);
+    const size_t nTuples = inputArray->getNumberOfTuples();
+    const size_t tuplesPerLine = static_cast<size_t>(MaxValPerLine);
+    const size_t numLines = (nTuples + tuplesPerLine - 1) / tuplesPerLine;
+
+    // Each line holds MaxValPerLine tuples. A partial last line ends with the delimiter instead of a newline.
+    ParallelTextWriter textWriter;
+    bool written = textWriter.writeRows(file, 0, numLines, [=](size_t line, std::string& buffer) {
+      const size_t firstTuple = line * tuplesPerLine;
+      const size_t lastTuple = std::min(firstTuple + tuplesPerLine, nTuples);
+      for(size_t i = firstTuple; i < lastTuple; i++)
       {
-        out << inputArrayPtr[i * nComp + j];
-        if(j < nComp - 1)
+        for(size_t j = 0; j < nComp; j++)
         {
-          out << delimiter;
+          ParallelTextWriter::AppendValue(buffer, inputArrayPtr[i * nComp + j]);
+          if(j < nComp - 1)
+          {
+            buffer.push_back(delimiter);
+          }
         }
+        buffer.push_back(i - firstTuple + 1 >= tuplesPerLine ? '\n' : delimiter);
       }
-      recCount++;
+    });
 
-      if(recCount >= MaxValPerLine)
-      {
-        out << '\n';
-        recCount = 0;
-      }
-      else
-      {
-        out << delimiter;
-      }
+    if(!written)
+    {
+      QString ss = QObject::tr("Error writing to the output file: '%1'").arg(outputFile);
+      filter->setErrorCondition(-11013, ss);
     }
   }
 };
 
+/**
+ * @brief The ReadOnlyPointerPrivate class returns the address of the first value of a DataArray
+ * without requesting write access to it
+ */
+template <typename TInputType>
+class ReadOnlyPointerPrivate
+{
+public:
+  using DataArrayType = DataArray<TInputType>;
+
+  ReadOnlyPointerPrivate() = default;
+  virtual ~ReadOnlyPointerPrivate() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool operator()(IDataArray::Pointer p)
+  {
+    return (std::dynamic_pointer_cast<DataArrayType>(p).get() != nullptr);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void static Execute(IDataArray::Pointer inputData, const void** values)
+  {
+    typename DataArrayType::Pointer inputArray = std::dynamic_pointer_cast<DataArrayType>(inputData);
+    *values = inputArray->getConstPointer(0);
+  }
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -148,9 +185,10 @@ void WriteASCIIData::setupFilterParameters()
     std::vector<QString> choices;
     choices.push_back("Multiple Files");
     choices.push_back("Single File");
+    choices.push_back("Binary Columns");
     parameter->setChoices(choices);
 
-    std::vector<QString> linkedProps = {"OutputPath", "FileExtension", "MaxValPerLine", "OutputFilePath"};
+    std::vector<QString> linkedProps = {"OutputPath", "FileExtension", "MaxValPerLine", "OutputFilePath", "BinaryOutputPath"};
     parameter->setLinkedProperties(linkedProps);
     parameter->setEditable(false);
     parameter->setCategory(FilterParameter::Category::Parameter);
@@ -166,6 +204,9 @@ void WriteASCIIData::setupFilterParameters()
   // Single File Output
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File Path", OutputFilePath, FilterParameter::Category::Parameter, WriteASCIIData, "*", "*", 1));
 
+  // Binary Columns Output
+  parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Binary Output Path", BinaryOutputPath, FilterParameter::Category::Parameter, WriteASCIIData, 2));
+
   {
     ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New(); // Delimiter choice
     parameter->setHumanLabel("Delimiter");
@@ -250,9 +291,19 @@ void WriteASCIIData::dataCheck()
       setWarningCondition(-11006, ss);
     }
   }
+  //**************** Binary Columns Checks ******************
+  else if(m_OutputStyle == BinaryColumns)
+  {
+    if(m_BinaryOutputPath.isEmpty())
+    {
+      QString ss = QObject::tr("The binary output path must be set");
+      setErrorCondition(-11014, ss);
+      return;
+    }
+  }
   else
   {
-    QString ss = QObject::tr("The type of output did not match either 0 (Multi-File) or 1 (Single File)");
+    QString ss = QObject::tr("The type of output did not match 0 (Multi-File), 1 (Single File) or 2 (Binary Columns)");
     setErrorCondition(-11009, ss);
     return;
   }
@@ -330,9 +381,13 @@ void WriteASCIIData::execute()
   {
     writeSingleFileOutput();
   }
+  else if(m_OutputStyle == BinaryColumns)
+  {
+    writeBinaryColumnsOutput();
+  }
   else
   {
-    QString ss = QObject::tr("The type of output did not match either 0 (Multi-File) or 1 (Single File)");
+    QString ss = QObject::tr("The type of output did not match 0 (Multi-File), 1 (Single File) or 2 (Binary Columns)");
     setErrorCondition(-11009, ss);
     return;
   }
@@ -456,11 +511,11 @@ void WriteASCIIData::writeSingleFileOutput()
     numTuples = data[0]->getNumberOfTuples();
   }
 
+  // The rows are formatted in parallel and written after the header the stream holds
+  outFile.flush();
   float threshold = 0.0f;
-  size_t numArrays = data.size();
-  for(size_t i = 0; i < numTuples; ++i)
-  {
-    float percentIncrement = static_cast<float>(i) / static_cast<float>(numTuples) * 100.0f;
+  auto progress = [this, numTuples, &threshold](size_t rowsWritten) {
+    float percentIncrement = static_cast<float>(rowsWritten) / static_cast<float>(numTuples) * 100.0f;
     if(percentIncrement > threshold)
     {
       QString ss = QObject::tr("Writing Output: %1%").arg(static_cast<int32_t>(percentIncrement));
@@ -471,22 +526,132 @@ void WriteASCIIData::writeSingleFileOutput()
         threshold = percentIncrement;
       }
     }
+  };
+
+  ParallelTextWriter textWriter;
+  bool written = textWriter.writeRows(file, 0, numTuples,
+                                      [&data, delimiter](size_t i, std::string& buffer) {
+                                        // Print a row of data
+                                        const size_t numArrays = data.size();
+                                        for(size_t c = 0; c < numArrays; c++)
+                                        {
+                                          data[c]->appendTuple(buffer, i, delimiter);
+                                          if(c < numArrays - 1) // Last column
+                                          {
+                                            buffer.push_back(delimiter);
+                                          }
+                                        }
+                                        buffer.push_back('\n');
+                                      },
+                                      progress);
+
+  if(!written)
+  {
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getOutputFilePath());
+    setErrorCondition(-11022, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void WriteASCIIData::writeBinaryColumnsOutput()
+{
+  QDir dir;
+  if(!dir.mkpath(m_BinaryOutputPath))
+  {
+    QString ss = QObject::tr("Error creating output path '%1'").arg(m_BinaryOutputPath);
+    setErrorCondition(-11015, ss);
+    return;
+  }
+
+  // Every column is a file of raw values in the byte order of this machine that can be read back
+  // with RawBinaryReader or numpy.fromfile. String columns are stored the way Arrow stores them: the
+  // UTF-8 bytes of all values in one file and the int64 start offsets of each value in a second one.
+  QJsonArray columns;
+  size_t numTuples = 0;
+  for(const auto& weakPtr : m_SelectedWeakPtrVector)
+  {
+    IDataArray::Pointer selectedArrayPtr = weakPtr.lock();
+    numTuples = selectedArrayPtr->getNumberOfTuples();
 
-    // Print a row of data
-    for(size_t c = 0; c < numArrays; c++)
+    QString message = QObject::tr("|| Exporting Dataset '%1'").arg(selectedArrayPtr->getName());
+    notifyStatusMessage(message);
+
+    QJsonObject column;
+    column["Name"] = selectedArrayPtr->getName();
+    column["Type"] = selectedArrayPtr->getTypeAsString();
+    QJsonArray compDims;
+    for(const auto& dim : selectedArrayPtr->getComponentDimensions())
     {
-      QString s;
-      QTextStream out(&s);
-      data.at(c)->printTuple(out, i, delimiter);
+      compDims.append(static_cast<qint64>(dim));
+    }
+    column["ComponentDimensions"] = compDims;
+    column["File"] = selectedArrayPtr->getName() + ".bin";
 
-      if(c < numArrays - 1) // Last column
+    bool written = false;
+    StringDataArray::Pointer stringArray = std::dynamic_pointer_cast<StringDataArray>(selectedArrayPtr);
+    if(nullptr != stringArray)
+    {
+      QByteArray values;
+      std::vector<int64_t> offsets(numTuples + 1, 0);
+      for(size_t i = 0; i < numTuples; i++)
       {
-        out << delimiter;
+        values.append(stringArray->getValue(i).toUtf8());
+        offsets[i + 1] = values.size();
       }
-      outFile << s;
+      column["OffsetsFile"] = selectedArrayPtr->getName() + ".offsets.bin";
+      written = writeBinaryFile(m_BinaryOutputPath + QDir::separator() + column["File"].toString(), values.constData(), static_cast<size_t>(values.size())) &&
+                writeBinaryFile(m_BinaryOutputPath + QDir::separator() + column["OffsetsFile"].toString(), offsets.data(), offsets.size() * sizeof(int64_t));
+    }
+    else
+    {
+      // Read through the typed pointer so an array that shares its values is not copied
+      const void* values = nullptr;
+      EXECUTE_TEMPLATE(this, ReadOnlyPointerPrivate, selectedArrayPtr, selectedArrayPtr, &values)
+      if(getErrorCode() < 0)
+      {
+        return;
+      }
+      written = writeBinaryFile(m_BinaryOutputPath + QDir::separator() + column["File"].toString(), values, selectedArrayPtr->getSize() * selectedArrayPtr->getTypeSize());
+    }
+    if(!written)
+    {
+      return;
     }
-    outFile << "\n";
+    columns.append(column);
   }
+
+  QJsonObject manifest;
+  manifest["AttributeMatrix"] = m_SelectedDataArrayPaths.front().getAttributeMatrixName();
+  manifest["NumberOfTuples"] = static_cast<qint64>(numTuples);
+#ifdef CMP_WORDS_BIGENDIAN
+  manifest["ByteOrder"] = QString("BigEndian");
+#else
+  manifest["ByteOrder"] = QString("LittleEndian");
+#endif
+  manifest["Columns"] = columns;
+
+  QByteArray json = QJsonDocument(manifest).toJson();
+  writeBinaryFile(m_BinaryOutputPath + QDir::separator() + m_SelectedDataArrayPaths.front().getAttributeMatrixName() + ".json", json.constData(), static_cast<size_t>(json.size()));
+}
+
+// -----------------------------------------------------------------------------
+bool WriteASCIIData::writeBinaryFile(const QString& outputFile, const void* data, size_t numBytes)
+{
+  QFile file(outputFile);
+  if(!file.open(QIODevice::WriteOnly))
+  {
+    QString ss = QObject::tr("The output file could not be opened: '%1'").arg(outputFile);
+    setErrorCondition(-11016, ss);
+    return false;
+  }
+
+  if(numBytes > 0 && file.write(static_cast<const char*>(data), static_cast<qint64>(numBytes)) != static_cast<qint64>(numBytes))
+  {
+    QString ss = QObject::tr("Error writing to the output file: '%1'").arg(outputFile);
+    setErrorCondition(-11017, ss);
+    return false;
+  }
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -740,3 +905,15 @@ int WriteASCIIData::getOutputStyle() const
 {
   return m_OutputStyle;
 }
+
+// -----------------------------------------------------------------------------
+void WriteASCIIData::setBinaryOutputPath(const QString& value)
+{
+  m_BinaryOutputPath = value;
+}
+
+// -----------------------------------------------------------------------------
+QString WriteASCIIData::getBinaryOutputPath() const
+{
+  return m_BinaryOutputPath;
+}
@@ -63,6 +63,7 @@ class SIMPLib_EXPORT WriteASCIIData : public AbstractFilter
   PYB11_PROPERTY(QString FileExtension READ getFileExtension WRITE setFileExtension)
   PYB11_PROPERTY(int MaxValPerLine READ getMaxValPerLine WRITE setMaxValPerLine)
   PYB11_PROPERTY(int OutputStyle READ getOutputStyle WRITE setOutputStyle)
+  PYB11_PROPERTY(QString BinaryOutputPath READ getBinaryOutputPath WRITE setBinaryOutputPath)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -171,6 +172,18 @@ public:
 
   Q_PROPERTY(int OutputStyle READ getOutputStyle WRITE setOutputStyle)
 
+  /**
+   * @brief Setter property for BinaryOutputPath
+   */
+  void setBinaryOutputPath(const QString& value);
+  /**
+   * @brief Getter property for BinaryOutputPath
+   * @return Value of BinaryOutputPath
+   */
+  QString getBinaryOutputPath() const;
+
+  Q_PROPERTY(QString BinaryOutputPath READ getBinaryOutputPath WRITE setBinaryOutputPath)
+
   enum DelimiterType
   {
     Comma = 0,
@@ -183,7 +196,8 @@ public:
   enum OutputType
   {
     MultiFile = 0,
-    SingleFile = 1
+    SingleFile = 1,
+    BinaryColumns = 2
   };
 
   /**
@@ -261,6 +275,7 @@ private:
   QString m_FileExtension = {".txt"};
   int m_MaxValPerLine = {-1};
   int m_OutputStyle = {};
+  QString m_BinaryOutputPath = {};
 
   /**
    * @brief lookupDelimiter Returns the char representation for the
@@ -290,6 +305,18 @@ private:
    */
   void writeSingleFileOutput();
 
+  /**
+   * @brief writeBinaryColumnsOutput Writes each array as a raw binary column file
+   * and a JSON manifest describing the columns
+   */
+  void writeBinaryColumnsOutput();
+
+  /**
+   * @brief writeBinaryFile Writes the bytes to a new file
+   * @return false if the file could not be written. The error condition is set.
+   */
+  bool writeBinaryFile(const QString& outputFile, const void* data, size_t numBytes);
+
 public:
   WriteASCIIData(const WriteASCIIData&) = delete;            // Copy Constructor Not Implemented
   WriteASCIIData(WriteASCIIData&&) = delete;                 // Move Constructor Not Implemented
@@ -49,6 +49,7 @@
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
+#include "SIMPLib/Utilities/ParallelTextWriter.h"
 
 #define WRITE_EDGES_FILE 0
 
@@ -201,19 +202,23 @@ void WriteTriangleGeometry::execute()
   outFileNodes << "# Node Data is X Y Z space delimited.\n";
   outFileNodes << "Node Count: " << numNodes << "\n";
 
-  outFileNodes.setFieldWidth(8);
-  outFileNodes.setRealNumberPrecision(5);
-  outFileNodes.setRealNumberNotation(QTextStream::FixedNotation);
-
-  for(size_t i = 0; i < numNodes; i++)
+  // Each coordinate is written in fixed notation with 5 decimals, right aligned in 8 characters
+  outFileNodes.flush();
+  ParallelTextWriter textWriter;
+  bool written = textWriter.writeRows(fileNodes, 0, numNodes, [nodes](size_t i, std::string& buffer) {
+    ParallelTextWriter::AppendFixed(buffer, nodes[i * 3], 5, 8);
+    buffer.push_back(' ');
+    ParallelTextWriter::AppendFixed(buffer, nodes[i * 3 + 1], 5, 8);
+    buffer.push_back(' ');
+    ParallelTextWriter::AppendFixed(buffer, nodes[i * 3 + 2], 5, 8);
+    buffer.push_back('\n');
+  });
+
+  if(!written)
   {
-    outFileNodes.setFieldWidth(8);
-    outFileNodes << nodes[i * 3] << qSetFieldWidth(0);
-    outFileNodes << " " << qSetFieldWidth(8);
-    outFileNodes << nodes[i * 3 + 1] << qSetFieldWidth(0);
-    outFileNodes << " " << qSetFieldWidth(8);
-    outFileNodes << nodes[i * 3 + 2] << qSetFieldWidth(0);
-    outFileNodes << "\n";
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getOutputNodesFile());
+    setErrorCondition(-101, ss);
+    return;
   }
 
   fileNodes.close();
@@ -252,14 +257,21 @@ void WriteTriangleGeometry::execute()
   outFileTri << "Max Node Id: " << maxNodeId << "\n";
   outFileTri << "Triangle Count: " << numTriangles << "\n";
 
-  int n1, n2, n3;
-  for(size_t j = 0; j < numTriangles; ++j)
+  outFileTri.flush();
+  written = textWriter.writeRows(fileTri, 0, numTriangles, [triangles](size_t j, std::string& buffer) {
+    ParallelTextWriter::AppendValue(buffer, triangles[j * 3]);
+    buffer.push_back(' ');
+    ParallelTextWriter::AppendValue(buffer, triangles[j * 3 + 1]);
+    buffer.push_back(' ');
+    ParallelTextWriter::AppendValue(buffer, triangles[j * 3 + 2]);
+    buffer.push_back('\n');
+  });
+
+  if(!written)
   {
-    n1 = triangles[j * 3];
-    n2 = triangles[j * 3 + 1];
-    n3 = triangles[j * 3 + 2];
-
-    outFileTri << n1 << " " << n2 << " " << n3 << "\n";
+    QString ss = QObject::tr("Error writing to the output file: %1").arg(getOutputTrianglesFile());
+    setErrorCondition(-101, ss);
+    return;
   }
 
   fileTri.close();
@@ -0,0 +1,430 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ASCIIDataStreamParser.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <QtCore/QFile>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+using TokenList = std::vector<std::pair<const char*, const char*>>;
+
+/**
+ * @brief The Chunk struct is a line aligned part of a block
+ */
+struct Chunk
+{
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  size_t numLines = 0;
+  size_t firstLine = 0;
+};
+
+/**
+ * @brief The CountLinesImpl class counts the lines of each chunk. A chunk that does not end with a
+ * new line can only be the end of the file and still holds one more line.
+ */
+class CountLinesImpl
+{
+public:
+  CountLinesImpl(std::vector<Chunk>& chunks)
+  : m_Chunks(chunks)
+  {
+  }
+  CountLinesImpl(const CountLinesImpl&) = default;           // Copy Constructor Not Implemented
+  CountLinesImpl(CountLinesImpl&&) = default;                // Move Constructor Not Implemented
+  CountLinesImpl& operator=(const CountLinesImpl&) = delete; // Copy Assignment Not Implemented
+  CountLinesImpl& operator=(CountLinesImpl&&) = delete;      // Move Assignment Not Implemented
+  ~CountLinesImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      Chunk& chunk = m_Chunks[i];
+      chunk.numLines = static_cast<size_t>(std::count(chunk.begin, chunk.end, '\n'));
+      if(chunk.end != chunk.begin && *(chunk.end - 1) != '\n')
+      {
+        chunk.numLines++;
+      }
+    }
+  }
+
+private:
+  std::vector<Chunk>& m_Chunks;
+};
+
+/**
+ * @brief The ParseChunksImpl class parses the lines of each chunk and records the first error of each chunk
+ */
+class ParseChunksImpl
+{
+public:
+  ParseChunksImpl(const ASCIIDataStreamParser* parser, const std::vector<Chunk>& chunks, int lineNumber, size_t tupleIndex, size_t maxLines,
+                  std::vector<ASCIIDataStreamParser::ParseError>& errors)
+  : m_Parser(parser)
+  , m_Chunks(chunks)
+  , m_LineNumber(lineNumber)
+  , m_TupleIndex(tupleIndex)
+  , m_MaxLines(maxLines)
+  , m_Errors(errors)
+  {
+  }
+  ParseChunksImpl(const ParseChunksImpl&) = default;           // Copy Constructor Not Implemented
+  ParseChunksImpl(ParseChunksImpl&&) = default;                // Move Constructor Not Implemented
+  ParseChunksImpl& operator=(const ParseChunksImpl&) = delete; // Copy Assignment Not Implemented
+  ParseChunksImpl& operator=(ParseChunksImpl&&) = delete;      // Move Assignment Not Implemented
+  ~ParseChunksImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const Chunk& chunk = m_Chunks[i];
+      size_t numLines = std::min(chunk.numLines, m_MaxLines - chunk.firstLine);
+      m_Errors[i] = m_Parser->parseLines(chunk.begin, chunk.end, m_LineNumber + static_cast<int>(chunk.firstLine), m_TupleIndex + chunk.firstLine, numLines);
+    }
+  }
+
+private:
+  const ASCIIDataStreamParser* m_Parser = nullptr;
+  const std::vector<Chunk>& m_Chunks;
+  int m_LineNumber = 0;
+  size_t m_TupleIndex = 0;
+  size_t m_MaxLines = 0;
+  std::vector<ASCIIDataStreamParser::ParseError>& m_Errors;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ASCIIDataStreamParser::ASCIIDataStreamParser(const QList<AbstractDataParser::Pointer>& parsers, int numColumns, const QList<char>& delimiters)
+: m_Parsers(parsers)
+, m_NumColumns(numColumns)
+, m_HasDelimiters(!delimiters.isEmpty())
+{
+  for(char delimiter : delimiters)
+  {
+    m_IsDelimiter[static_cast<unsigned char>(delimiter)] = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ASCIIDataStreamParser::~ASCIIDataStreamParser() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ASCIIDataStreamParser::setBlockSize(size_t value)
+{
+  m_BlockSize = std::max<size_t>(value, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ASCIIDataStreamParser::getBlockSize() const
+{
+  return m_BlockSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ASCIIDataStreamParser::tokenize(const char* begin, const char* end, TokenList& tokens) const
+{
+  tokens.clear();
+  if(!m_HasDelimiters)
+  {
+    tokens.emplace_back(begin, end);
+    return;
+  }
+
+  const char* tokenBegin = begin;
+  for(const char* c = begin; c != end; ++c)
+  {
+    if(m_IsDelimiter[static_cast<unsigned char>(*c)])
+    {
+      if(c != tokenBegin)
+      {
+        tokens.emplace_back(tokenBegin, c);
+      }
+      tokenBegin = c + 1;
+    }
+  }
+  if(tokenBegin != end)
+  {
+    tokens.emplace_back(tokenBegin, end);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ASCIIDataStreamParser::ParseError ASCIIDataStreamParser::parseLine(const char* begin, const char* end, int lineNumber, size_t tupleIndex, TokenList& tokens) const
+{
+  ParseError error;
+  tokenize(begin, end, tokens);
+  if(tokens.size() != static_cast<size_t>(m_NumColumns))
+  {
+    error.type = ErrorType::InconsistentColumns;
+    error.lineNumber = lineNumber;
+    error.tokenCount = static_cast<int>(tokens.size());
+    error.line = QString::fromUtf8(begin, static_cast<int>(end - begin));
+    return error;
+  }
+
+  for(const AbstractDataParser::Pointer& parser : m_Parsers)
+  {
+    int index = parser->getColumnIndex();
+    ParserFunctor::ErrorObject obj = parser->parse(tokens[index].first, tokens[index].second, tupleIndex);
+    if(!obj.ok)
+    {
+      error.type = ErrorType::ConversionFailure;
+      error.lineNumber = lineNumber;
+      error.columnIndex = index;
+      error.message = obj.errorMessage;
+      return error;
+    }
+  }
+  return error;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ASCIIDataStreamParser::ParseError ASCIIDataStreamParser::parseLines(const char* begin, const char* end, int lineNumber, size_t tupleIndex, size_t maxLines) const
+{
+  TokenList tokens;
+  tokens.reserve(static_cast<size_t>(m_NumColumns));
+
+  const char* lineBegin = begin;
+  for(size_t i = 0; i < maxLines && lineBegin < end; i++)
+  {
+    const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', static_cast<size_t>(end - lineBegin)));
+    const char* nextLine = (nullptr == lineEnd) ? end : lineEnd + 1;
+    if(nullptr == lineEnd)
+    {
+      lineEnd = end;
+    }
+    if(lineEnd != lineBegin && *(lineEnd - 1) == '\r')
+    {
+      --lineEnd;
+    }
+
+    ParseError error = parseLine(lineBegin, lineEnd, lineNumber + static_cast<int>(i), tupleIndex + i, tokens);
+    if(error.type != ErrorType::None)
+    {
+      return error;
+    }
+    lineBegin = nextLine;
+  }
+  return ParseError();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ASCIIDataStreamParser::ParseError ASCIIDataStreamParser::parseBlock(const char* begin, const char* end, int lineNumber, size_t tupleIndex, size_t maxLines, size_t& linesParsed) const
+{
+  linesParsed = 0;
+
+  // Split the block into chunks that each end on a line boundary
+  std::vector<Chunk> chunks;
+  const char* chunkBegin = begin;
+  while(chunkBegin < end)
+  {
+    const char* chunkEnd = end;
+    if(static_cast<size_t>(end - chunkBegin) > k_ChunkSize)
+    {
+      const char* newLine = static_cast<const char*>(std::memchr(chunkBegin + k_ChunkSize - 1, '\n', static_cast<size_t>(end - chunkBegin) - k_ChunkSize + 1));
+      chunkEnd = (nullptr == newLine) ? end : newLine + 1;
+    }
+    Chunk chunk;
+    chunk.begin = chunkBegin;
+    chunk.end = chunkEnd;
+    chunks.push_back(chunk);
+    chunkBegin = chunkEnd;
+  }
+
+  ParallelDataAlgorithm countAlg;
+  countAlg.setRange(0, chunks.size());
+  countAlg.execute(CountLinesImpl(chunks));
+
+  // Assign the first line of each chunk and drop the chunks past the last requested line
+  size_t numChunks = 0;
+  for(Chunk& chunk : chunks)
+  {
+    if(linesParsed >= maxLines)
+    {
+      break;
+    }
+    chunk.firstLine = linesParsed;
+    linesParsed += chunk.numLines;
+    numChunks++;
+  }
+  chunks.resize(numChunks);
+  linesParsed = std::min(linesParsed, maxLines);
+
+  std::vector<ParseError> errors(chunks.size());
+  ParallelDataAlgorithm parseAlg;
+  parseAlg.setRange(0, chunks.size());
+  parseAlg.execute(ParseChunksImpl(this, chunks, lineNumber, tupleIndex, maxLines, errors));
+
+  // Chunks are in file order, so the first chunk with an error holds the lowest line number
+  for(const ParseError& error : errors)
+  {
+    if(error.type != ErrorType::None)
+    {
+      return error;
+    }
+  }
+  return ParseError();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ASCIIDataStreamParser::ParseError ASCIIDataStreamParser::parse(const QString& filePath, int beginIndex, int numLines, AbstractFilter* filter) const
+{
+  ParseError error;
+
+  QFile inputFile(filePath);
+  if(!inputFile.open(QIODevice::ReadOnly))
+  {
+    error.type = ErrorType::FileOpenFailed;
+    return error;
+  }
+
+  // QTextStream drops a UTF-8 byte order mark, so do the same
+  if(inputFile.peek(3) == QByteArray("\xEF\xBB\xBF", 3))
+  {
+    inputFile.read(3);
+  }
+
+  for(int i = 1; i < beginIndex; i++)
+  {
+    // Skip to the first data line
+    inputFile.readLine();
+  }
+
+  const size_t numTuples = (numLines >= beginIndex) ? static_cast<size_t>(numLines - beginIndex + 1) : 0;
+  size_t tupleIndex = 0;
+  int lineNumber = beginIndex;
+  float threshold = 0.0f;
+
+  std::vector<char> buffer;
+  size_t bufferedBytes = 0;
+  bool atEnd = false;
+  while(tupleIndex < numTuples && !atEnd)
+  {
+    // Append the next block behind the partial line left over from the previous block
+    buffer.resize(bufferedBytes + m_BlockSize);
+    qint64 bytesRead = inputFile.read(buffer.data() + bufferedBytes, static_cast<qint64>(m_BlockSize));
+    bufferedBytes += static_cast<size_t>(std::max<qint64>(bytesRead, 0));
+    atEnd = (bytesRead <= 0 || inputFile.atEnd());
+
+    const char* begin = buffer.data();
+    const char* end = begin + bufferedBytes;
+    const char* blockEnd = end;
+    if(!atEnd)
+    {
+      // Only parse complete lines; the rest is carried over to the next block
+      const char* lastNewLine = end;
+      while(lastNewLine != begin && *(lastNewLine - 1) != '\n')
+      {
+        --lastNewLine;
+      }
+      if(lastNewLine == begin)
+      {
+        // The line is longer than a block, so keep reading
+        continue;
+      }
+      blockEnd = lastNewLine;
+    }
+
+    size_t linesParsed = 0;
+    error = parseBlock(begin, blockEnd, lineNumber, tupleIndex, numTuples - tupleIndex, linesParsed);
+    if(error.type != ErrorType::None)
+    {
+      return error;
+    }
+    tupleIndex += linesParsed;
+    lineNumber += static_cast<int>(linesParsed);
+
+    bufferedBytes = static_cast<size_t>(end - blockEnd);
+    std::memmove(buffer.data(), blockEnd, bufferedBytes);
+
+    if(nullptr != filter)
+    {
+      const float percentCompleted = (static_cast<float>(tupleIndex) / numTuples) * 100.0f;
+      if(percentCompleted > threshold)
+      {
+        // Print the status of the import
+        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg(static_cast<double>(percentCompleted), 0, 'f', 0);
+        filter->notifyStatusMessage(ss);
+        threshold = percentCompleted + 5.0f;
+      }
+
+      if(filter->getCancel())
+      {
+        error.type = ErrorType::Canceled;
+        return error;
+      }
+    }
+  }
+
+  // Like QTextStream::readLine(), lines past the end of the file are read as empty lines
+  TokenList tokens;
+  const char emptyLine = '\0';
+  for(; tupleIndex < numTuples; tupleIndex++, lineNumber++)
+  {
+    error = parseLine(&emptyLine, &emptyLine, lineNumber, tupleIndex, tokens);
+    if(error.type != ErrorType::None)
+    {
+      return error;
+    }
+  }
+
+  return error;
+}
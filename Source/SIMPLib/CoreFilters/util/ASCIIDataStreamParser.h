@@ -0,0 +1,177 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
+
+class AbstractFilter;
+
+/**
+ * @brief The ASCIIDataStreamParser class reads delimited ASCII data for ReadASCIIData. The file is read in
+ * large blocks instead of line by line; each block is split into line aligned chunks that are tokenized
+ * and converted in parallel directly from the raw bytes. Tokens are split exactly like
+ * StringOperations::TokenizeString() and converted with AbstractDataParser::parse(const char*, const char*, size_t),
+ * so the values and error messages are the same as when the file is read line by line.
+ */
+class SIMPLib_EXPORT ASCIIDataStreamParser
+{
+public:
+  using Self = ASCIIDataStreamParser;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+
+  /**
+   * @brief Default number of bytes read from the file at once
+   */
+  static constexpr size_t k_DefaultBlockSize = 64 * 1024 * 1024;
+
+  /**
+   * @brief Approximate number of bytes each parallel chunk of a block covers
+   */
+  static constexpr size_t k_ChunkSize = 1024 * 1024;
+
+  enum class ErrorType
+  {
+    None,
+    FileOpenFailed,
+    InconsistentColumns,
+    ConversionFailure,
+    Canceled
+  };
+
+  /**
+   * @brief The ParseError struct describes the first problem found in the file. If several chunks report
+   * an error, the one with the lowest line number is kept so the result matches a sequential read.
+   */
+  struct ParseError
+  {
+    ErrorType type = ErrorType::None;
+    int lineNumber = 0;
+    int columnIndex = 0;
+    int tokenCount = 0;
+    QString line;
+    QString message;
+  };
+
+  /**
+   * @brief Constructor
+   * @param parsers One parser per column that should be stored
+   * @param numColumns Number of columns every line must have
+   * @param delimiters The delimiter characters
+   */
+  ASCIIDataStreamParser(const QList<AbstractDataParser::Pointer>& parsers, int numColumns, const QList<char>& delimiters);
+
+  virtual ~ASCIIDataStreamParser();
+
+  /**
+   * @brief Sets the number of bytes read from the file at once
+   * @param value
+   */
+  void setBlockSize(size_t value);
+
+  /**
+   * @brief Returns the number of bytes read from the file at once
+   * @return
+   */
+  size_t getBlockSize() const;
+
+  /**
+   * @brief Parses lines beginIndex through numLines (1 based, inclusive) of the file. Line 'beginIndex' is
+   * stored at tuple 0. The filter, if any, receives the progress messages and is checked for cancellation
+   * after each block.
+   * @param filePath
+   * @param beginIndex
+   * @param numLines
+   * @param filter
+   * @return
+   */
+  ParseError parse(const QString& filePath, int beginIndex, int numLines, AbstractFilter* filter = nullptr) const;
+
+  /**
+   * @brief Parses the lines in [begin, end), the first of which is line 'lineNumber' and is stored at
+   * tuple 'tupleIndex'. At most 'maxLines' lines are parsed. Parsing stops at the first error.
+   * @param begin
+   * @param end
+   * @param lineNumber
+   * @param tupleIndex
+   * @param maxLines
+   * @return
+   */
+  ParseError parseLines(const char* begin, const char* end, int lineNumber, size_t tupleIndex, size_t maxLines) const;
+
+  /**
+   * @brief Splits [begin, end) into tokens exactly like StringOperations::TokenizeString(): the line is
+   * split on every delimiter and empty tokens are dropped. If there are no delimiters the whole line is a
+   * single token.
+   * @param begin
+   * @param end
+   * @param tokens
+   */
+  void tokenize(const char* begin, const char* end, std::vector<std::pair<const char*, const char*>>& tokens) const;
+
+private:
+  QList<AbstractDataParser::Pointer> m_Parsers;
+  int m_NumColumns = 0;
+  bool m_HasDelimiters = false;
+  std::array<bool, 256> m_IsDelimiter = {};
+  size_t m_BlockSize = k_DefaultBlockSize;
+
+  /**
+   * @brief Tokenizes and converts a single line that does not include its line ending
+   */
+  ParseError parseLine(const char* begin, const char* end, int lineNumber, size_t tupleIndex, std::vector<std::pair<const char*, const char*>>& tokens) const;
+
+  /**
+   * @brief Parses a block that holds complete lines using all available threads
+   */
+  ParseError parseBlock(const char* begin, const char* end, int lineNumber, size_t tupleIndex, size_t maxLines, size_t& linesParsed) const;
+
+public:
+  ASCIIDataStreamParser(const ASCIIDataStreamParser&) = delete;            // Copy Constructor Not Implemented
+  ASCIIDataStreamParser(ASCIIDataStreamParser&&) = delete;                 // Move Constructor Not Implemented
+  ASCIIDataStreamParser& operator=(const ASCIIDataStreamParser&) = delete; // Copy Assignment Not Implemented
+  ASCIIDataStreamParser& operator=(ASCIIDataStreamParser&&) = delete;      // Move Assignment Not Implemented
+};
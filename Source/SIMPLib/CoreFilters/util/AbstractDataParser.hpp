@@ -29,6 +29,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <utility>
+
 #include <QtCore/QString>
 
 #include "SIMPLib/SIMPLib.h"
@@ -100,6 +102,19 @@ public:
 
   virtual ParserFunctor::ErrorObject parse(const QString& token, size_t index) = 0;
 
+  /**
+   * @brief Parses the UTF-8 token [first, last) into the given index. The default implementation
+   * converts the token to a QString and calls the QString overload.
+   * @param first
+   * @param last
+   * @param index
+   * @return
+   */
+  virtual ParserFunctor::ErrorObject parse(const char* first, const char* last, size_t index)
+  {
+    return parse(QString::fromUtf8(first, static_cast<int>(last - first)), index);
+  }
+
 protected:
   AbstractDataParser() = default;
 
@@ -120,6 +135,7 @@ class Parser : public AbstractDataParser
 {
 public:
   using SelfType = Parser<ArrayType, F>;
+  using ValueType = decltype(F()(std::declval<const QString&>(), std::declval<ParserFunctor::ErrorObject&>()));
 
   using Self = SelfType;
   using Pointer = std::shared_ptr<Self>;
@@ -177,6 +193,19 @@ public:
     return obj;
   }
 
+  ParserFunctor::ErrorObject parse(const char* first, const char* last, size_t index) override
+  {
+    ValueType value = {};
+    if(ParserFunctor::FromChars(first, last, value))
+    {
+      ParserFunctor::ErrorObject obj;
+      obj.ok = true;
+      (*m_Ptr).setValue(index, value);
+      return obj;
+    }
+    return parse(QString::fromUtf8(first, static_cast<int>(last - first)), index);
+  }
+
 protected:
   Parser(typename ArrayType::Pointer ptr, const QString& name, int index)
   {
@@ -0,0 +1,610 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "CalculatorKernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "CoreFilters/util/ABSOperator.h"
+#include "CoreFilters/util/ACosOperator.h"
+#include "CoreFilters/util/ASinOperator.h"
+#include "CoreFilters/util/ATanOperator.h"
+#include "CoreFilters/util/AdditionOperator.h"
+#include "CoreFilters/util/CeilOperator.h"
+#include "CoreFilters/util/CosOperator.h"
+#include "CoreFilters/util/DivisionOperator.h"
+#include "CoreFilters/util/ExpOperator.h"
+#include "CoreFilters/util/FloorOperator.h"
+#include "CoreFilters/util/ICalculatorArray.h"
+#include "CoreFilters/util/LnOperator.h"
+#include "CoreFilters/util/Log10Operator.h"
+#include "CoreFilters/util/LogOperator.h"
+#include "CoreFilters/util/MultiplicationOperator.h"
+#include "CoreFilters/util/NegativeOperator.h"
+#include "CoreFilters/util/PowOperator.h"
+#include "CoreFilters/util/RootOperator.h"
+#include "CoreFilters/util/SinOperator.h"
+#include "CoreFilters/util/SqrtOperator.h"
+#include "CoreFilters/util/SubtractionOperator.h"
+#include "CoreFilters/util/TanOperator.h"
+
+namespace
+{
+using LoadFunctionType = void (*)(const void* data, size_t stride, size_t offset, size_t start, size_t count, double* dest);
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void LoadValues(const void* data, size_t stride, size_t offset, size_t start, size_t count, double* dest)
+{
+  const T* src = static_cast<const T*>(data) + start * stride + offset;
+  if(stride == 1)
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      dest[i] = static_cast<double>(src[i]);
+    }
+  }
+  else
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      dest[i] = static_cast<double>(src[i * stride]);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+bool IsArrayOfType(const IDataArray::Pointer& array)
+{
+  return nullptr != std::dynamic_pointer_cast<DataArray<T>>(array);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LoadFunctionType FindLoadFunction(const IDataArray::Pointer& array)
+{
+  if(IsArrayOfType<float>(array))
+  {
+    return &LoadValues<float>;
+  }
+  if(IsArrayOfType<double>(array))
+  {
+    return &LoadValues<double>;
+  }
+  if(IsArrayOfType<int8_t>(array))
+  {
+    return &LoadValues<int8_t>;
+  }
+  if(IsArrayOfType<uint8_t>(array))
+  {
+    return &LoadValues<uint8_t>;
+  }
+  if(IsArrayOfType<int16_t>(array))
+  {
+    return &LoadValues<int16_t>;
+  }
+  if(IsArrayOfType<uint16_t>(array))
+  {
+    return &LoadValues<uint16_t>;
+  }
+  if(IsArrayOfType<int32_t>(array))
+  {
+    return &LoadValues<int32_t>;
+  }
+  if(IsArrayOfType<uint32_t>(array))
+  {
+    return &LoadValues<uint32_t>;
+  }
+  if(IsArrayOfType<int64_t>(array))
+  {
+    return &LoadValues<int64_t>;
+  }
+  if(IsArrayOfType<uint64_t>(array))
+  {
+    return &LoadValues<uint64_t>;
+  }
+  if(IsArrayOfType<bool>(array))
+  {
+    return &LoadValues<bool>;
+  }
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Func>
+inline void ApplyUnary(double* values, size_t count, Func func)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = func(values[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Func>
+inline void ApplyBinary(double* left, const double* right, size_t count, Func func)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    left[i] = func(left[i], right[i]);
+  }
+}
+
+/**
+ * @brief The CalculatorKernelImpl class evaluates a CalculatorKernel over a range of tuples and
+ * stores the results into an output buffer of type T.
+ */
+template <typename T>
+class CalculatorKernelImpl
+{
+public:
+  CalculatorKernelImpl(const CalculatorKernel* kernel, T* output, size_t numComps)
+  : m_Kernel(kernel)
+  , m_Output(output)
+  , m_NumComps(numComps)
+  {
+  }
+  CalculatorKernelImpl(const CalculatorKernelImpl&) = default;           // Copy Constructor Not Implemented
+  CalculatorKernelImpl(CalculatorKernelImpl&&) = default;                // Move Constructor Not Implemented
+  CalculatorKernelImpl& operator=(const CalculatorKernelImpl&) = delete; // Copy Assignment Not Implemented
+  CalculatorKernelImpl& operator=(CalculatorKernelImpl&&) = delete;      // Move Assignment Not Implemented
+  ~CalculatorKernelImpl() = default;
+
+  void convert(size_t start, size_t end) const
+  {
+    std::vector<double> scratch(m_Kernel->getStackDepth() * CalculatorKernel::k_BlockSize);
+    for(size_t blockStart = start; blockStart < end; blockStart += CalculatorKernel::k_BlockSize)
+    {
+      size_t count = std::min(CalculatorKernel::k_BlockSize, end - blockStart);
+      const double* result = m_Kernel->evaluateBlock(blockStart, count, scratch.data());
+      T* dest = m_Output + blockStart;
+      for(size_t i = 0; i < count; i++)
+      {
+        dest[i] = static_cast<T>(result[i]);
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    convert(range.min() * m_NumComps, range.max() * m_NumComps);
+  }
+
+private:
+  const CalculatorKernel* m_Kernel = nullptr;
+  T* m_Output = nullptr;
+  size_t m_NumComps = 1;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+bool ExecuteKernel(const CalculatorKernel* kernel, const IDataArray::Pointer& outputArray, size_t numTuples, size_t numComps)
+{
+  typename DataArray<T>::Pointer output = std::dynamic_pointer_cast<DataArray<T>>(outputArray);
+  if(nullptr == output)
+  {
+    return false;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.execute(CalculatorKernelImpl<T>(kernel, output->getPointer(0), numComps));
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::CalculatorKernel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::~CalculatorKernel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::Pointer CalculatorKernel::Compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees, size_t numTuples, size_t numComps)
+{
+  Pointer kernel(new CalculatorKernel());
+  kernel->m_NumTuples = numTuples;
+  kernel->m_NumComps = numComps;
+
+  std::vector<Instruction>& instructions = kernel->m_Instructions;
+  size_t depth = 0;
+
+  for(const CalculatorItem::Pointer& item : rpn)
+  {
+    ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(item);
+    if(nullptr != calcArray)
+    {
+      if(calcArray->getType() == ICalculatorArray::Number)
+      {
+        IDataArray::Pointer numberArray = calcArray->getArray();
+        if(nullptr == numberArray || !numberArray->isAllocated() || numberArray->getSize() == 0)
+        {
+          return NullPointer();
+        }
+        instructions.push_back({OpCode::PushConstant, 0, calcArray->getValue(0)});
+      }
+      else
+      {
+        if(!kernel->addInput(calcArray->getSourceArray(), calcArray->getSourceComponent()))
+        {
+          return NullPointer();
+        }
+        instructions.push_back({OpCode::PushInput, kernel->m_Inputs.size() - 1, 0.0});
+      }
+      depth++;
+      kernel->m_StackDepth = std::max(kernel->m_StackDepth, depth);
+      continue;
+    }
+
+    size_t numArgs = 1;
+    if(nullptr != std::dynamic_pointer_cast<NegativeOperator>(item))
+    {
+      instructions.push_back({OpCode::Negate, 0, 0.0});
+    }
+    else if(nullptr != std::dynamic_pointer_cast<AdditionOperator>(item))
+    {
+      instructions.push_back({OpCode::Add, 0, 0.0});
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<SubtractionOperator>(item))
+    {
+      instructions.push_back({OpCode::Subtract, 0, 0.0});
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<MultiplicationOperator>(item))
+    {
+      instructions.push_back({OpCode::Multiply, 0, 0.0});
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<DivisionOperator>(item))
+    {
+      instructions.push_back({OpCode::Divide, 0, 0.0});
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<PowOperator>(item))
+    {
+      instructions.push_back({OpCode::Pow, 0, 0.0});
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<RootOperator>(item))
+    {
+      instructions.push_back({OpCode::Root, 0, 0.0});
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<LogOperator>(item))
+    {
+      instructions.push_back({OpCode::Log, 0, 0.0});
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ABSOperator>(item))
+    {
+      instructions.push_back({OpCode::Abs, 0, 0.0});
+    }
+    else if(nullptr != std::dynamic_pointer_cast<SqrtOperator>(item))
+    {
+      instructions.push_back({OpCode::Sqrt, 0, 0.0});
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ExpOperator>(item))
+    {
+      instructions.push_back({OpCode::Exp, 0, 0.0});
+    }
+    else if(nullptr != std::dynamic_pointer_cast<LnOperator>(item))
+    {
+      instructions.push_back({OpCode::Ln, 0, 0.0});
+    }
+    else if(nullptr != std::dynamic_pointer_cast<Log10Operator>(item))
+    {
+      instructions.push_back({OpCode::Log10, 0, 0.0});
+    }
+    else if(nullptr != std::dynamic_pointer_cast<FloorOperator>(item))
+    {
+      instructions.push_back({OpCode::Floor, 0, 0.0});
+    }
+    else if(nullptr != std::dynamic_pointer_cast<CeilOperator>(item))
+    {
+      instructions.push_back({OpCode::Ceil, 0, 0.0});
+    }
+    else if(nullptr != std::dynamic_pointer_cast<SinOperator>(item) || nullptr != std::dynamic_pointer_cast<CosOperator>(item) || nullptr != std::dynamic_pointer_cast<TanOperator>(item))
+    {
+      // Trigonometric operators convert their argument from degrees
+      if(useDegrees)
+      {
+        instructions.push_back({OpCode::Scale, 0, M_PI / 180.0});
+      }
+      OpCode op = OpCode::Tan;
+      if(nullptr != std::dynamic_pointer_cast<SinOperator>(item))
+      {
+        op = OpCode::Sin;
+      }
+      else if(nullptr != std::dynamic_pointer_cast<CosOperator>(item))
+      {
+        op = OpCode::Cos;
+      }
+      instructions.push_back({op, 0, 0.0});
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ASinOperator>(item) || nullptr != std::dynamic_pointer_cast<ACosOperator>(item) || nullptr != std::dynamic_pointer_cast<ATanOperator>(item))
+    {
+      OpCode op = OpCode::ATan;
+      if(nullptr != std::dynamic_pointer_cast<ASinOperator>(item))
+      {
+        op = OpCode::ASin;
+      }
+      else if(nullptr != std::dynamic_pointer_cast<ACosOperator>(item))
+      {
+        op = OpCode::ACos;
+      }
+      instructions.push_back({op, 0, 0.0});
+
+      // Inverse trigonometric operators convert their result to degrees
+      if(useDegrees)
+      {
+        instructions.push_back({OpCode::Scale, 0, 180.0 / M_PI});
+      }
+    }
+    else
+    {
+      // Unknown item; let the caller evaluate the expression operator by operator
+      return NullPointer();
+    }
+
+    if(depth < numArgs)
+    {
+      return NullPointer();
+    }
+    depth -= numArgs - 1;
+  }
+
+  if(depth != 1)
+  {
+    return NullPointer();
+  }
+
+  return kernel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::addInput(const IDataArray::Pointer& array, int component)
+{
+  if(nullptr == array || array->getNumberOfTuples() != m_NumTuples || !array->isAllocated())
+  {
+    return false;
+  }
+
+  Input input;
+  input.array = array;
+  input.data = array->getVoidPointer(0);
+  input.load = FindLoadFunction(array);
+  if(nullptr == input.load)
+  {
+    return false;
+  }
+
+  size_t arrayComps = static_cast<size_t>(array->getNumberOfComponents());
+  if(component < 0)
+  {
+    // Every component of the array is used
+    if(arrayComps != m_NumComps)
+    {
+      return false;
+    }
+    input.stride = 1;
+    input.offset = 0;
+  }
+  else
+  {
+    // A single component of the array is used, so the expression has one component per tuple
+    if(m_NumComps != 1 || static_cast<size_t>(component) >= arrayComps)
+    {
+      return false;
+    }
+    input.stride = arrayComps;
+    input.offset = static_cast<size_t>(component);
+  }
+
+  m_Inputs.push_back(input);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<CalculatorKernel::Instruction>& CalculatorKernel::getInstructions() const
+{
+  return m_Instructions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t CalculatorKernel::getStackDepth() const
+{
+  return m_StackDepth;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::execute(const IDataArray::Pointer& outputArray) const
+{
+  if(nullptr == outputArray || outputArray->getSize() != m_NumTuples * m_NumComps)
+  {
+    return false;
+  }
+
+  return ExecuteKernel<float>(this, outputArray, m_NumTuples, m_NumComps) || ExecuteKernel<double>(this, outputArray, m_NumTuples, m_NumComps) ||
+         ExecuteKernel<int8_t>(this, outputArray, m_NumTuples, m_NumComps) || ExecuteKernel<uint8_t>(this, outputArray, m_NumTuples, m_NumComps) ||
+         ExecuteKernel<int16_t>(this, outputArray, m_NumTuples, m_NumComps) || ExecuteKernel<uint16_t>(this, outputArray, m_NumTuples, m_NumComps) ||
+         ExecuteKernel<int32_t>(this, outputArray, m_NumTuples, m_NumComps) || ExecuteKernel<uint32_t>(this, outputArray, m_NumTuples, m_NumComps) ||
+         ExecuteKernel<int64_t>(this, outputArray, m_NumTuples, m_NumComps) || ExecuteKernel<uint64_t>(this, outputArray, m_NumTuples, m_NumComps) ||
+         ExecuteKernel<bool>(this, outputArray, m_NumTuples, m_NumComps);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const double* CalculatorKernel::evaluateBlock(size_t start, size_t count, double* scratch) const
+{
+  size_t top = 0;
+  for(const Instruction& instruction : m_Instructions)
+  {
+    // 'values' is the block on top of the stack, 'left' the one below it for binary operators
+    double* values = (top > 0) ? scratch + (top - 1) * k_BlockSize : scratch;
+    double* left = (top > 1) ? scratch + (top - 2) * k_BlockSize : scratch;
+
+    switch(instruction.op)
+    {
+    case OpCode::PushInput:
+    {
+      const Input& input = m_Inputs[instruction.index];
+      input.load(input.data, input.stride, input.offset, start, count, scratch + top * k_BlockSize);
+      top++;
+      break;
+    }
+    case OpCode::PushConstant:
+      std::fill(scratch + top * k_BlockSize, scratch + top * k_BlockSize + count, instruction.value);
+      top++;
+      break;
+    case OpCode::Add:
+      ApplyBinary(left, values, count, [](double l, double r) { return l + r; });
+      top--;
+      break;
+    case OpCode::Subtract:
+      ApplyBinary(left, values, count, [](double l, double r) { return l - r; });
+      top--;
+      break;
+    case OpCode::Multiply:
+      ApplyBinary(left, values, count, [](double l, double r) { return l * r; });
+      top--;
+      break;
+    case OpCode::Divide:
+      ApplyBinary(left, values, count, [](double l, double r) { return l / r; });
+      top--;
+      break;
+    case OpCode::Pow:
+      ApplyBinary(left, values, count, [](double l, double r) { return pow(l, r); });
+      top--;
+      break;
+    case OpCode::Root:
+      ApplyBinary(left, values, count, [](double l, double r) { return (r == 0) ? std::numeric_limits<double>::infinity() : pow(l, 1 / r); });
+      top--;
+      break;
+    case OpCode::Log:
+      ApplyBinary(left, values, count, [](double l, double r) { return log(r) / log(l); });
+      top--;
+      break;
+    case OpCode::Negate:
+      ApplyUnary(values, count, [](double v) { return -1 * v; });
+      break;
+    case OpCode::Scale:
+    {
+      double factor = instruction.value;
+      ApplyUnary(values, count, [factor](double v) { return v * factor; });
+      break;
+    }
+    case OpCode::Abs:
+      ApplyUnary(values, count, [](double v) { return fabs(v); });
+      break;
+    case OpCode::Sqrt:
+      ApplyUnary(values, count, [](double v) { return sqrt(v); });
+      break;
+    case OpCode::Exp:
+      ApplyUnary(values, count, [](double v) { return exp(v); });
+      break;
+    case OpCode::Ln:
+      ApplyUnary(values, count, [](double v) { return log(v); });
+      break;
+    case OpCode::Log10:
+      ApplyUnary(values, count, [](double v) { return log10(v); });
+      break;
+    case OpCode::Floor:
+      ApplyUnary(values, count, [](double v) { return floor(v); });
+      break;
+    case OpCode::Ceil:
+      ApplyUnary(values, count, [](double v) { return ceil(v); });
+      break;
+    case OpCode::Sin:
+      ApplyUnary(values, count, [](double v) { return sin(v); });
+      break;
+    case OpCode::Cos:
+      ApplyUnary(values, count, [](double v) { return cos(v); });
+      break;
+    case OpCode::Tan:
+      ApplyUnary(values, count, [](double v) { return tan(v); });
+      break;
+    case OpCode::ASin:
+      ApplyUnary(values, count, [](double v) { return asin(v); });
+      break;
+    case OpCode::ACos:
+      ApplyUnary(values, count, [](double v) { return acos(v); });
+      break;
+    case OpCode::ATan:
+      ApplyUnary(values, count, [](double v) { return atan(v); });
+      break;
+    }
+  }
+
+  return scratch;
+}
+
+// -----------------------------------------------------------------------------
+CalculatorKernel::Pointer CalculatorKernel::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
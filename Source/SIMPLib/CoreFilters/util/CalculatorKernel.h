@@ -0,0 +1,194 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "CalculatorItem.h"
+
+class IDataArray;
+using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
+
+/**
+ * @brief The CalculatorKernel class compiles the RPN form of an ArrayCalculator expression into a
+ * single fused kernel.  Instead of materializing one double array per operator, the kernel walks the
+ * tuples in small blocks, reads every input array in its native type, evaluates the whole expression
+ * on block-sized scratch buffers and stores the result directly into the output array.  Each operator
+ * is applied as a tight loop over a contiguous block so the compiler can vectorize it, and blocks are
+ * distributed across threads with ParallelDataAlgorithm.
+ */
+class SIMPLib_EXPORT CalculatorKernel
+{
+public:
+  using Self = CalculatorKernel;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Number of values evaluated together by each operator of the kernel
+   */
+  static constexpr size_t k_BlockSize = 1024;
+
+  enum class OpCode
+  {
+    PushInput,
+    PushConstant,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Pow,
+    Root,
+    Log,
+    Negate,
+    Scale,
+    Abs,
+    Sqrt,
+    Exp,
+    Ln,
+    Log10,
+    Floor,
+    Ceil,
+    Sin,
+    Cos,
+    Tan,
+    ASin,
+    ACos,
+    ATan
+  };
+
+  /**
+   * @brief The Instruction struct is one step of the compiled kernel.  PushInput uses 'index' to select
+   * the input, PushConstant and Scale use 'value'.
+   */
+  struct Instruction
+  {
+    OpCode op;
+    size_t index;
+    double value;
+  };
+
+  /**
+   * @brief Compiles the RPN expression into a kernel that produces numTuples * numComps values.
+   * Returns a null pointer if the expression contains an item the kernel cannot evaluate; the caller
+   * is then expected to fall back to the operator-by-operator evaluation.
+   * @param rpn The expression in RPN order, as produced by ArrayCalculator
+   * @param useDegrees True if the trigonometric operators work in degrees
+   * @param numTuples Number of tuples of the output array
+   * @param numComps Number of components of the output array
+   * @return
+   */
+  static Pointer Compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees, size_t numTuples, size_t numComps);
+
+  virtual ~CalculatorKernel();
+
+  /**
+   * @brief Returns the compiled instructions
+   * @return
+   */
+  const std::vector<Instruction>& getInstructions() const;
+
+  /**
+   * @brief Returns the deepest evaluation stack the kernel needs
+   * @return
+   */
+  size_t getStackDepth() const;
+
+  /**
+   * @brief Evaluates the kernel and stores the results into the output array, converting each value
+   * to the output array's type.  The output array must hold numTuples * numComps values.
+   * @param outputArray
+   * @return False if the output array has an unsupported type or the wrong size
+   */
+  bool execute(const IDataArrayShPtrType& outputArray) const;
+
+  /**
+   * @brief Evaluates the instructions for 'count' consecutive values starting at value 'start' using
+   * the given scratch memory, which must hold getStackDepth() * k_BlockSize values.  'count' must not
+   * exceed k_BlockSize.
+   * @param start
+   * @param count
+   * @param scratch
+   * @return Pointer to the block of results inside the scratch memory
+   */
+  const double* evaluateBlock(size_t start, size_t count, double* scratch) const;
+
+protected:
+  CalculatorKernel();
+
+  /**
+   * @brief Loads 'count' values of an input, starting at value 'start', into the destination block
+   */
+  using LoadFunction = void (*)(const void* data, size_t stride, size_t offset, size_t start, size_t count, double* dest);
+
+  /**
+   * @brief The Input struct describes one input array read by the kernel.  Value 'i' of the expression
+   * reads element 'i * stride + offset' of the array.
+   */
+  struct Input
+  {
+    IDataArrayShPtrType array;
+    const void* data;
+    size_t stride;
+    size_t offset;
+    LoadFunction load;
+  };
+
+private:
+  std::vector<Instruction> m_Instructions;
+  std::vector<Input> m_Inputs;
+  size_t m_StackDepth = 0;
+  size_t m_NumTuples = 0;
+  size_t m_NumComps = 1;
+
+  /**
+   * @brief Adds an input array, returning false if its type is not supported
+   */
+  bool addInput(const IDataArrayShPtrType& array, int component);
+
+public:
+  CalculatorKernel(const CalculatorKernel&) = delete;            // Copy Constructor Not Implemented
+  CalculatorKernel(CalculatorKernel&&) = delete;                 // Move Constructor Not Implemented
+  CalculatorKernel& operator=(const CalculatorKernel&) = delete; // Copy Assignment Not Implemented
+  CalculatorKernel& operator=(CalculatorKernel&&) = delete;      // Move Assignment Not Implemented
+};
@@ -45,6 +45,38 @@ ICalculatorArray::ICalculatorArray() = default;
 // -----------------------------------------------------------------------------
 ICalculatorArray::~ICalculatorArray() = default;
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ICalculatorArray::getSourceArray() const
+{
+  return m_SourceArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ICalculatorArray::setSourceArray(const IDataArray::Pointer& array)
+{
+  m_SourceArray = array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ICalculatorArray::getSourceComponent() const
+{
+  return m_SourceComponent;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ICalculatorArray::setSourceComponent(int component)
+{
+  m_SourceComponent = component;
+}
+
 // -----------------------------------------------------------------------------
 ICalculatorArray::Pointer ICalculatorArray::NullPointer()
 {
@@ -71,6 +71,31 @@ public:
 
   virtual DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) = 0;
 
+  /**
+   * @brief Returns the Attribute Array this item reads from, or a null pointer if the item
+   * holds a number or an intermediate result.
+   * @return
+   */
+  IDataArrayShPtrType getSourceArray() const;
+
+  /**
+   * @brief Sets the Attribute Array this item reads from
+   * @param array
+   */
+  void setSourceArray(const IDataArrayShPtrType& array);
+
+  /**
+   * @brief Returns the component of the source array this item reads, or -1 if it reads all components
+   * @return
+   */
+  int getSourceComponent() const;
+
+  /**
+   * @brief Sets the component of the source array this item reads
+   * @param component
+   */
+  void setSourceComponent(int component);
+
 protected:
   ICalculatorArray();
 
@@ -81,4 +106,6 @@ public:
   ICalculatorArray& operator=(ICalculatorArray&&) = delete;      // Move Assignment Not Implemented
 
 private:
+  IDataArrayShPtrType m_SourceArray;
+  int m_SourceComponent = -1;
 };
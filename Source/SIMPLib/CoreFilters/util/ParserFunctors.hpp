@@ -30,6 +30,11 @@
 
 #pragma once
 
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QString>
 
@@ -54,6 +59,71 @@ public:
     bool ok = false;
     QString errorMessage;
   };
+
+  /**
+   * @brief Converts the characters in [first, last) without creating a QString. Only plain decimal
+   * values are accepted here; anything the QString based functors treat specially (octal/hex prefixes,
+   * explicit '+' signs, white space, out of range or non-finite values) returns false so that the caller
+   * can fall back to the functor and produce exactly the same value or error message.
+   * @param first
+   * @param last
+   * @param value
+   * @return
+   */
+  template <typename T>
+  static bool FromChars(const char* first, const char* last, T& value)
+  {
+    if(first == last)
+    {
+      return false;
+    }
+    if constexpr(std::is_integral<T>::value)
+    {
+      const char* digits = (*first == '-') ? first + 1 : first;
+      if(digits == last || (*digits == '0' && last - digits > 1))
+      {
+        return false;
+      }
+      std::from_chars_result result = std::from_chars(first, last, value);
+      return result.ec == std::errc() && result.ptr == last;
+    }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    else if constexpr(std::is_floating_point<T>::value)
+    {
+      // QString::toFloat() converts through a double, so do the same to get identical rounding
+      double dValue = 0.0;
+      std::from_chars_result result = std::from_chars(first, last, dValue);
+      if(result.ec != std::errc() || result.ptr != last || !std::isfinite(dValue) || std::fpclassify(dValue) == FP_SUBNORMAL)
+      {
+        return false;
+      }
+      if(dValue == 0.0)
+      {
+        // Let Qt decide how an underflow to zero is reported
+        for(const char* c = first; c != last && *c != 'e' && *c != 'E'; ++c)
+        {
+          if(*c >= '1' && *c <= '9')
+          {
+            return false;
+          }
+        }
+      }
+      if(std::is_same<T, float>::value)
+      {
+        if(std::fabs(dValue) > static_cast<double>(std::numeric_limits<float>::max()) || (dValue != 0.0 && static_cast<float>(dValue) == 0.0f))
+        {
+          return false;
+        }
+      }
+      value = static_cast<T>(dValue);
+      return true;
+    }
+#endif
+    else
+    {
+      return false;
+    }
+  }
 };
 
 // -----------------------------------------------------------------------------
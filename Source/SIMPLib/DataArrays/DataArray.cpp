@@ -60,16 +60,25 @@
 #define SIMPL_BYTE_SWAP_64(x) bswap_64(x)
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstring>
 #include <functional>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <new>
 #include <numeric>
 #include <string>
 
 #include <hdf5.h>
 
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelTextWriter.h"
 
 namespace
 {
@@ -118,6 +127,344 @@ T byteSwap(T value)
   return value;
 }
 
+/**
+ * @brief Copies tuples srcIndices[i] of the source into tuple i of the destination. Out of range source
+ * indices raise the error flag and are filled like negative ones.
+ */
+template <typename T>
+class GatherTuplesImpl
+{
+public:
+  GatherTuplesImpl(T* dest, const T* source, const int64_t* srcIndices, int64_t numSrcTuples, size_t numComps, T fillValue, std::atomic_bool* error)
+  : m_Dest(dest)
+  , m_Source(source)
+  , m_SrcIndices(srcIndices)
+  , m_NumSrcTuples(numSrcTuples)
+  , m_NumComps(numComps)
+  , m_FillValue(fillValue)
+  , m_Error(error)
+  {
+  }
+  GatherTuplesImpl(const GatherTuplesImpl&) = default;
+  GatherTuplesImpl(GatherTuplesImpl&&) = default;
+  GatherTuplesImpl& operator=(const GatherTuplesImpl&) = delete;
+  GatherTuplesImpl& operator=(GatherTuplesImpl&&) = delete;
+  ~GatherTuplesImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    bool error = false;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const int64_t srcIndex = m_SrcIndices[i];
+      T* destTuple = m_Dest + i * m_NumComps;
+      if(srcIndex >= 0 && srcIndex < m_NumSrcTuples)
+      {
+        std::copy_n(m_Source + static_cast<size_t>(srcIndex) * m_NumComps, m_NumComps, destTuple);
+      }
+      else
+      {
+        error = error || srcIndex >= m_NumSrcTuples;
+        std::fill_n(destTuple, m_NumComps, m_FillValue);
+      }
+    }
+    if(error)
+    {
+      *m_Error = true;
+    }
+  }
+
+private:
+  T* m_Dest = nullptr;
+  const T* m_Source = nullptr;
+  const int64_t* m_SrcIndices = nullptr;
+  int64_t m_NumSrcTuples = 0;
+  size_t m_NumComps = 1;
+  T m_FillValue = {};
+  std::atomic_bool* m_Error = nullptr;
+};
+
+/**
+ * @brief Copies tuple i of the source into tuple destIndices[i] of the destination. Negative destination
+ * indices are skipped and out of range ones raise the error flag.
+ */
+template <typename T>
+class ScatterTuplesImpl
+{
+public:
+  ScatterTuplesImpl(T* dest, const T* source, const int64_t* destIndices, int64_t numDestTuples, size_t numComps, std::atomic_bool* error)
+  : m_Dest(dest)
+  , m_Source(source)
+  , m_DestIndices(destIndices)
+  , m_NumDestTuples(numDestTuples)
+  , m_NumComps(numComps)
+  , m_Error(error)
+  {
+  }
+  ScatterTuplesImpl(const ScatterTuplesImpl&) = default;
+  ScatterTuplesImpl(ScatterTuplesImpl&&) = default;
+  ScatterTuplesImpl& operator=(const ScatterTuplesImpl&) = delete;
+  ScatterTuplesImpl& operator=(ScatterTuplesImpl&&) = delete;
+  ~ScatterTuplesImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    bool error = false;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const int64_t destIndex = m_DestIndices[i];
+      if(destIndex >= m_NumDestTuples)
+      {
+        error = true;
+      }
+      else if(destIndex >= 0)
+      {
+        std::copy_n(m_Source + i * m_NumComps, m_NumComps, m_Dest + static_cast<size_t>(destIndex) * m_NumComps);
+      }
+    }
+    if(error)
+    {
+      *m_Error = true;
+    }
+  }
+
+private:
+  T* m_Dest = nullptr;
+  const T* m_Source = nullptr;
+  const int64_t* m_DestIndices = nullptr;
+  int64_t m_NumDestTuples = 0;
+  size_t m_NumComps = 1;
+  std::atomic_bool* m_Error = nullptr;
+};
+
+/**
+ * @brief Converts a value to U, saturating at the limits of U. NaN becomes 0 for integer types.
+ */
+template <typename T, typename U>
+U clampCast(T value)
+{
+  if constexpr(std::is_same_v<U, bool>)
+  {
+    return value != static_cast<T>(0);
+  }
+  else if constexpr(std::is_floating_point_v<T> && std::is_floating_point_v<U>)
+  {
+    if constexpr(sizeof(U) < sizeof(T))
+    {
+      if(value < static_cast<T>(std::numeric_limits<U>::lowest()))
+      {
+        return std::numeric_limits<U>::lowest();
+      }
+      if(value > static_cast<T>(std::numeric_limits<U>::max()))
+      {
+        return std::numeric_limits<U>::max();
+      }
+    }
+    return static_cast<U>(value);
+  }
+  else if constexpr(std::is_floating_point_v<T>)
+  {
+    if(std::isnan(value))
+    {
+      return static_cast<U>(0);
+    }
+    // The limits of U rounded to T are at or just beyond the real limits so anything inside them is safe to cast
+    if(value <= static_cast<T>(std::numeric_limits<U>::lowest()))
+    {
+      return std::numeric_limits<U>::lowest();
+    }
+    if(value >= static_cast<T>(std::numeric_limits<U>::max()))
+    {
+      return std::numeric_limits<U>::max();
+    }
+    return static_cast<U>(value);
+  }
+  else if constexpr(std::is_floating_point_v<U>)
+  {
+    return static_cast<U>(value);
+  }
+  else
+  {
+    if constexpr(std::is_signed_v<T>)
+    {
+      if(value < 0)
+      {
+        if constexpr(std::is_signed_v<U>)
+        {
+          return (static_cast<int64_t>(value) < static_cast<int64_t>(std::numeric_limits<U>::lowest())) ? std::numeric_limits<U>::lowest() : static_cast<U>(value);
+        }
+        else
+        {
+          return static_cast<U>(0);
+        }
+      }
+    }
+    return (static_cast<uint64_t>(value) > static_cast<uint64_t>(std::numeric_limits<U>::max())) ? std::numeric_limits<U>::max() : static_cast<U>(value);
+  }
+}
+
+/**
+ * @brief Maps a value in [0, 1] onto the range IDataArray::ConversionMode::Normalize uses for U
+ */
+template <typename U>
+U normalizedCast(double value)
+{
+  if constexpr(std::is_same_v<U, bool>)
+  {
+    return value >= 0.5;
+  }
+  else if constexpr(std::is_floating_point_v<U>)
+  {
+    return static_cast<U>(value);
+  }
+  else
+  {
+    const double lowest = static_cast<double>(std::numeric_limits<U>::lowest());
+    const double highest = static_cast<double>(std::numeric_limits<U>::max());
+    return clampCast<double, U>(std::nearbyint(lowest + value * (highest - lowest)));
+  }
+}
+
+/**
+ * @brief Finds the smallest and largest value of the source. NaN values are ignored.
+ */
+template <typename T>
+class MinMaxValuesImpl
+{
+public:
+  MinMaxValuesImpl(const T* source, double* minValue, double* maxValue, std::mutex* mutex)
+  : m_Source(source)
+  , m_MinValue(minValue)
+  , m_MaxValue(maxValue)
+  , m_Mutex(mutex)
+  {
+  }
+  MinMaxValuesImpl(const MinMaxValuesImpl&) = default;
+  MinMaxValuesImpl(MinMaxValuesImpl&&) = default;
+  MinMaxValuesImpl& operator=(const MinMaxValuesImpl&) = delete;
+  MinMaxValuesImpl& operator=(MinMaxValuesImpl&&) = delete;
+  ~MinMaxValuesImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    double minValue = std::numeric_limits<double>::max();
+    double maxValue = std::numeric_limits<double>::lowest();
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const double value = static_cast<double>(m_Source[i]);
+      minValue = (value < minValue) ? value : minValue;
+      maxValue = (value > maxValue) ? value : maxValue;
+    }
+    std::lock_guard<std::mutex> lock(*m_Mutex);
+    *m_MinValue = std::min(*m_MinValue, minValue);
+    *m_MaxValue = std::max(*m_MaxValue, maxValue);
+  }
+
+private:
+  const T* m_Source = nullptr;
+  double* m_MinValue = nullptr;
+  double* m_MaxValue = nullptr;
+  std::mutex* m_Mutex = nullptr;
+};
+
+/**
+ * @brief Converts each value of the source into the destination. Each mode has its own tight loop over
+ * raw pointers so the compiler is free to vectorize it.
+ */
+template <typename T, typename U>
+class ConvertValuesImpl
+{
+public:
+  ConvertValuesImpl(U* dest, const T* source, IDataArray::ConversionMode mode, double minValue, double scale)
+  : m_Dest(dest)
+  , m_Source(source)
+  , m_Mode(mode)
+  , m_MinValue(minValue)
+  , m_Scale(scale)
+  {
+  }
+  ConvertValuesImpl(const ConvertValuesImpl&) = default;
+  ConvertValuesImpl(ConvertValuesImpl&&) = default;
+  ConvertValuesImpl& operator=(const ConvertValuesImpl&) = delete;
+  ConvertValuesImpl& operator=(ConvertValuesImpl&&) = delete;
+  ~ConvertValuesImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const T* source = m_Source;
+    U* dest = m_Dest;
+    const size_t end = range.max();
+    switch(m_Mode)
+    {
+    case IDataArray::ConversionMode::Clamp:
+      for(size_t i = range.min(); i < end; i++)
+      {
+        dest[i] = clampCast<T, U>(source[i]);
+      }
+      break;
+    case IDataArray::ConversionMode::Normalize:
+      for(size_t i = range.min(); i < end; i++)
+      {
+        dest[i] = normalizedCast<U>((static_cast<double>(source[i]) - m_MinValue) * m_Scale);
+      }
+      break;
+    default:
+      for(size_t i = range.min(); i < end; i++)
+      {
+        dest[i] = static_cast<U>(source[i]);
+      }
+      break;
+    }
+  }
+
+private:
+  U* m_Dest = nullptr;
+  const T* m_Source = nullptr;
+  IDataArray::ConversionMode m_Mode = IDataArray::ConversionMode::Cast;
+  double m_MinValue = 0.0;
+  double m_Scale = 0.0;
+};
+
+/**
+ * @brief Creates a DataArray<U> shaped like the source and fills it with the converted source values
+ */
+template <typename T, typename U>
+IDataArray::Pointer convertValues(const DataArray<T>& source, const QString& name, IDataArray::ConversionMode mode)
+{
+  typename DataArray<U>::Pointer dest = DataArray<U>::CreateArray(source.getNumberOfTuples(), source.getComponentDimensions(), name, false);
+  dest->setStoragePolicy(source.getStoragePolicy());
+  if(dest->allocate() < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+  const size_t numValues = source.getSize();
+  if(numValues == 0)
+  {
+    return dest;
+  }
+
+  double minValue = 0.0;
+  double scale = 0.0;
+  if(mode == IDataArray::ConversionMode::Normalize)
+  {
+    double maxValue = std::numeric_limits<double>::lowest();
+    minValue = std::numeric_limits<double>::max();
+    std::mutex mutex;
+    ParallelDataAlgorithm minMaxAlg;
+    minMaxAlg.setRange(0, numValues);
+    minMaxAlg.execute(MinMaxValuesImpl<T>(source.data(), &minValue, &maxValue, &mutex));
+    // A constant array maps everything onto the low end of the range
+    scale = (maxValue > minValue) ? 1.0 / (maxValue - minValue) : 0.0;
+  }
+
+  // The array was just created so nothing shares its values and the pointer never leaves this function
+  U* destValues = &(*dest)[0];
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numValues);
+  dataAlg.execute(ConvertValuesImpl<T, U>(destValues, source.data(), mode, minValue, scale));
+  return dest;
+}
+
 } // namespace
 
 template <typename T>
@@ -394,6 +741,8 @@ typename DataArray<T>::Pointer DataArray<T>::WrapPointer(T* data, size_t numTupl
   d->m_Array = data;
   // Set who owns the data, i.e., who is going to "free" the memory
   d->m_OwnsData = ownsData;
+  // The caller still holds the pointer so the values can never be shared by deepCopy
+  d->m_IsExposed = true;
   if(nullptr != data)
   {
     d->m_IsAllocated = true;
@@ -402,6 +751,26 @@ typename DataArray<T>::Pointer DataArray<T>::WrapPointer(T* data, size_t numTupl
   return d;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+typename DataArray<T>::Pointer DataArray<T>::WrapSharedBuffer(std::shared_ptr<T> buffer, size_t numTuples, const comp_dims_type& compDims, const QString& name)
+{
+  auto d = std::make_shared<DataArray<T>>(numTuples, name, compDims, static_cast<T>(0), false);
+  if(nullptr == buffer)
+  {
+    return d;
+  }
+
+  // The buffer is released through m_SharedBuffer but it is not shared with another array. Whoever else
+  // holds the buffer may write to it, so writes go straight into it and deepCopy always copies.
+  d->m_Array = buffer.get();
+  d->m_SharedBuffer = std::move(buffer);
+  d->m_OwnsData = true;
+  d->m_IsExposed = true;
+  d->m_IsAllocated = true;
+  return d;
+}
+
 //========================================= Begin API =================================
 template <typename T>
 IDataArray::Pointer DataArray<T>::deepCopy(bool forceNoAllocate) const
@@ -411,14 +780,92 @@ IDataArray::Pointer DataArray<T>::deepCopy(bool forceNoAllocate) const
   {
     allocate = false;
   }
-  auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), allocate);
+  auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+  daCopy->setStoragePolicy(m_StoragePolicy);
+  if(allocate && m_OwnsData && !m_IsExposed && m_ExposedEpoch != IDataArray::GetWritablePointerEpoch() && nullptr != m_Array)
+  {
+    // Share the values instead of copying them. Whichever array is written to first makes its own copy.
+    std::lock_guard<std::mutex> lock(m_DetachMutex);
+    if(nullptr == m_SharedBuffer)
+    {
+      m_SharedBuffer = std::shared_ptr<T>(m_Array, [](T* ptr) {
+        if(!DataArrayStorage::ReleaseMapped(ptr))
+        {
+          delete[](ptr);
+        }
+      });
+    }
+    daCopy->m_SharedBuffer = m_SharedBuffer;
+    daCopy->m_Array = m_Array;
+    daCopy->m_IsAllocated = true;
+    daCopy->m_IsShared = true;
+    m_IsShared = true;
+    return daCopy;
+  }
+  if(allocate)
+  {
+    daCopy->allocate();
+  }
   if(m_IsAllocated && !forceNoAllocate)
   {
-    std::copy(begin(), end(), daCopy->begin());
+    std::copy(cbegin(), cend(), daCopy->begin());
   }
   return daCopy;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::isSharingData() const
+{
+  std::lock_guard<std::mutex> lock(m_DetachMutex);
+  return m_IsShared && m_SharedBuffer.use_count() > 1;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::detach()
+{
+  m_WriteCount.fetch_add(1, std::memory_order_relaxed);
+  if(!m_IsShared.load(std::memory_order_acquire))
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_DetachMutex);
+  if(!m_IsShared.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+  // Only copy if another array still refers to the values; the last one left simply keeps them
+  if(m_SharedBuffer.use_count() > 1)
+  {
+    T* newArray = allocateStorage(m_Size);
+    if(nullptr == newArray)
+    {
+      throw std::bad_alloc();
+    }
+    std::copy(m_Array, m_Array + m_Size, newArray);
+    m_Array = newArray;
+    m_SharedBuffer.reset();
+  }
+  m_IsShared.store(false, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::exposeArray()
+{
+  detach();
+  m_ExposedEpoch = IDataArray::GetWritablePointerEpoch();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::exposeValues()
+{
+  detach();
+  m_IsExposed = true;
+}
+
 /**
  * @brief GetTypeName Returns a string representation of the type of data that is stored by this class. This
  * can be a primitive like char, float, int or the name of a class.
@@ -564,7 +1011,7 @@ bool DataArray<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointe
   {
     return false;
   }
-  if(nullptr == source->getPointer(0))
+  if(nullptr == source->getConstPointer(0))
   {
     return false;
   }
@@ -591,11 +1038,111 @@ bool DataArray<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointe
   return true;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::gatherFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& srcTupleIndices)
+{
+  return gatherFromArray(sourceArray, srcTupleIndices, static_cast<T>(0));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::gatherFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& srcTupleIndices, T fillValue)
+{
+  const Self* source = dynamic_cast<const Self*>(sourceArray.get());
+  if(!m_IsAllocated || nullptr == m_Array || nullptr == source || source == this || !source->isAllocated())
+  {
+    return false;
+  }
+  if(source->m_NumComponents != m_NumComponents || srcTupleIndices.size() > getNumberOfTuples())
+  {
+    return false;
+  }
+  if(srcTupleIndices.empty())
+  {
+    return true;
+  }
+
+  detach();
+  std::atomic_bool error(false);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, srcTupleIndices.size());
+  dataAlg.execute(GatherTuplesImpl<T>(m_Array, source->m_Array, srcTupleIndices.data(), static_cast<int64_t>(source->getNumberOfTuples()), m_NumComponents, fillValue, &error));
+  return !error;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::scatterFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& destTupleIndices)
+{
+  const Self* source = dynamic_cast<const Self*>(sourceArray.get());
+  if(!m_IsAllocated || nullptr == m_Array || nullptr == source || source == this || !source->isAllocated())
+  {
+    return false;
+  }
+  if(source->m_NumComponents != m_NumComponents || destTupleIndices.size() > source->getNumberOfTuples())
+  {
+    return false;
+  }
+  if(destTupleIndices.empty())
+  {
+    return true;
+  }
+
+  detach();
+  std::atomic_bool error(false);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, destTupleIndices.size());
+  dataAlg.execute(ScatterTuplesImpl<T>(m_Array, source->m_Array, destTupleIndices.data(), static_cast<int64_t>(getNumberOfTuples()), m_NumComponents, &error));
+  return !error;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer DataArray<T>::convertTo(SIMPL::NumericTypes::Type type, const QString& name, ConversionMode mode) const
+{
+  if(m_Size > 0 && (!m_IsAllocated || nullptr == m_Array))
+  {
+    return IDataArray::NullPointer();
+  }
+
+  switch(type)
+  {
+  case SIMPL::NumericTypes::Type::Int8:
+    return convertValues<T, int8_t>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::UInt8:
+    return convertValues<T, uint8_t>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::Int16:
+    return convertValues<T, int16_t>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::UInt16:
+    return convertValues<T, uint16_t>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::Int32:
+    return convertValues<T, int32_t>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::UInt32:
+    return convertValues<T, uint32_t>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::Int64:
+    return convertValues<T, int64_t>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::UInt64:
+    return convertValues<T, uint64_t>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::Float:
+    return convertValues<T, float>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::Double:
+    return convertValues<T, double>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::Bool:
+    return convertValues<T, bool>(*this, name, mode);
+  case SIMPL::NumericTypes::Type::SizeT:
+    return convertValues<T, size_t>(*this, name, mode);
+  default:
+    break;
+  }
+  return IDataArray::NullPointer();
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 bool DataArray<T>::copyIntoArray(Pointer dest) const
 {
-  if(m_IsAllocated && dest->isAllocated() && m_Array && dest->getPointer(0))
+  if(m_IsAllocated && dest->isAllocated() && m_Array && dest->getConstPointer(0))
   {
     std::copy(cbegin(), cend(), dest->begin());
     return true;
@@ -610,6 +1157,14 @@ bool DataArray<T>::isAllocated() const
   return m_IsAllocated;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::getWriteCount(uint64_t& writeCount) const
+{
+  writeCount = m_WriteCount.load(std::memory_order_relaxed);
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 void DataArray<T>::setInitValue(T initValue)
@@ -622,15 +1177,82 @@ template <typename T>
 void DataArray<T>::takeOwnership()
 {
   m_OwnsData = true;
+  m_IsExposed = true;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void DataArray<T>::releaseOwnership()
 {
+  // Whoever takes the pointer will free it with delete[] so memory mapped or shared storage is moved back to the heap first
+  if(m_OwnsData && (nullptr != m_SharedBuffer || DataArrayStorage::IsMapped(m_Array)))
+  {
+    T* heapArray = new T[m_Size];
+    std::copy(m_Array, m_Array + m_Size, heapArray);
+    deallocate();
+    m_Array = heapArray;
+    m_IsAllocated = true;
+  }
   m_OwnsData = false;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::setStoragePolicy(DataArrayStorage::StoragePolicy policy)
+{
+  m_StoragePolicy = policy;
+  if(nullptr == m_Array || !m_OwnsData || m_Size == 0)
+  {
+    return;
+  }
+  if(DataArrayStorage::UseMemoryMap(m_StoragePolicy, m_Size * sizeof(T)) == isMemoryMapped())
+  {
+    return;
+  }
+
+  // Move the existing values over to the storage the new policy asks for
+  T* newArray = allocateStorage(m_Size);
+  if(nullptr == newArray)
+  {
+    return;
+  }
+  std::copy(m_Array, m_Array + m_Size, newArray);
+  deallocate();
+  m_Array = newArray;
+  m_IsAllocated = true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+DataArrayStorage::StoragePolicy DataArray<T>::getStoragePolicy() const
+{
+  return m_StoragePolicy;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::isMemoryMapped() const
+{
+  return DataArrayStorage::IsMapped(m_Array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* DataArray<T>::allocateStorage(size_t numElements) const
+{
+  if(DataArrayStorage::UseMemoryMap(m_StoragePolicy, numElements * sizeof(T)))
+  {
+    // The scratch file is zero filled which is the same as value initializing the elements
+    void* ptr = DataArrayStorage::AllocateMapped(numElements * sizeof(T));
+    if(nullptr != ptr)
+    {
+      return reinterpret_cast<T*>(ptr);
+    }
+    qDebug() << "Falling back to in memory storage for " << getName();
+  }
+  return new(std::nothrow) T[numElements]();
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 int32_t DataArray<T>::allocate()
@@ -641,7 +1263,10 @@ int32_t DataArray<T>::allocate()
   }
   m_Array = nullptr;
   m_OwnsData = true;
+  m_IsExposed = false;
+  m_ExposedEpoch = 0;
   m_IsAllocated = false;
+  m_WriteCount.fetch_add(1, std::memory_order_relaxed);
   if(m_Size == 0)
   {
     clear();
@@ -649,7 +1274,7 @@ int32_t DataArray<T>::allocate()
   }
 
   size_t newSize = m_Size;
-  m_Array = new(std::nothrow) T[newSize]();
+  m_Array = allocateStorage(newSize);
   if(!m_Array)
   {
     qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
@@ -669,6 +1294,7 @@ void DataArray<T>::initializeWithZeros()
   {
     return;
   }
+  detach();
   std::fill_n(m_Array, m_Size, 0);
 }
 
@@ -715,7 +1341,11 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
   size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents;
 
   // Create a new m_Array to copy into
-  T* newArray = new T[newSize]();
+  T* newArray = allocateStorage(newSize);
+  if(nullptr == newArray)
+  {
+    return -101;
+  }
 
 #ifndef NDEBUG
   // Splat AB across the array so we know if we are copying the values or not
@@ -741,7 +1371,7 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
   // Only front elements are being dropped
   if(k == idxs.size())
   {
-    auto srcBegin = begin() + (j * m_NumComponents);
+    auto srcBegin = cbegin() + (j * m_NumComponents);
     auto srcEnd = srcBegin + (getNumberOfTuples() - idxs.size()) * m_NumComponents;
     std::copy(srcBegin, srcEnd, newArray);
     // We are done copying - delete the current m_Array
@@ -749,6 +1379,8 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
     m_Size = newSize;
     m_Array = newArray;
     m_OwnsData = true;
+    m_IsExposed = false;
+    m_ExposedEpoch = 0;
     m_MaxId = newSize - 1;
     m_IsAllocated = true;
     return 0;
@@ -779,7 +1411,7 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
   // Copy the data
   for(size_t i = 0; i < srcIdx.size(); ++i)
   {
-    auto srcBegin = begin() + srcIdx[i];
+    auto srcBegin = cbegin() + srcIdx[i];
     auto srcEnd = srcBegin + copyElements[i];
     auto dstBegin = newArray + destIdx[i];
     std::copy(srcBegin, srcEnd, dstBegin);
@@ -793,6 +1425,8 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
   m_Array = newArray;
   // This object has now allocated its memory and owns it.
   m_OwnsData = true;
+  m_IsExposed = false;
+  m_ExposedEpoch = 0;
   m_IsAllocated = true;
   m_MaxId = newSize - 1;
 
@@ -858,13 +1492,34 @@ void* DataArray<T>::getVoidPointer(size_t i)
   {
     return nullptr;
   }
-
+  exposeArray();
   return reinterpret_cast<void*>(&(m_Array[i]));
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-T* DataArray<T>::getPointer(size_t i) const
+T* DataArray<T>::getPointer(size_t i)
+{
+#ifndef NDEBUG
+  if(m_Size > 0)
+  {
+    Q_ASSERT(i < m_Size);
+  }
+#endif
+  exposeArray();
+  return m_Array + i;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+const T* DataArray<T>::getPointer(size_t i) const
+{
+  return getConstPointer(i);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+const T* DataArray<T>::getConstPointer(size_t i) const
 {
 #ifndef NDEBUG
   if(m_Size > 0)
@@ -897,6 +1552,7 @@ void DataArray<T>::setValue(size_t i, T value)
   {
     Q_ASSERT(i < m_Size);
   }
+  Q_ASSERT(!isSharingData());
 #endif
   m_Array[i] = value;
 }
@@ -923,6 +1579,7 @@ void DataArray<T>::setComponent(size_t i, int32_t j, T c)
   {
     Q_ASSERT(i * m_NumComponents + static_cast<size_t>(j) < m_Size);
   }
+  Q_ASSERT(!isSharingData());
 #endif
   m_Array[i * m_NumComponents + static_cast<size_t>(j)] = c;
 }
@@ -986,7 +1643,28 @@ void DataArray<T>::fillTuple(size_t i, T value)
 
 // -----------------------------------------------------------------------------
 template <typename T>
-T* DataArray<T>::getTuplePointer(size_t tupleIndex) const
+T* DataArray<T>::getTuplePointer(size_t tupleIndex)
+{
+#ifndef NDEBUG
+  if(m_Size > 0)
+  {
+    Q_ASSERT(tupleIndex * m_NumComponents < m_Size);
+  }
+#endif
+  exposeArray();
+  return m_Array + (tupleIndex * m_NumComponents);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+const T* DataArray<T>::getTuplePointer(size_t tupleIndex) const
+{
+  return getConstTuplePointer(tupleIndex);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+const T* DataArray<T>::getConstTuplePointer(size_t tupleIndex) const
 {
 #ifndef NDEBUG
   if(m_Size > 0)
@@ -1033,6 +1711,32 @@ void DataArray<T>::printTuple(QTextStream& out, size_t i, char delimiter) const
   out.setRealNumberPrecision(precision);
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::appendTuple(std::string& buffer, size_t i, char delimiter) const
+{
+  // Same precision printTuple() sets on the stream
+  int32_t precision = 6;
+  if constexpr(std::is_same_v<T, float>)
+  {
+    precision = 8;
+  }
+  else if constexpr(std::is_same_v<T, double>)
+  {
+    precision = 16;
+  }
+
+  const T* tuple = m_Array + i * m_NumComponents;
+  for(size_t j = 0; j < m_NumComponents; ++j)
+  {
+    if(j != 0)
+    {
+      buffer.push_back(delimiter);
+    }
+    ParallelTextWriter::AppendValue(buffer, tuple[j], precision);
+  }
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 void DataArray<T>::printComponent(QTextStream& out, size_t i, int32_t j) const
@@ -1245,19 +1949,30 @@ int32_t DataArray<T>::readH5Data(hid_t parentId)
   {
     return -1;
   }
-  m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
   m_Size = p->getSize();
-  m_OwnsData = true;
   m_MaxId = (m_Size == 0) ? 0 : m_Size - 1;
-  m_IsAllocated = true;
   setName(p->getName());
   m_NumTuples = p->getNumberOfTuples();
   m_CompDims = p->getComponentDimensions();
   m_NumComponents = static_cast<size_t>(p->getNumberOfComponents());
 
-  // Tell the intermediate DataArray to release ownership of the data as we are going to be responsible
-  // for deleting the memory
-  p->releaseOwnership();
+  // Take over the memory of the intermediate DataArray as we are going to be responsible for deleting it.
+  // Stealing the storage directly keeps memory mapped arrays from being copied back onto the heap.
+  auto typedArray = std::dynamic_pointer_cast<DataArray<T>>(p);
+  if(nullptr != typedArray && typedArray->m_OwnsData && nullptr == typedArray->m_SharedBuffer)
+  {
+    m_Array = typedArray->m_Array;
+    typedArray->m_Array = nullptr;
+    typedArray->m_IsAllocated = false;
+  }
+  else
+  {
+    p->releaseOwnership();
+    m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
+  }
+  m_OwnsData = true;
+  m_IsAllocated = true;
+  setStoragePolicy(m_StoragePolicy);
   return err;
 }
 
@@ -1274,12 +1989,14 @@ void DataArray<T>::byteSwapElements()
 template <typename T>
 typename DataArray<T>::iterator DataArray<T>::begin()
 {
+  detach();
   return iterator(m_Array);
 }
 
 template <typename T>
 typename DataArray<T>::iterator DataArray<T>::end()
 {
+  detach();
   return iterator(m_Array + m_Size);
 }
 
@@ -1345,12 +2062,14 @@ typename DataArray<T>::const_reverse_iterator DataArray<T>::crend() const
 template <typename T>
 typename DataArray<T>::tuple_iterator DataArray<T>::tupleBegin()
 {
+  detach();
   return tuple_iterator(m_Array, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::tuple_iterator DataArray<T>::tupleEnd()
 {
+  detach();
   return tuple_iterator(m_Array + m_Size, m_NumComponents);
 }
 
@@ -1421,6 +2140,7 @@ template <typename T>
 void DataArray<T>::push_back(const value_type& val)
 {
   resizeAndExtend(m_Size + 1);
+  detach();
   m_Array[m_MaxId] = val;
 }
 
@@ -1429,6 +2149,7 @@ template <typename T>
 void DataArray<T>::push_back(value_type&& val)
 {
   resizeAndExtend(m_Size + 1);
+  detach();
   m_Array[m_MaxId] = val;
 }
 
@@ -1450,6 +2171,8 @@ void DataArray<T>::clear()
   m_Array = nullptr;
   m_Size = 0;
   m_OwnsData = true;
+  m_IsExposed = false;
+  m_ExposedEpoch = 0;
   m_MaxId = 0;
   m_IsAllocated = false;
   m_NumTuples = 0;
@@ -1461,6 +2184,17 @@ void DataArray<T>::clear()
 template <typename T>
 void DataArray<T>::deallocate()
 {
+  // Shared values are released by whichever array lets go of them last
+  if(nullptr != m_SharedBuffer)
+  {
+    m_SharedBuffer.reset();
+    m_IsShared = false;
+    m_IsExposed = false;
+    m_ExposedEpoch = 0;
+    m_Array = nullptr;
+    m_IsAllocated = false;
+    return;
+  }
 #ifndef NDEBUG
   // We are going to splat 0xABABAB across the first value of the array as a debugging aid
   auto cptr = reinterpret_cast<unsigned char*>(m_Array);
@@ -1503,9 +2237,14 @@ void DataArray<T>::deallocate()
       }
 #endif
 
-  delete[](m_Array);
+  if(!DataArrayStorage::ReleaseMapped(m_Array))
+  {
+    delete[](m_Array);
+  }
 
   m_Array = nullptr;
+  m_IsExposed = false;
+  m_ExposedEpoch = 0;
   m_IsAllocated = false;
 }
 
@@ -1550,7 +2289,7 @@ T* DataArray<T>::resizeAndExtend(size_t size)
     return m_Array;
   }
 
-  newArray = new(std::nothrow) T[newSize]();
+  newArray = allocateStorage(newSize);
   if(!newArray)
   {
     qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
@@ -1560,7 +2299,7 @@ T* DataArray<T>::resizeAndExtend(size_t size)
   // Copy the data from the old array.
   if(m_Array != nullptr)
   {
-    auto srcBegin = begin();
+    auto srcBegin = cbegin();
     auto srcEnd = srcBegin + (newSize < m_Size ? newSize : m_Size);
     std::copy(srcBegin, srcEnd, newArray);
   }
@@ -1578,6 +2317,8 @@ T* DataArray<T>::resizeAndExtend(size_t size)
 
   // This object has now allocated its memory and owns it.
   m_OwnsData = true;
+  m_IsExposed = false;
+  m_ExposedEpoch = 0;
 
   m_MaxId = newSize - 1;
   m_IsAllocated = true;
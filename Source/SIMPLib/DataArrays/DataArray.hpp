@@ -36,9 +36,11 @@
 #pragma once
 
 // STL Includes
+#include <atomic>
 #include <cassert>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <QtCore/QString>
@@ -48,6 +50,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 
 /**
@@ -236,15 +239,61 @@ public:
    */
   static Pointer WrapPointer(T* data, size_t numTuples, const comp_dims_type& compDims, const QString& name, bool ownsData);
 
+  /**
+   * @brief WrapSharedBuffer Creates a DataArray<T> object that uses the memory held by @p buffer without
+   * copying it. The array holds a reference to the buffer until it is resized or destroyed, so the deleter
+   * of @p buffer decides how and when the memory is released.
+   * @param buffer
+   * @param numTuples
+   * @param compDims
+   * @param name
+   * @return
+   */
+  static Pointer WrapSharedBuffer(std::shared_ptr<T> buffer, size_t numTuples, const comp_dims_type& compDims, const QString& name);
+
   //========================================= Begin API =================================
 
   /**
-   * @brief deepCopy
+   * @brief deepCopy Returns a copy of this array. The copy shares the values of this array until
+   * either of them is written to (copy-on-write). Methods that write the whole array or hand out
+   * writable access to it (getPointer, data(), the non-const iterators, resize, initializeWithValue
+   * etc.) give the writer its own copy of the values first. The per element writers operator[], at(),
+   * front(), back(), setValue() and setComponent() do not check for sharing so they stay cheap in
+   * tight and parallel loops; call detach() or getPointer() once before writing through them.
+   *
+   * Values are copied right away instead while a writable pointer to them may still be in use. That
+   * covers pointers handed out by the non-const getPointer, getTuplePointer, getVoidPointer or data()
+   * until the next call to IDataArray::ReleaseWritablePointers(), and values that came from WrapPointer,
+   * WrapSharedBuffer, takeOwnership or exposeValues() until they are reallocated. References and
+   * iterators from the non-const interface must not be held across a call to deepCopy.
+   *
+   * Sharing is only safe between threads if each array is accessed through its const interface while
+   * another thread may be using it, the same rule that applies to the standard containers.
    * @param forceNoAllocate
    * @return
    */
   IDataArray::Pointer deepCopy(bool forceNoAllocate = false) const override;
 
+  /**
+   * @brief Returns true if the values are currently shared with another array created through deepCopy
+   * @return
+   */
+  bool isSharingData() const;
+
+  /**
+   * @brief Gives this array its own copy of values that are shared with other arrays. Must be called
+   * before writing through operator[], at(), front(), back(), setValue() or setComponent() unless the
+   * values were already detached by getPointer() or another bulk writer. Call it before a parallel loop
+   * starts; it is not safe to call from several threads at once.
+   */
+  void detach();
+
+  /**
+   * @brief Detaches and records that a writable pointer to the values is kept beyond the current filter,
+   * for example by a NumPy view, so the values are never shared by deepCopy until they are reallocated.
+   */
+  void exposeValues();
+
   /**
    * @brief GetTypeName Returns a string representation of the type of data that is stored by this class. This
    * can be a primitive like char, float, int or the name of a class.
@@ -284,6 +333,46 @@ public:
    */
   bool copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
 
+  /**
+   * @brief gatherFromArray Sets tuple i of this array to tuple srcTupleIndices[i] of <b>sourceArray</b>, which must be
+   * a DataArray of the same type and component count. Tuples with a negative source index are set to zero.
+   * The copy is multi-threaded when parallel algorithms are enabled.
+   * @param sourceArray
+   * @param srcTupleIndices
+   * @return
+   */
+  bool gatherFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& srcTupleIndices) override;
+
+  /**
+   * @brief gatherFromArray Same as above but tuples with a negative source index are filled with fillValue
+   * @param sourceArray
+   * @param srcTupleIndices
+   * @param fillValue
+   * @return
+   */
+  bool gatherFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& srcTupleIndices, T fillValue);
+
+  /**
+   * @brief scatterFromArray Sets tuple destTupleIndices[i] of this array to tuple i of <b>sourceArray</b>, which must be
+   * a DataArray of the same type and component count. Negative destination indices are skipped and the
+   * destination indices must be unique. The copy is multi-threaded when parallel algorithms are enabled.
+   * @param sourceArray
+   * @param destTupleIndices
+   * @return
+   */
+  bool scatterFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& destTupleIndices) override;
+
+  /**
+   * @brief convertTo Creates a DataArray of the given numeric type holding the converted values of this array.
+   * The conversion works on the raw values and is multi-threaded when parallel algorithms are enabled.
+   * The new array uses the storage policy of this array.
+   * @param type
+   * @param name
+   * @param mode
+   * @return The new array or a null pointer if this array is not allocated or type is not a numeric type
+   */
+  IDataArray::Pointer convertTo(SIMPL::NumericTypes::Type type, const QString& name, ConversionMode mode = ConversionMode::Cast) const override;
+
   /**
    * @brief copyIntoArray
    * @param dest
@@ -295,6 +384,14 @@ public:
    * @return
    */
   bool isAllocated() const override;
+
+  /**
+   * @brief Counts the calls to detach(), which every bulk writer makes and which per element writers
+   * rely on, plus every allocation.
+   * @param writeCount
+   * @return
+   */
+  bool getWriteCount(uint64_t& writeCount) const override;
   /**
    * @brief Gives this array a human readable name
    * @param name The name of this array
@@ -322,6 +419,26 @@ public:
    */
   void releaseOwnership() override;
 
+  /**
+   * @brief Sets where the values of this array are stored. Values that are already allocated are moved
+   * over to the new storage. Arrays with the Automatic policy are memory mapped once they reach
+   * DataArrayStorage::GetOutOfCoreThreshold().
+   * @param policy
+   */
+  void setStoragePolicy(DataArrayStorage::StoragePolicy policy);
+
+  /**
+   * @brief Returns the storage policy of this array
+   * @return
+   */
+  DataArrayStorage::StoragePolicy getStoragePolicy() const;
+
+  /**
+   * @brief Returns true if the values are stored in a memory mapped scratch file
+   * @return
+   */
+  bool isMemoryMapped() const;
+
   /**
    * @brief Allocates the memory needed for this class
    * @return 1 on success, -1 on failure
@@ -402,10 +519,28 @@ public:
    * @brief Returns the pointer to a specific index into the array. No checks are made
    * as to the correctness of the index being passed in. If you ask for an index off
    * then end of the array they you will likely cause your program to abort.
+   * The returned pointer is writable so values shared through deepCopy are copied first, and the
+   * values are never shared with later deep copies while this array holds them.
+   * @param i The index to return the pointer to.
+   * @return The pointer to the index
+   */
+  T* getPointer(size_t i);
+
+  /**
+   * @brief Returns a read only pointer to a specific index into the array. This never copies values
+   * that are shared through deepCopy.
+   * @param i The index to return the pointer to.
+   * @return The pointer to the index
+   */
+  const T* getPointer(size_t i) const;
+
+  /**
+   * @brief Returns a read only pointer to a specific index into the array. Unlike the non-const getPointer
+   * this never copies values that are shared through deepCopy.
    * @param i The index to return the pointer to.
    * @return The pointer to the index
    */
-  T* getPointer(size_t i) const;
+  const T* getConstPointer(size_t i) const;
 
   /**
    * @brief Returns the value for a given index
@@ -462,10 +597,22 @@ public:
   void fillTuple(size_t i, T value);
 
   /**
-   * @brief getTuplePointer Returns the pointer to a specific tuple
+   * @brief getTuplePointer Returns the writable pointer to a specific tuple. See getPointer.
+   * @param tupleIndex The index of tuple
+   */
+  T* getTuplePointer(size_t tupleIndex);
+
+  /**
+   * @brief getTuplePointer Returns a read only pointer to a specific tuple without copying shared values
    * @param tupleIndex The index of tuple
    */
-  T* getTuplePointer(size_t tupleIndex) const;
+  const T* getTuplePointer(size_t tupleIndex) const;
+
+  /**
+   * @brief getConstTuplePointer Returns a read only pointer to a specific tuple without copying shared values
+   * @param tupleIndex The index of tuple
+   */
+  const T* getConstTuplePointer(size_t tupleIndex) const;
 
   /**
    * @brief resize
@@ -482,6 +629,14 @@ public:
    */
   void printTuple(QTextStream& out, size_t i, char delimiter = ',') const override;
 
+  /**
+   * @brief appendTuple Formats tuple i exactly like printTuple() without going through QTextStream
+   * @param buffer
+   * @param i
+   * @param delimiter
+   */
+  void appendTuple(std::string& buffer, size_t i, char delimiter = ',') const override;
+
   /**
    * @brief printComponent
    * @param out
@@ -1086,6 +1241,7 @@ public:
   inline reference operator[](size_type index)
   {
     assert(index < m_Size);
+    assert(!isSharingData());
     return m_Array[index];
   }
 
@@ -1101,6 +1257,7 @@ public:
     {
       throw std::out_of_range("DataArray subscript out of range");
     }
+    assert(!isSharingData());
     return m_Array[index];
   }
 
@@ -1115,6 +1272,7 @@ public:
 
   inline reference front()
   {
+    assert(!isSharingData());
     return m_Array[0];
   }
   inline const T& front() const
@@ -1124,6 +1282,7 @@ public:
 
   inline reference back()
   {
+    assert(!isSharingData());
     return m_Array[m_MaxId];
   }
   inline const T& back() const
@@ -1131,8 +1290,9 @@ public:
     return m_Array[m_MaxId];
   }
 
-  inline T* data() noexcept
+  inline T* data()
   {
+    exposeArray();
     return m_Array;
   }
   inline const T* data() const noexcept
@@ -1151,6 +1311,7 @@ public:
   {
     size_type size = last - first;
     resizeAndExtend(size);
+    detach();
     size_type idx = 0;
     while(first != last)
     {
@@ -1232,7 +1393,20 @@ protected:
    */
   T* resizeAndExtend(size_t size);
 
+  /**
+   * @brief Allocates zero initialized storage for numElements values according to the storage policy
+   * @param numElements
+   * @return nullptr if the memory could not be allocated
+   */
+  T* allocateStorage(size_t numElements) const;
+
 private:
+  /**
+   * @brief Detaches and records that a writable pointer to the values left the array so they
+   * are not shared by deepCopy before the next call to IDataArray::ReleaseWritablePointers().
+   */
+  void exposeArray();
+
   T* m_Array = nullptr;
   size_t m_Size = 0;
   size_t m_MaxId = 0;
@@ -1242,6 +1416,17 @@ private:
   comp_dims_type m_CompDims = {1};
   bool m_IsAllocated = false;
   bool m_OwnsData = true;
+  DataArrayStorage::StoragePolicy m_StoragePolicy = DataArrayStorage::StoragePolicy::Automatic;
+
+  // Set when m_Array is owned through m_SharedBuffer together with other arrays
+  mutable std::shared_ptr<T> m_SharedBuffer;
+  mutable std::atomic_bool m_IsShared = {false};
+  mutable std::mutex m_DetachMutex;
+  // Set when m_Array can be written through a pointer this array does not control
+  bool m_IsExposed = false;
+  // The IDataArray::GetWritablePointerEpoch() in which a writable pointer to m_Array was last handed out
+  uint64_t m_ExposedEpoch = 0;
+  std::atomic<uint64_t> m_WriteCount = {0};
 };
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,202 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayStorage.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <QtCore/QDir>
+#include <QtCore/QTemporaryFile>
+#include <QtCore/QtDebug>
+
+namespace
+{
+struct MappedFile
+{
+  std::unique_ptr<QTemporaryFile> file;
+  size_t numBytes = 0;
+};
+
+size_t ThresholdFromEnvironment()
+{
+  bool ok = false;
+  qulonglong megaBytes = qgetenv("SIMPL_OUT_OF_CORE_THRESHOLD_MB").toULongLong(&ok);
+  return ok ? static_cast<size_t>(megaBytes) * 1024 * 1024 : 0;
+}
+
+std::atomic<size_t> s_Threshold(ThresholdFromEnvironment());
+std::atomic<size_t> s_MappedBytes(0);
+std::mutex s_Mutex;
+QString s_ScratchDirectory;
+std::map<const void*, MappedFile> s_MappedFiles;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayStorage::DataArrayStorage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayStorage::~DataArrayStorage() = default;
+
+// -----------------------------------------------------------------------------
+void DataArrayStorage::SetOutOfCoreThreshold(size_t numBytes)
+{
+  s_Threshold = numBytes;
+}
+
+// -----------------------------------------------------------------------------
+size_t DataArrayStorage::GetOutOfCoreThreshold()
+{
+  return s_Threshold;
+}
+
+// -----------------------------------------------------------------------------
+void DataArrayStorage::SetScratchDirectory(const QString& path)
+{
+  std::lock_guard<std::mutex> lock(s_Mutex);
+  s_ScratchDirectory = path;
+}
+
+// -----------------------------------------------------------------------------
+QString DataArrayStorage::GetScratchDirectory()
+{
+  std::lock_guard<std::mutex> lock(s_Mutex);
+  return s_ScratchDirectory.isEmpty() ? QDir::tempPath() : s_ScratchDirectory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayStorage::UseMemoryMap(StoragePolicy policy, size_t numBytes)
+{
+  if(numBytes == 0)
+  {
+    return false;
+  }
+  switch(policy)
+  {
+  case StoragePolicy::InMemory:
+    return false;
+  case StoragePolicy::MemoryMapped:
+    return true;
+  case StoragePolicy::Automatic:
+    break;
+  }
+  size_t threshold = s_Threshold;
+  return threshold > 0 && numBytes >= threshold;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayStorage::AllocateMapped(size_t numBytes)
+{
+  if(numBytes == 0)
+  {
+    return nullptr;
+  }
+
+  // Resizing the new file extends it with zeros, which matches the value initialization of heap arrays.
+  // On most file systems the file stays sparse until pages are actually written.
+  auto file = std::make_unique<QTemporaryFile>(QDir(GetScratchDirectory()).filePath("SIMPL_DataArray_XXXXXX.bin"));
+  if(!file->open() || !file->resize(static_cast<qint64>(numBytes)))
+  {
+    qDebug() << "Unable to create a scratch file of " << numBytes << " bytes in " << GetScratchDirectory();
+    return nullptr;
+  }
+  uchar* ptr = file->map(0, static_cast<qint64>(numBytes));
+  if(nullptr == ptr)
+  {
+    qDebug() << "Unable to memory map the scratch file " << file->fileName();
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(s_Mutex);
+  MappedFile& mapped = s_MappedFiles[ptr];
+  mapped.file = std::move(file);
+  mapped.numBytes = numBytes;
+  s_MappedBytes += numBytes;
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayStorage::ReleaseMapped(void* ptr)
+{
+  if(nullptr == ptr)
+  {
+    return false;
+  }
+  MappedFile mapped;
+  {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    auto iter = s_MappedFiles.find(ptr);
+    if(iter == s_MappedFiles.end())
+    {
+      return false;
+    }
+    mapped = std::move(iter->second);
+    s_MappedFiles.erase(iter);
+  }
+  s_MappedBytes -= mapped.numBytes;
+  // Unmapping and removing the file can take a while for large arrays so do it outside of the lock.
+  // QTemporaryFile removes the file when it is destroyed.
+  mapped.file->unmap(static_cast<uchar*>(ptr));
+  mapped.file.reset();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool DataArrayStorage::IsMapped(const void* ptr)
+{
+  if(nullptr == ptr)
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(s_Mutex);
+  return s_MappedFiles.find(ptr) != s_MappedFiles.end();
+}
+
+// -----------------------------------------------------------------------------
+size_t DataArrayStorage::GetMappedBytes()
+{
+  return s_MappedBytes;
+}
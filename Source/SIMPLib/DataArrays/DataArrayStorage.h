@@ -0,0 +1,133 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The DataArrayStorage class decides where the values of a DataArray<T> live and hands out the
+ * memory for them. Besides ordinary heap memory an array can be backed by a file in a scratch directory
+ * that is memory mapped into the process. The operating system then pages the values in and out on demand
+ * so volumes larger than the physical memory can be processed while getPointer() and the iterators keep
+ * working on a plain contiguous T*.
+ *
+ * Each DataArray carries a StoragePolicy. Arrays with the Automatic policy (the default) are memory mapped
+ * once their size reaches the global out-of-core threshold. The threshold is disabled (0) unless it is set
+ * with SetOutOfCoreThreshold() or the SIMPL_OUT_OF_CORE_THRESHOLD_MB environment variable.
+ */
+class SIMPLib_EXPORT DataArrayStorage
+{
+public:
+  enum class StoragePolicy : int
+  {
+    Automatic = 0,
+    InMemory = 1,
+    MemoryMapped = 2
+  };
+
+  /**
+   * @brief Sets the size in bytes at which arrays with the Automatic policy are memory mapped. 0 disables it.
+   * @param numBytes
+   */
+  static void SetOutOfCoreThreshold(size_t numBytes);
+
+  /**
+   * @brief Returns the size in bytes at which arrays with the Automatic policy are memory mapped
+   * @return
+   */
+  static size_t GetOutOfCoreThreshold();
+
+  /**
+   * @brief Sets the directory that holds the backing files of memory mapped arrays. Defaults to the system temp directory.
+   * @param path
+   */
+  static void SetScratchDirectory(const QString& path);
+
+  /**
+   * @brief Returns the directory that holds the backing files of memory mapped arrays
+   * @return
+   */
+  static QString GetScratchDirectory();
+
+  /**
+   * @brief Returns true if an allocation of numBytes with the given policy should be memory mapped
+   * @param policy
+   * @param numBytes
+   * @return
+   */
+  static bool UseMemoryMap(StoragePolicy policy, size_t numBytes);
+
+  /**
+   * @brief Creates a zero filled, memory mapped scratch file of numBytes bytes. The file is removed again
+   * when the memory is released.
+   * @param numBytes
+   * @return The address of the mapping or a nullptr if the file could not be created or mapped
+   */
+  static void* AllocateMapped(size_t numBytes);
+
+  /**
+   * @brief Unmaps and removes the scratch file behind ptr
+   * @param ptr
+   * @return false if ptr was not returned by AllocateMapped(). The caller still owns it in that case.
+   */
+  static bool ReleaseMapped(void* ptr);
+
+  /**
+   * @brief Returns true if ptr was returned by AllocateMapped() and has not been released yet
+   * @param ptr
+   * @return
+   */
+  static bool IsMapped(const void* ptr);
+
+  /**
+   * @brief Returns the total number of bytes that are currently memory mapped
+   * @return
+   */
+  static size_t GetMappedBytes();
+
+protected:
+  DataArrayStorage();
+
+public:
+  ~DataArrayStorage();
+  DataArrayStorage(const DataArrayStorage&) = delete;            // Copy Constructor Not Implemented
+  DataArrayStorage(DataArrayStorage&&) = delete;                 // Move Constructor Not Implemented
+  DataArrayStorage& operator=(const DataArrayStorage&) = delete; // Copy Assignment Not Implemented
+  DataArrayStorage& operator=(DataArrayStorage&&) = delete;      // Move Assignment Not Implemented
+};
@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -44,7 +45,11 @@
 #include "SIMPLib/SIMPLib.h"
 
 /**
- * @brief
+ * @brief DynamicListArray stores one variable length list of K per entry. All lists
+ * share a single contiguous slab that is sized once by allocateLists(); each
+ * ElementList points into that slab at the offset given by the prefix sum of the
+ * list counts. A list that is later grown past its slab capacity through
+ * setElementList() is moved into its own allocation.
  */
 template <typename T, typename K>
 class DynamicListArray
@@ -99,22 +104,7 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  virtual ~DynamicListArray()
-  {
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "ElementList" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
-  }
+  virtual ~DynamicListArray() = default;
 
   /**
    * @brief size
@@ -190,16 +180,30 @@ public:
     {
       return false;
     }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
+    if(!m_DetachedLists.empty())
+    {
+      m_DetachedLists[ptId].reset();
+    }
+    size_t capacity = m_Offsets[ptId + 1] - m_Offsets[ptId];
+    if(static_cast<size_t>(nCells) <= capacity)
     {
-      delete[] this->m_Array[ptId].cells;
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
+      m_Array[ptId].cells = (capacity > 0) ? m_Slab.get() + m_Offsets[ptId] : nullptr;
+    }
+    else
+    {
+      // The list outgrew its slot in the slab so it gets its own storage
+      if(m_DetachedLists.empty())
+      {
+        m_DetachedLists.resize(m_Size);
+      }
+      m_DetachedLists[ptId].reset(new K[nCells]);
+      m_Array[ptId].cells = m_DetachedLists[ptId].get();
     }
     m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
+    if(nCells > 0)
+    {
+      ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
+    }
     return true;
   }
 
@@ -211,23 +215,7 @@ public:
    */
   bool setElementList(size_t ptId, ElementList& list)
   {
-    T nCells = list.ncells;
-    K* data = list.cells;
-    if(ptId >= m_Size)
-    {
-      return false;
-    }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
-    {
-      delete[] this->m_Array[ptId].cells;
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
-    }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
-    return true;
+    return setElementList(ptId, list.ncells, list.cells);
   }
 
   /**
@@ -257,38 +245,55 @@ public:
    */
   void deserializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
   {
+    uint8_t* bufPtr = buffer.data();
+
+    // First walk the buffer to gather the count of every list so the slab can be sized once
+    std::vector<T> linkCounts(nElements, 0);
     size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = &(buffer.front());
+    for(size_t i = 0; i < nElements; ++i)
+    {
+      ::memcpy(&linkCounts[i], bufPtr + offset, sizeof(T));
+      offset += sizeof(T) + linkCounts[i] * sizeof(K);
+    }
+    allocateLists(linkCounts);
 
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    // int32_t* cells = nullptr;
+    // Now copy each list from the buffer into its slot of the slab
+    offset = 0;
     for(size_t i = 0; i < nElements; ++i)
     {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
+      offset += sizeof(T);
+      size_t nBytes = linkCounts[i] * sizeof(K);
+      if(nBytes > 0)
+      {
+        ::memcpy(this->m_Array[i].cells, bufPtr + offset, nBytes);
+      }
+      offset += nBytes;
     }
   }
 
   /**
-   * @brief
+   * @brief Sizes every list from linkCounts. The offsets are the prefix sum of the
+   * counts and all lists are carved out of one slab allocation. The list contents
+   * are left uninitialized.
    * @param linkCounts
    */
   template <typename Container>
   void allocateLists(const Container& linkCounts)
   {
-    allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
+    size_t sz = linkCounts.size();
+    allocate(sz);
+    for(size_t i = 0; i < sz; i++)
     {
-      this->m_Array[i].ncells = linkCounts[i];
-      if(linkCounts[i] > 0)
+      T count = linkCounts[i];
+      this->m_Array[i].ncells = count;
+      m_Offsets[i + 1] = m_Offsets[i] + static_cast<size_t>(count);
+    }
+    m_Slab.reset(m_Offsets[sz] > 0 ? new K[m_Offsets[sz]] : nullptr);
+    for(size_t i = 0; i < sz; i++)
+    {
+      if(this->m_Array[i].ncells > 0)
       {
-        this->m_Array[i].cells = new K[this->m_Array[i].ncells];
+        this->m_Array[i].cells = m_Slab.get() + m_Offsets[i];
       }
     }
   }
@@ -303,23 +308,14 @@ protected:
   {
     static typename DynamicListArray<T, K>::ElementList linkInit = {0, nullptr};
 
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "ElementList" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
+    // Release the slab and any lists that were moved out of it
+    m_Slab.reset();
+    m_DetachedLists.clear();
 
     this->m_Size = sz;
     // Allocate a whole new set of structures
-    this->m_Array = new typename DynamicListArray<T, K>::ElementList[sz];
+    this->m_Array.reset(new typename DynamicListArray<T, K>::ElementList[sz]);
+    m_Offsets.assign(sz + 1, 0);
 
     // Initialize each structure to have 0 entries and nullptr pointer.
     for(size_t i = 0; i < sz; i++)
@@ -329,8 +325,11 @@ protected:
   }
 
 private:
-  ElementList* m_Array = nullptr; // pointer to data
+  std::unique_ptr<ElementList[]> m_Array; // pointer to data
   size_t m_Size = 0;
+  std::unique_ptr<K[]> m_Slab;                       // storage shared by every list
+  std::vector<size_t> m_Offsets = {0};               // start of each list in m_Slab, m_Size + 1 entries
+  std::vector<std::unique_ptr<K[]>> m_DetachedLists; // lists that outgrew their slot in m_Slab
 };
 
 typedef DynamicListArray<int32_t, int32_t> Int32Int32DynamicListArray;
@@ -0,0 +1,380 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FlatNeighborList.hpp"
+
+#include <cstring>
+#include <numeric>
+
+#include "H5Support/H5Lite.h"
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+// -----------------------------------------------------------------------------
+template <typename T>
+FlatNeighborList<T>::FlatNeighborList(const QString& name)
+: m_Name(name)
+{
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+FlatNeighborList<T>::~FlatNeighborList() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename FlatNeighborList<T>::Pointer FlatNeighborList<T>::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+QString FlatNeighborList<T>::ClassName()
+{
+  return QString("FlatNeighborList<T>");
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename FlatNeighborList<T>::Pointer FlatNeighborList<T>::New(const QString& name)
+{
+  Pointer sharedPtr(new FlatNeighborList<T>(name));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename FlatNeighborList<T>::Pointer FlatNeighborList<T>::FromNeighborList(const NeighborList<T>& neighborList)
+{
+  size_t numLists = static_cast<size_t>(neighborList.getNumberOfLists());
+  Pointer ptr = Build(
+      neighborList.getName(), numLists, [&](size_t i) { return static_cast<size_t>(neighborList.getListSize(static_cast<int>(i))); },
+      [&](size_t i, ListView view) {
+        if(!view.empty())
+        {
+          ::memcpy(view.data(), neighborList.getListReference(static_cast<int>(i)).data(), view.size() * sizeof(T));
+        }
+      });
+  ptr->setNumNeighborsArrayName(neighborList.getNumNeighborsArrayName());
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void FlatNeighborList<T>::allocate(const std::vector<size_t>& listSizes)
+{
+  m_Offsets.resize(listSizes.size() + 1);
+  m_Offsets[0] = 0;
+  std::partial_sum(listSizes.begin(), listSizes.end(), m_Offsets.begin() + 1);
+  m_Values.assign(m_Offsets.back(), T());
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename NeighborList<T>::Pointer FlatNeighborList<T>::toNeighborList() const
+{
+  size_t numLists = getNumberOfLists();
+  typename NeighborList<T>::Pointer neighborList = NeighborList<T>::CreateArray(numLists, m_Name, true);
+  neighborList->setNumNeighborsArrayName(m_NumNeighborsArrayName);
+  for(size_t i = 0; i < numLists; i++)
+  {
+    const T* start = m_Values.data() + m_Offsets[i];
+    typename NeighborList<T>::SharedVectorType list(new typename NeighborList<T>::VectorType(start, start + getListSize(i)));
+    neighborList->setList(static_cast<int>(i), list);
+  }
+  return neighborList;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void FlatNeighborList<T>::setName(const QString& name)
+{
+  m_Name = name;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+QString FlatNeighborList<T>::getName() const
+{
+  return m_Name;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void FlatNeighborList<T>::setNumNeighborsArrayName(const QString& name)
+{
+  m_NumNeighborsArrayName = name;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+QString FlatNeighborList<T>::getNumNeighborsArrayName() const
+{
+  return m_NumNeighborsArrayName;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t FlatNeighborList<T>::getNumberOfLists() const
+{
+  return m_Offsets.size() - 1;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t FlatNeighborList<T>::getListSize(size_t listIndex) const
+{
+  return m_Offsets[listIndex + 1] - m_Offsets[listIndex];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t FlatNeighborList<T>::getNumberOfValues() const
+{
+  return m_Values.size();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename FlatNeighborList<T>::ListView FlatNeighborList<T>::getListReference(size_t listIndex)
+{
+  return ListView(m_Values.data() + m_Offsets[listIndex], getListSize(listIndex));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename FlatNeighborList<T>::ConstListView FlatNeighborList<T>::getListReference(size_t listIndex) const
+{
+  return ConstListView(m_Values.data() + m_Offsets[listIndex], getListSize(listIndex));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename FlatNeighborList<T>::ListView FlatNeighborList<T>::operator[](size_t listIndex)
+{
+  return getListReference(listIndex);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename FlatNeighborList<T>::ConstListView FlatNeighborList<T>::operator[](size_t listIndex) const
+{
+  return getListReference(listIndex);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+const std::vector<T>& FlatNeighborList<T>::getValues() const
+{
+  return m_Values;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+const std::vector<size_t>& FlatNeighborList<T>::getOffsets() const
+{
+  return m_Offsets;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int FlatNeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const
+{
+  int err = 0;
+
+  QString numNeighborsArrayName = m_NumNeighborsArrayName;
+  if(numNeighborsArrayName.isEmpty())
+  {
+    numNeighborsArrayName = getName() + "_NumNeighbors";
+  }
+
+  size_t numLists = getNumberOfLists();
+  Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(numLists, numNeighborsArrayName, true);
+  int32_t* numNeighbors = numNeighborsPtr->getPointer(0);
+  for(size_t i = 0; i < numLists; i++)
+  {
+    numNeighbors[i] = static_cast<int32_t>(getListSize(i));
+  }
+
+  // Only rewrite the NumNeighbors array if what is in the file differs from what we hold
+  bool rewrite = true;
+  if(QH5Lite::datasetExists(parentId, numNeighborsArrayName))
+  {
+    std::vector<int32_t> fileNumNeigh;
+    err = H5Lite::readVectorDataset(parentId, numNeighborsArrayName.toStdString(), fileNumNeigh);
+    if(err < 0)
+    {
+      return -602;
+    }
+    rewrite = fileNumNeigh.size() != numLists || (numLists > 0 && ::memcmp(numNeighbors, fileNumNeigh.data(), numLists * sizeof(int32_t)) != 0);
+  }
+  if(rewrite)
+  {
+    numNeighborsPtr->writeH5Data(parentId, tDims);
+  }
+
+  // The values are already contiguous so they are written without an intermediate copy
+  size_t total = m_Values.size();
+  int32_t rank = 1;
+  hsize_t dims[1] = {total};
+  if(total > 0)
+  {
+    err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, m_Values.data());
+    if(err < 0)
+    {
+      return -605;
+    }
+
+    // Tag the dataset exactly as NeighborList<T> does so either class can read it back
+    err = QH5Lite::writeScalarAttribute(parentId, getName(), SIMPL::HDF5::DataArrayVersion, 2);
+    if(err < 0)
+    {
+      return -604;
+    }
+    err = QH5Lite::writeStringAttribute(parentId, getName(), SIMPL::HDF5::ObjectType, NeighborList<T>::ClassName());
+    if(err < 0)
+    {
+      return -607;
+    }
+
+    hsize_t size = tDims.size();
+    err = QH5Lite::writePointerAttribute(parentId, getName(), SIMPL::HDF5::TupleDimensions, 1, &size, tDims.data());
+    if(err < 0)
+    {
+      return -609;
+    }
+
+    std::vector<size_t> cDims = {1};
+    size = cDims.size();
+    err = QH5Lite::writePointerAttribute(parentId, getName(), SIMPL::HDF5::ComponentDimensions, 1, &size, cDims.data());
+    if(err < 0)
+    {
+      return -610;
+    }
+
+    err = QH5Lite::writeStringAttribute(parentId, getName(), "Linked NumNeighbors Dataset", numNeighborsArrayName);
+    if(err < 0)
+    {
+      return -608;
+    }
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int FlatNeighborList<T>::readH5Data(hid_t parentId)
+{
+  int err = 0;
+
+  std::vector<T> values;
+  err = QH5Lite::readVectorDataset(parentId, getName(), values);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  QString numNeighborsArrayName = m_NumNeighborsArrayName;
+  if(numNeighborsArrayName.isEmpty())
+  {
+    numNeighborsArrayName = getName() + "_NumNeighbors";
+  }
+
+  err = QH5Lite::readStringAttribute(parentId, getName(), "Linked NumNeighbors Dataset", numNeighborsArrayName);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  std::vector<int32_t> numNeighbors;
+  if(QH5Lite::datasetExists(parentId, numNeighborsArrayName))
+  {
+    err = QH5Lite::readVectorDataset(parentId, numNeighborsArrayName, numNeighbors);
+    if(err < 0)
+    {
+      return -702;
+    }
+  }
+  else
+  {
+    return -703;
+  }
+
+  std::vector<size_t> offsets(numNeighbors.size() + 1, 0);
+  for(size_t i = 0; i < numNeighbors.size(); i++)
+  {
+    offsets[i + 1] = offsets[i] + static_cast<size_t>(numNeighbors[i]);
+  }
+  if(offsets.back() != values.size())
+  {
+    return -704;
+  }
+
+  m_Values.swap(values);
+  m_Offsets.swap(offsets);
+  m_NumNeighborsArrayName = numNeighborsArrayName;
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+#if !defined(__APPLE__) && !defined(_MSC_VER)
+#undef SIMPLib_EXPORT
+#define SIMPLib_EXPORT
+#endif
+
+template class SIMPLib_EXPORT FlatNeighborList<char>;
+
+template class SIMPLib_EXPORT FlatNeighborList<int8_t>;
+template class SIMPLib_EXPORT FlatNeighborList<uint8_t>;
+
+template class SIMPLib_EXPORT FlatNeighborList<int16_t>;
+template class SIMPLib_EXPORT FlatNeighborList<uint16_t>;
+
+template class SIMPLib_EXPORT FlatNeighborList<int32_t>;
+template class SIMPLib_EXPORT FlatNeighborList<uint32_t>;
+
+template class SIMPLib_EXPORT FlatNeighborList<int64_t>;
+template class SIMPLib_EXPORT FlatNeighborList<uint64_t>;
+
+template class SIMPLib_EXPORT FlatNeighborList<float>;
+template class SIMPLib_EXPORT FlatNeighborList<double>;
+
+#if defined(__APPLE__) || defined(_MSC_VER)
+template class SIMPLib_EXPORT FlatNeighborList<size_t>;
+#endif
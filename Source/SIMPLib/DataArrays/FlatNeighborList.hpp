@@ -0,0 +1,323 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "H5Support/H5SupportTypeDefs.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @class FlatNeighborList FlatNeighborList.hpp SIMPLib/DataArrays/FlatNeighborList.hpp
+ * @brief Stores a set of variable length lists in compressed-sparse-row form: a single
+ * contiguous buffer of values plus an offsets array with one entry per list (and one
+ * trailing entry). Each list is accessed through a lightweight, non-owning view so no
+ * per-list allocation is ever performed. The HDF5 layout written and read by this class
+ * is identical to the one used by NeighborList<T> so files are interchangeable.
+ */
+template <typename T>
+class FlatNeighborList
+{
+public:
+  using Self = FlatNeighborList<T>;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+
+  static Pointer NullPointer();
+
+  using value_type = T;
+
+  /**
+   * @brief Non-owning view over one list. The view is invalidated by any call that
+   * reallocates the values buffer (allocate, readH5Data).
+   */
+  template <typename U>
+  class View
+  {
+  public:
+    View() = default;
+    View(U* data, size_t size)
+    : m_Data(data)
+    , m_Size(size)
+    {
+    }
+
+    U* begin() const
+    {
+      return m_Data;
+    }
+    U* end() const
+    {
+      return m_Data + m_Size;
+    }
+    U* data() const
+    {
+      return m_Data;
+    }
+    size_t size() const
+    {
+      return m_Size;
+    }
+    bool empty() const
+    {
+      return m_Size == 0;
+    }
+    U& operator[](size_t i) const
+    {
+      return m_Data[i];
+    }
+
+  private:
+    U* m_Data = nullptr;
+    size_t m_Size = 0;
+  };
+
+  using ListView = View<T>;
+  using ConstListView = View<const T>;
+
+  /**
+   * @brief Returns the name of the class
+   */
+  static QString ClassName();
+
+  /**
+   * @brief Creates an empty list with the given name.
+   * @param name
+   * @return
+   */
+  static Pointer New(const QString& name = QString("FlatNeighborList"));
+
+  /**
+   * @brief Builds a FlatNeighborList in two parallel passes. The first pass calls
+   * countFunc(listIndex) -> size_t for every list to size the buffer, a prefix sum
+   * produces the offsets and the second pass calls fillFunc(listIndex, ListView) so
+   * each list can be written in place.
+   * @param name
+   * @param numLists
+   * @param countFunc
+   * @param fillFunc
+   * @return
+   */
+  template <typename CountFunc, typename FillFunc>
+  static Pointer Build(const QString& name, size_t numLists, CountFunc countFunc, FillFunc fillFunc)
+  {
+    Pointer ptr = New(name);
+    std::vector<size_t> listSizes(numLists, 0);
+
+    ParallelDataAlgorithm countAlg;
+    countAlg.setRange(0, numLists);
+    countAlg.execute(CountImpl<CountFunc>(listSizes.data(), countFunc));
+
+    ptr->allocate(listSizes);
+
+    ParallelDataAlgorithm fillAlg;
+    fillAlg.setRange(0, numLists);
+    fillAlg.execute(FillImpl<FillFunc>(ptr.get(), fillFunc));
+    return ptr;
+  }
+
+  /**
+   * @brief Flattens an existing NeighborList
+   * @param neighborList
+   * @return
+   */
+  static Pointer FromNeighborList(const NeighborList<T>& neighborList);
+
+  virtual ~FlatNeighborList();
+
+  /**
+   * @brief Sizes the offsets and values buffers for the given list sizes. Values are
+   * value-initialized.
+   * @param listSizes
+   */
+  void allocate(const std::vector<size_t>& listSizes);
+
+  /**
+   * @brief Converts back into a NeighborList with one vector per list.
+   * @return
+   */
+  typename NeighborList<T>::Pointer toNeighborList() const;
+
+  void setName(const QString& name);
+  QString getName() const;
+
+  void setNumNeighborsArrayName(const QString& name);
+  QString getNumNeighborsArrayName() const;
+
+  /**
+   * @brief Returns the number of lists
+   * @return
+   */
+  size_t getNumberOfLists() const;
+
+  /**
+   * @brief Returns the number of values in the given list
+   * @param listIndex
+   * @return
+   */
+  size_t getListSize(size_t listIndex) const;
+
+  /**
+   * @brief Returns the total number of values across all lists
+   * @return
+   */
+  size_t getNumberOfValues() const;
+
+  ListView getListReference(size_t listIndex);
+  ConstListView getListReference(size_t listIndex) const;
+
+  ListView operator[](size_t listIndex);
+  ConstListView operator[](size_t listIndex) const;
+
+  /**
+   * @brief Returns the contiguous values buffer
+   * @return
+   */
+  const std::vector<T>& getValues() const;
+
+  /**
+   * @brief Returns the offsets buffer. It holds getNumberOfLists() + 1 entries.
+   * @return
+   */
+  const std::vector<size_t>& getOffsets() const;
+
+  /**
+   * @brief Writes the values buffer directly in the NeighborList layout.
+   * @param parentId
+   * @param tDims
+   * @return
+   */
+  int writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const;
+
+  /**
+   * @brief Reads a NeighborList dataset straight into the values buffer.
+   * @param parentId
+   * @return
+   */
+  int readH5Data(hid_t parentId);
+
+protected:
+  FlatNeighborList(const QString& name);
+
+private:
+  QString m_Name;
+  QString m_NumNeighborsArrayName;
+  std::vector<T> m_Values;
+  std::vector<size_t> m_Offsets = {0};
+
+  template <typename CountFunc>
+  class CountImpl
+  {
+  public:
+    CountImpl(size_t* listSizes, CountFunc& countFunc)
+    : m_ListSizes(listSizes)
+    , m_CountFunc(countFunc)
+    {
+    }
+
+    void operator()(const SIMPLRange& range) const
+    {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        m_ListSizes[i] = m_CountFunc(i);
+      }
+    }
+
+  private:
+    size_t* m_ListSizes;
+    CountFunc& m_CountFunc;
+  };
+
+  template <typename FillFunc>
+  class FillImpl
+  {
+  public:
+    FillImpl(FlatNeighborList* list, FillFunc& fillFunc)
+    : m_List(list)
+    , m_FillFunc(fillFunc)
+    {
+    }
+
+    void operator()(const SIMPLRange& range) const
+    {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        m_FillFunc(i, m_List->getListReference(i));
+      }
+    }
+
+  private:
+    FlatNeighborList* m_List;
+    FillFunc& m_FillFunc;
+  };
+
+public:
+  FlatNeighborList(const FlatNeighborList&) = delete;            // Copy Constructor Not Implemented
+  FlatNeighborList(FlatNeighborList&&) = delete;                 // Move Constructor Not Implemented
+  FlatNeighborList& operator=(const FlatNeighborList&) = delete; // Copy Assignment Not Implemented
+  FlatNeighborList& operator=(FlatNeighborList&&) = delete;      // Move Assignment Not Implemented
+};
+
+using Int32FlatNeighborListType = FlatNeighborList<int32_t>;
+using FloatFlatNeighborListType = FlatNeighborList<float>;
+
+// -----------------------------------------------------------------------------
+// Declare our extern templates
+
+extern template class FlatNeighborList<char>;
+
+extern template class FlatNeighborList<int8_t>;
+extern template class FlatNeighborList<uint8_t>;
+extern template class FlatNeighborList<int16_t>;
+extern template class FlatNeighborList<uint16_t>;
+extern template class FlatNeighborList<int32_t>;
+extern template class FlatNeighborList<uint32_t>;
+extern template class FlatNeighborList<int64_t>;
+extern template class FlatNeighborList<uint64_t>;
+
+extern template class FlatNeighborList<float>;
+extern template class FlatNeighborList<double>;
+
+extern template class FlatNeighborList<size_t>;
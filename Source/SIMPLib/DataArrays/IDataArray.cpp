@@ -11,8 +11,16 @@
 
 #include "IDataArray.h"
 
+#include <atomic>
+
 #include <hdf5.h>
 
+namespace
+{
+// Starts at 1 so an array that never handed out a pointer (epoch 0) is never mistaken for an exposed one
+std::atomic<uint64_t> s_WritablePointerEpoch(1);
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -26,6 +34,31 @@ IDataArray::IDataArray(const QString& name)
 // -----------------------------------------------------------------------------
 IDataArray::~IDataArray() = default;
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataArray::ReleaseWritablePointers()
+{
+  s_WritablePointerEpoch++;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t IDataArray::GetWritablePointerEpoch()
+{
+  return s_WritablePointerEpoch.load();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::getWriteCount(uint64_t& writeCount) const
+{
+  Q_UNUSED(writeCount);
+  return false;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -34,6 +67,88 @@ bool IDataArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer
   return copyFromArray(destTupleOffset, sourceArray, 0, sourceArray->getNumberOfTuples());
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::gatherFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& srcTupleIndices)
+{
+  if(nullptr == sourceArray.get() || sourceArray.get() == this || srcTupleIndices.size() > getNumberOfTuples())
+  {
+    return false;
+  }
+  const int64_t numSrcTuples = static_cast<int64_t>(sourceArray->getNumberOfTuples());
+  bool hasFillTuples = false;
+  for(const auto& srcIndex : srcTupleIndices)
+  {
+    if(srcIndex >= numSrcTuples)
+    {
+      return false;
+    }
+    hasFillTuples = hasFillTuples || srcIndex < 0;
+  }
+  // Arrays without a typed gather have no generic way to zero a single tuple so zero everything up front
+  if(hasFillTuples)
+  {
+    initializeWithZeros();
+  }
+  for(size_t i = 0; i < srcTupleIndices.size(); i++)
+  {
+    if(srcTupleIndices[i] >= 0 && !copyFromArray(i, sourceArray, static_cast<size_t>(srcTupleIndices[i]), 1))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::scatterFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& destTupleIndices)
+{
+  if(nullptr == sourceArray.get() || sourceArray.get() == this || destTupleIndices.size() > sourceArray->getNumberOfTuples())
+  {
+    return false;
+  }
+  const int64_t numDestTuples = static_cast<int64_t>(getNumberOfTuples());
+  for(size_t i = 0; i < destTupleIndices.size(); i++)
+  {
+    const int64_t destIndex = destTupleIndices[i];
+    if(destIndex >= numDestTuples)
+    {
+      return false;
+    }
+    if(destIndex >= 0 && !copyFromArray(static_cast<size_t>(destIndex), sourceArray, i, 1))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataArray::appendTuple(std::string& buffer, size_t i, char delimiter) const
+{
+  QString text;
+  QTextStream out(&text);
+  printTuple(out, i, delimiter);
+  out.flush();
+  buffer.append(text.toStdString());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer IDataArray::convertTo(SIMPL::NumericTypes::Type type, const QString& name, ConversionMode mode) const
+{
+  Q_UNUSED(type);
+  Q_UNUSED(name);
+  Q_UNUSED(mode);
+  return IDataArray::NullPointer();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 
 //-- C++
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "H5Support/H5SupportTypeDefs.h"
@@ -61,6 +62,16 @@ public:
   using ConstWeakPointer = std::weak_ptr<const Self>;
   static Pointer NullPointer();
 
+  /**
+   * @brief Selects how convertTo() maps values into the destination type
+   */
+  enum class ConversionMode : int
+  {
+    Cast = 0,     //!< Each value is static_cast to the destination type
+    Clamp = 1,    //!< Values outside the range of the destination type saturate at its lowest or highest value. NaN becomes 0 for integer types.
+    Normalize = 2 //!< The [min, max] range of the values is mapped linearly onto the full range of an integer type, or onto [0, 1] for floating point types. Bool values are true in the upper half.
+  };
+
   /**
    * @brief Returns the name of the class for IDataArray
    */
@@ -73,6 +84,20 @@ public:
   IDataArray(const QString& name = "");
   ~IDataArray() override;
 
+  /**
+   * @brief Declares that the writable pointers handed out so far by the non-const getPointer,
+   * getTuplePointer, getVoidPointer and data() methods of every array are no longer used, so
+   * those arrays may share their values with later deep copies again. FilterPipeline calls
+   * this after each filter has executed since filters fetch their pointers again on every run.
+   */
+  static void ReleaseWritablePointers();
+
+  /**
+   * @brief Returns a value that changes on every call to ReleaseWritablePointers()
+   * @return
+   */
+  static uint64_t GetWritablePointerEpoch();
+
   virtual Pointer createNewArray(size_t numElements, int32_t rank, const size_t* dims, const QString& name, bool allocate = true) const = 0;
   virtual Pointer createNewArray(size_t numElements, const std::vector<size_t>& dims, const QString& name, bool allocate = true) const = 0;
   // virtual Pointer createNewArray(size_t numElements, std::vector<size_t> dims, const QString& name, bool allocate = true) = 0;
@@ -90,6 +115,14 @@ public:
    */
   virtual bool isAllocated() const = 0;
 
+  /**
+   * @brief Stores a counter that grows whenever writable access to the values is handed out, so callers
+   * can cheaply tell whether the values may have changed. Returns false if the array does not count its writes.
+   * @param writeCount
+   * @return
+   */
+  virtual bool getWriteCount(uint64_t& writeCount) const;
+
   /**
    * @brief Makes this class responsible for freeing the memory.
    */
@@ -200,6 +233,45 @@ public:
    */
   virtual bool copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) = 0;
 
+  /**
+   * @brief gatherFromArray Fills the first srcTupleIndices.size() tuples of this array from arbitrary tuples
+   * of <b>sourceArray</b>. Tuples whose source index is negative are set to zero. In psuedo code:
+   * @code
+   *  destArray[i] = (srcTupleIndices[i] < 0) ? 0 : sourceArray[srcTupleIndices[i]];
+   * @endcode
+   * The default implementation calls copyFromArray() once per tuple. DataArray<T> overrides it with a typed,
+   * multi-threaded copy so remapping filters should prefer this over per tuple copyFromArray() loops.
+   * @param sourceArray The array to read tuples from. Must not be this array.
+   * @param srcTupleIndices One source tuple index per destination tuple
+   * @return false if the arrays are not compatible or an index is out of range
+   */
+  virtual bool gatherFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& srcTupleIndices);
+
+  /**
+   * @brief scatterFromArray Copies the first destTupleIndices.size() tuples of <b>sourceArray</b> to arbitrary
+   * tuples of this array. Source tuples whose destination index is negative are skipped. In psuedo code:
+   * @code
+   *  if(destTupleIndices[i] >= 0) destArray[destTupleIndices[i]] = sourceArray[i];
+   * @endcode
+   * The destination indices must be unique since the copy may be multi-threaded.
+   * @param sourceArray The array to read tuples from. Must not be this array.
+   * @param destTupleIndices One destination tuple index per source tuple
+   * @return false if the arrays are not compatible or an index is out of range
+   */
+  virtual bool scatterFromArray(const IDataArray::ConstPointer& sourceArray, const std::vector<int64_t>& destTupleIndices);
+
+  /**
+   * @brief convertTo Creates a new array of the given numeric type with the same tuple and component
+   * dimensions as this array and fills it with the converted values of this array.
+   * DataArray<T> overrides this with a multi-threaded conversion over the raw values so filters should
+   * prefer it over per value getValue()/setValue() loops.
+   * @param type The numeric type of the new array
+   * @param name The name of the new array
+   * @param mode How values that do not fit the new type are handled
+   * @return The new array or a null pointer if this array can not be converted
+   */
+  virtual IDataArray::Pointer convertTo(SIMPL::NumericTypes::Type type, const QString& name, ConversionMode mode = ConversionMode::Cast) const;
+
   /**
    * @brief Splats the same value c across all values in the Tuple
    * @param pos The index of the Tuple
@@ -233,6 +305,15 @@ public:
    */
   virtual void printTuple(QTextStream& out, size_t i, char delimiter = ',') const = 0;
 
+  /**
+   * @brief appendTuple Appends the text printTuple() writes for tuple i to the buffer. It only reads the
+   * array so it may be called from several threads at once. The default implementation goes through printTuple().
+   * @param buffer
+   * @param i
+   * @param delimiter
+   */
+  virtual void appendTuple(std::string& buffer, size_t i, char delimiter = ',') const;
+
   /**
    * @brief printComponent
    * @param out
@@ -10,6 +10,8 @@
 #include "SIMPLib/Common/Constants.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/FlatNeighborList.hpp"
+#include "SIMPLib/Utilities/ParallelTextWriter.h"
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -389,7 +391,7 @@ bool NeighborList<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
 
   for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
   {
-    m_Array[destTupleOffset + i] = source->getList(i);
+    m_Array[destTupleOffset + (i - srcTupleOffset)] = source->getList(i);
   }
   return true;
 
@@ -559,6 +561,19 @@ void NeighborList<T>::printTuple(QTextStream& out, size_t i, char delimiter) con
   }
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::appendTuple(std::string& buffer, size_t i, char delimiter) const
+{
+  const VectorType& vec = *(m_Array[i]);
+  ParallelTextWriter::AppendValue(buffer, vec.size());
+  for(const auto& value : vec)
+  {
+    buffer.push_back(delimiter);
+    ParallelTextWriter::AppendValue(buffer, value);
+  }
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 void NeighborList<T>::printComponent(QTextStream& out, size_t i, int j) const
@@ -570,135 +585,9 @@ void NeighborList<T>::printComponent(QTextStream& out, size_t i, int j) const
 template <typename T>
 int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const
 {
-  int err = 0;
-
-  // Generate the NumNeighbors array and also compute the total number
-  // of elements that would be needed to flatten the array so we
-  // can compare this with what is written in the file. If they are
-  // different we are going to overwrite what is in the file with what
-  // we compute here.
-
-  QString numNeighborsArrayName = m_NumNeighborsArrayName;
-
-  if(numNeighborsArrayName.isEmpty())
-  {
-    numNeighborsArrayName = getName() + "_NumNeighbors";
-  }
-
-  Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(m_Array.size(), numNeighborsArrayName, true);
-  int32_t* numNeighbors = numNeighborsPtr->getPointer(0);
-  size_t total = 0;
-  for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
-  {
-    numNeighbors[dIdx] = static_cast<int32_t>(m_Array[dIdx]->size());
-    total += m_Array[dIdx]->size();
-  }
-
-  // Check to see if the NumNeighbors is already written to the file
-  bool rewrite = false;
-  if(!QH5Lite::datasetExists(parentId, numNeighborsArrayName))
-  {
-    // The NumNeighbors Array is NOT already in the file so write it to the file
-    numNeighborsPtr->writeH5Data(parentId, tDims);
-  }
-  else
-  {
-    // The NumNeighbors array is in the dream3d file so read it up into memory and compare with what
-    // we have in memory.
-    std::vector<int32_t> fileNumNeigh(m_Array.size());
-    err = H5Lite::readVectorDataset(parentId, numNeighborsArrayName.toStdString(), fileNumNeigh);
-    if(err < 0)
-    {
-      return -602;
-    }
-
-    // Compare the 2 vectors to make sure they are exactly the same;
-    if(fileNumNeigh.size() != numNeighborsPtr->getNumberOfTuples())
-    {
-      rewrite = true;
-    }
-    // The sizes are the same, now compare each value;
-    int32_t* fileNumNeiPtr = &(fileNumNeigh.front());
-    size_t nBytes = numNeighborsPtr->getNumberOfTuples() * sizeof(int32_t);
-    if(::memcmp(numNeighbors, fileNumNeiPtr, nBytes) != 0)
-    {
-      rewrite = true;
-    }
-  }
-
-  // Write out the NumNeighbors Array because something was different between what we computed at
-  // the top of the function versus what is in memory
-  if(rewrite)
-  {
-    numNeighborsPtr->writeH5Data(parentId, tDims);
-  }
-
-  // Allocate an array of the proper size so we can concatenate all the arrays together into a single array that
-  // can be written to the HDF5 File. This operation can ballon the memory size temporarily until this operation
-  // is complete.
-  QVector<T> flat(total);
-  size_t currentStart = 0;
-  for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
-  {
-    size_t nEle = m_Array[dIdx]->size();
-    if(nEle == 0)
-    {
-      continue;
-    }
-    T* start = m_Array[dIdx]->data(); // get theNeighborList<T>::Pointer to the front of the array
-    //    T* end = start + nEle; // get theNeighborList<T>::Pointer to the end of the array
-    T* dst = flat.data() + currentStart;
-    ::memcpy(dst, start, nEle * sizeof(T));
-
-    currentStart += m_Array[dIdx]->size();
-  }
-
-  // Now we can actually write the actual array data.
-  int32_t rank = 1;
-  hsize_t dims[1] = {total};
-  if(total > 0)
-  {
-    err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, flat.data());
-    if(err < 0)
-    {
-      return -605;
-    }
-
-    err = QH5Lite::writeScalarAttribute(parentId, getName(), SIMPL::HDF5::DataArrayVersion, getClassVersion());
-    if(err < 0)
-    {
-      return -604;
-    }
-    err = QH5Lite::writeStringAttribute(parentId, getName(), SIMPL::HDF5::ObjectType, getNameOfClass());
-    if(err < 0)
-    {
-      return -607;
-    }
-
-    // Write the tuple dimensions as an attribute
-    hsize_t size = tDims.size();
-    err = QH5Lite::writePointerAttribute(parentId, getName(), SIMPL::HDF5::TupleDimensions, 1, &size, tDims.data());
-    if(err < 0)
-    {
-      return -609;
-    }
-
-    std::vector<size_t> cDims = getComponentDimensions();
-    // write the component dimensions as  an attribute
-    size = cDims.size();
-    err = QH5Lite::writePointerAttribute(parentId, getName(), SIMPL::HDF5::ComponentDimensions, 1, &size, cDims.data());
-    if(err < 0)
-    {
-      return -610;
-    }
-
-    err = QH5Lite::writeStringAttribute(parentId, getName(), "Linked NumNeighbors Dataset", numNeighborsArrayName);
-    if(err < 0)
-    {
-      return -608;
-    }
-  }
-  return err;
+  // The lists are flattened in parallel into the layout that is written to the file
+  typename FlatNeighborList<T>::Pointer flatList = FlatNeighborList<T>::FromNeighborList(*this);
+  return flatList->writeH5Data(parentId, tDims);
 }
 
 // -----------------------------------------------------------------------------
@@ -779,70 +668,22 @@ QString NeighborList<T>::getInfoString(SIMPL::InfoStringFormat format) const
 template <typename T>
 int NeighborList<T>::readH5Data(hid_t parentId)
 {
-  int err = 0;
-
-  std::vector<T> flat;
-  err = QH5Lite::readVectorDataset(parentId, getName(), flat);
-  if(err < 0)
-  {
-    return err;
-  }
-
-  QString numNeighborsArrayName = m_NumNeighborsArrayName;
-
-  if(numNeighborsArrayName.isEmpty())
-  {
-    numNeighborsArrayName = getName() + "_NumNeighbors";
-  }
-
-  // Read the Attribute Off the data set to find the name of the array that holds all the sizes
-  err = QH5Lite::readStringAttribute(parentId, getName(), "Linked NumNeighbors Dataset", numNeighborsArrayName);
+  typename FlatNeighborList<T>::Pointer flatList = FlatNeighborList<T>::New(getName());
+  flatList->setNumNeighborsArrayName(m_NumNeighborsArrayName);
+  int err = flatList->readH5Data(parentId);
   if(err < 0)
   {
     return err;
   }
-  // Generate the number of neighbors array and also compute the total number
-  // of elements that would be needed to flatten the array
-  std::vector<int32_t> numNeighbors;
-
-  // Check to see if the NumNeighbors exists in the file, which it must.
-  if(QH5Lite::datasetExists(parentId, numNeighborsArrayName))
-  {
-    err = QH5Lite::readVectorDataset(parentId, numNeighborsArrayName, numNeighbors);
-    if(err < 0)
-    {
-      return -702;
-    }
-  }
-  else
-  {
-    return -703;
-  }
-
-  // int32_t totalElements = std::accumulate(numNeighbors.begin(), numNeighbors.end(), 0);
 
   // Loop over all the entries and make new Vectors to hold the incoming data
-  m_Array.resize(numNeighbors.size());
+  const size_t numLists = flatList->getNumberOfLists();
+  m_Array.resize(numLists);
   m_IsAllocated = true;
-  size_t currentStart = 0;
-  qint32 count = static_cast<qint32>(numNeighbors.size());
-  for(QVector<int32_t>::size_type dIdx = 0; dIdx < count; ++dIdx)
+  for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
   {
-    size_t nEle = numNeighbors[dIdx];
-    if(nEle > 0)
-    {
-      m_Array[dIdx] = SharedVectorType(new VectorType(numNeighbors[dIdx]));
-
-      T* dst = m_Array[dIdx]->data(); // get theNeighborList<T>::Pointer to the front of the array
-      //    T* end = start + nEle; // get theNeighborList<T>::Pointer to the end of the array
-      T* start = flat.data() + currentStart;
-      ::memcpy(dst, start, nEle * sizeof(T));
-      currentStart += nEle;
-    }
-    else
-    {
-      m_Array[dIdx] = SharedVectorType(new VectorType(0));
-    }
+    typename FlatNeighborList<T>::ListView list = flatList->getListReference(dIdx);
+    m_Array[dIdx] = SharedVectorType(new VectorType(list.begin(), list.end()));
   }
   m_NumTuples = m_Array.size(); // Sync up the numTuples property with the size of the internal array
   return err;
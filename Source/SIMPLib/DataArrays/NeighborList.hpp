@@ -339,6 +339,14 @@ public:
   // FIXME: These need to be implemented
   void printTuple(QTextStream& out, size_t i, char delimiter = ',') const override;
 
+  /**
+   * @brief appendTuple Formats list i exactly like printTuple() without going through QTextStream
+   * @param buffer
+   * @param i
+   * @param delimiter
+   */
+  void appendTuple(std::string& buffer, size_t i, char delimiter = ',') const override;
+
   /**
    * @brief printComponent
    * @param out
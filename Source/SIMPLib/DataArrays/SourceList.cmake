@@ -4,6 +4,8 @@ set(SUBDIR_NAME DataArrays)
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayStorage.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FlatNeighborList.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/NeighborList.hpp
@@ -15,11 +17,13 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayStorage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/NeighborList.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FlatNeighborList.cpp
 )
 cmp_IDE_SOURCE_PROPERTIES( "${SUBDIR_NAME}" "${SIMPLib_${SUBDIR_NAME}_HDRS};${SIMPLib_${SUBDIR_NAME}_Moc_HDRS}" "${SIMPLib_${SUBDIR_NAME}_SRCS}" "${PROJECT_INSTALL_HEADERS}")
 cmp_IDE_SOURCE_PROPERTIES( "Generated/${SUBDIR_NAME}" "" "${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS}" "0")
@@ -66,6 +66,7 @@ class SIMPLib_EXPORT StringDataArray : public IDataArray
   PYB11_METHOD(void setValue ARGS size_t,i const.QString.&,value)
   PYB11_METHOD(size_t getSize)
   PYB11_METHOD(size_t getNumberOfTuples)
+  PYB11_CUSTOM()
   PYB11_END_BINDINGS()
   // End Python bindings declarations
   // clang-format on
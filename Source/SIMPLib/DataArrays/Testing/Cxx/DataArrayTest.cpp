@@ -39,6 +39,7 @@
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <vector>
 
 #include <QtCore/QDir>
@@ -49,8 +50,13 @@
 
 #include <QtCore/QDebug>
 
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
+#include "SIMPLib/DataArrays/FlatNeighborList.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -678,6 +684,99 @@ public:
     TestNeighborListDeepCopyForType<int8_t>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void TestFlatNeighborListForType()
+  {
+    const size_t numLists = 100;
+    typename FlatNeighborList<T>::Pointer flat = FlatNeighborList<T>::Build(
+        "FlatNeighborList", numLists, [](size_t i) { return i % 7; },
+        [](size_t i, typename FlatNeighborList<T>::ListView list) {
+          for(size_t j = 0; j < list.size(); j++)
+          {
+            list[j] = static_cast<T>(i + j);
+          }
+        });
+    DREAM3D_REQUIRE_EQUAL(flat->getNumberOfLists(), numLists);
+    DREAM3D_REQUIRE_EQUAL(flat->getOffsets().size(), numLists + 1);
+    size_t total = 0;
+    for(size_t i = 0; i < numLists; i++)
+    {
+      typename FlatNeighborList<T>::ConstListView list = static_cast<const FlatNeighborList<T>&>(*flat)[i];
+      DREAM3D_REQUIRE_EQUAL(list.size(), i % 7);
+      for(size_t j = 0; j < list.size(); j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(list[j], static_cast<T>(i + j));
+      }
+      total += list.size();
+    }
+    DREAM3D_REQUIRE_EQUAL(flat->getNumberOfValues(), total);
+
+    // Round trip through a NeighborList
+    typename NeighborList<T>::Pointer neighborList = flat->toNeighborList();
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(neighborList->getNumberOfLists()), numLists);
+    typename FlatNeighborList<T>::Pointer flatCopy = FlatNeighborList<T>::FromNeighborList(*neighborList);
+    DREAM3D_REQUIRE(flatCopy->getOffsets() == flat->getOffsets());
+    DREAM3D_REQUIRE(flatCopy->getValues() == flat->getValues());
+
+    // Write the flat list and read it back both as a FlatNeighborList and a NeighborList
+    QDir().mkpath(UnitTest::DataArrayTest::TestDir);
+    hid_t fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestFile);
+    DREAM3D_REQUIRE(fileId > 0);
+    {
+      H5ScopedFileSentinel sentinel(fileId, false);
+      std::vector<size_t> tDims = {numLists};
+      int err = flat->writeH5Data(fileId, tDims);
+      DREAM3D_REQUIRED(err, >=, 0);
+
+      typename FlatNeighborList<T>::Pointer flatRead = FlatNeighborList<T>::New("FlatNeighborList");
+      err = flatRead->readH5Data(fileId);
+      DREAM3D_REQUIRED(err, >=, 0);
+      DREAM3D_REQUIRE(flatRead->getOffsets() == flat->getOffsets());
+      DREAM3D_REQUIRE(flatRead->getValues() == flat->getValues());
+
+      typename NeighborList<T>::Pointer listRead = NeighborList<T>::CreateArray(0, std::string("FlatNeighborList"), false);
+      err = listRead->readH5Data(fileId);
+      DREAM3D_REQUIRED(err, >=, 0);
+      DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(listRead->getNumberOfLists()), numLists);
+      for(size_t i = 0; i < numLists; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(listRead->getListSize(static_cast<int>(i))), i % 7);
+      }
+    }
+    QFile::remove(UnitTest::DataArrayTest::TestFile);
+
+    // NeighborList writes and reads through the flat layout as well
+    fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestFile);
+    DREAM3D_REQUIRE(fileId > 0);
+    {
+      H5ScopedFileSentinel sentinel(fileId, false);
+      std::vector<size_t> tDims = {numLists};
+      int err = neighborList->writeH5Data(fileId, tDims);
+      DREAM3D_REQUIRED(err, >=, 0);
+
+      typename NeighborList<T>::Pointer listRead = NeighborList<T>::CreateArray(0, std::string("FlatNeighborList"), false);
+      err = listRead->readH5Data(fileId);
+      DREAM3D_REQUIRED(err, >=, 0);
+      typename FlatNeighborList<T>::Pointer flatRead = FlatNeighborList<T>::FromNeighborList(*listRead);
+      DREAM3D_REQUIRE(flatRead->getOffsets() == flat->getOffsets());
+      DREAM3D_REQUIRE(flatRead->getValues() == flat->getValues());
+    }
+    QFile::remove(UnitTest::DataArrayTest::TestFile);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFlatNeighborList()
+  {
+    TestFlatNeighborListForType<int32_t>();
+    TestFlatNeighborListForType<uint64_t>();
+    TestFlatNeighborListForType<float>();
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -975,6 +1074,8 @@ true);
       }
     }
     copy = std::dynamic_pointer_cast<DataArray<T>>(src->deepCopy());
+    // The copy shares the values, so detach before writing single components
+    src->detach();
     for(size_t i = 0; i < numTuples; i++)
     {
       for(size_t j = 0; j < cDims[0]; j++)
@@ -1004,6 +1105,105 @@ true);
     TestDeepCopyDataArrayForType<double>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyOnWrite()
+  {
+    size_t numTuples = 100;
+    std::vector<size_t> cDims(1, 3);
+    Int32ArrayType::Pointer src = Int32ArrayType::CreateArray(numTuples, cDims, "Source", true);
+    std::iota(src->begin(), src->end(), 0);
+    const int32_t* srcValues = src->getConstPointer(0);
+
+    // A deep copy shares the values until one of the arrays is written to
+    Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(src->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE(src->isSharingData())
+    DREAM3D_REQUIRE(copy->isSharingData())
+    DREAM3D_REQUIRE(copy->getConstPointer(0) == srcValues)
+
+    // Reading through the const interface never copies
+    const Int32ArrayType& constCopy = *copy;
+    DREAM3D_REQUIRE_EQUAL(constCopy[10], 10)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(20), 20)
+    DREAM3D_REQUIRE(std::equal(constCopy.cbegin(), constCopy.cend(), srcValues))
+    DREAM3D_REQUIRE(constCopy.getPointer(0) == srcValues)
+    DREAM3D_REQUIRE(constCopy.getTuplePointer(1) == srcValues + 3)
+    DREAM3D_REQUIRE(copy->isSharingData())
+
+    // Per element writes rely on an explicit detach, which gives the writer its own values and leaves the source alone
+    copy->detach();
+    DREAM3D_REQUIRE(!copy->isSharingData())
+    copy->setValue(0, -1);
+    DREAM3D_REQUIRE(copy->getConstPointer(0) != srcValues)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), -1)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(1), 1)
+    DREAM3D_REQUIRE_EQUAL(src->getValue(0), 0)
+
+    // The source is the last owner now so writing to it does not copy
+    DREAM3D_REQUIRE(!src->isSharingData())
+    src->setValue(1, 1);
+    DREAM3D_REQUIRE(src->getConstPointer(0) == srcValues)
+
+    // Values outlive the array that created them
+    copy = std::dynamic_pointer_cast<Int32ArrayType>(src->deepCopy());
+    src = Int32ArrayType::NullPointer();
+    DREAM3D_REQUIRE(copy->getConstPointer(0) == srcValues)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(numTuples * 3 - 1), static_cast<int32_t>(numTuples * 3 - 1))
+    DREAM3D_REQUIRE(!copy->isSharingData())
+
+    // Resizing or erasing a shared array must not disturb its siblings
+    Int32ArrayType::Pointer sibling = std::dynamic_pointer_cast<Int32ArrayType>(copy->deepCopy());
+    sibling->resizeTuples(10);
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfTuples(), numTuples)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(numTuples * 3 - 1), static_cast<int32_t>(numTuples * 3 - 1))
+    DREAM3D_REQUIRE_EQUAL(sibling->getValue(29), 29)
+
+    // Arrays that do not own their values are always copied
+    std::vector<int32_t> external(30, 7);
+    Int32ArrayType::Pointer wrapped = Int32ArrayType::WrapPointer(external.data(), 10, cDims, "Wrapped", false);
+    Int32ArrayType::Pointer wrappedCopy = std::dynamic_pointer_cast<Int32ArrayType>(wrapped->deepCopy());
+    DREAM3D_REQUIRE(!wrappedCopy->isSharingData())
+    DREAM3D_REQUIRE(wrappedCopy->getConstPointer(0) != external.data())
+    DREAM3D_REQUIRE_EQUAL(wrappedCopy->getValue(29), 7)
+
+    // Values that can be written through a pointer handed out earlier are copied right away
+    int32_t* siblingValues = sibling->getPointer(0);
+    Int32ArrayType::Pointer pinnedCopy = std::dynamic_pointer_cast<Int32ArrayType>(sibling->deepCopy());
+    DREAM3D_REQUIRE(!sibling->isSharingData())
+    DREAM3D_REQUIRE(pinnedCopy->getConstPointer(0) != siblingValues)
+    siblingValues[0] = -7;
+    DREAM3D_REQUIRE_EQUAL(pinnedCopy->getValue(0), 0)
+
+    // Reallocating invalidates the old pointers so the values can be shared again
+    sibling->resizeTuples(20);
+    pinnedCopy = std::dynamic_pointer_cast<Int32ArrayType>(sibling->deepCopy());
+    DREAM3D_REQUIRE(sibling->isSharingData())
+    DREAM3D_REQUIRE_EQUAL(pinnedCopy->getValue(0), -7)
+
+    // Once the filter that fetched a pointer is done with it the values can be shared again
+    siblingValues = sibling->getPointer(0);
+    pinnedCopy = std::dynamic_pointer_cast<Int32ArrayType>(sibling->deepCopy());
+    DREAM3D_REQUIRE(!pinnedCopy->isSharingData())
+    IDataArray::ReleaseWritablePointers();
+    pinnedCopy = std::dynamic_pointer_cast<Int32ArrayType>(sibling->deepCopy());
+    DREAM3D_REQUIRE(pinnedCopy->isSharingData())
+    DREAM3D_REQUIRE(pinnedCopy->getConstPointer(0) == siblingValues)
+
+    // Values handed to an owner that outlives the filter, such as a NumPy view, are never shared again
+    sibling->exposeValues();
+    IDataArray::ReleaseWritablePointers();
+    pinnedCopy = std::dynamic_pointer_cast<Int32ArrayType>(sibling->deepCopy());
+    DREAM3D_REQUIRE(!pinnedCopy->isSharingData())
+
+    // Converted arrays are written without exposing their values
+    IDataArray::Pointer converted = copy->convertTo(SIMPL::NumericTypes::Type::Float, "Converted", IDataArray::ConversionMode::Cast);
+    DREAM3D_REQUIRE_VALID_POINTER(converted.get())
+    FloatArrayType::Pointer convertedCopy = std::dynamic_pointer_cast<FloatArrayType>(converted->deepCopy());
+    DREAM3D_REQUIRE(convertedCopy->isSharingData())
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1045,6 +1245,8 @@ true);
     DREAM3D_REQUIRE_EQUAL(didCopy, true);
 
     copy = std::dynamic_pointer_cast<DataArray<T>>(src->deepCopy());
+    // The copy shares the values, so detach before writing single components
+    src->detach();
     for(size_t i = 0; i < numTuples; i++)
     {
       for(size_t j = 0; j < cDims[0]; j++)
@@ -1125,6 +1327,219 @@ true);
     TestCopyDataForType<double>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void TestGatherScatterForType()
+  {
+    const size_t numSrcTuples = 1000;
+    std::vector<size_t> cDims(1, 3);
+    typename DataArray<T>::Pointer src = DataArray<T>::CreateArray(numSrcTuples, cDims, "Source", true);
+    for(size_t i = 0; i < src->getSize(); i++)
+    {
+      src->setValue(i, static_cast<T>(i % 100));
+    }
+
+    // Every 5th tuple has no source and must be filled
+    std::vector<int64_t> indices(2500);
+    for(size_t i = 0; i < indices.size(); i++)
+    {
+      indices[i] = (i % 5 == 0) ? -1 : static_cast<int64_t>((i * 7) % numSrcTuples);
+    }
+    typename DataArray<T>::Pointer dest = DataArray<T>::CreateArray(indices.size(), cDims, "Dest", true);
+    DREAM3D_REQUIRE(dest->gatherFromArray(src, indices, static_cast<T>(5)))
+    for(size_t i = 0; i < indices.size(); i++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        T expected = (indices[i] < 0) ? static_cast<T>(5) : src->getComponent(static_cast<size_t>(indices[i]), c);
+        DREAM3D_REQUIRE_EQUAL(dest->getComponent(i, c), expected)
+      }
+    }
+
+    // The IDataArray version fills with zeros
+    IDataArray::Pointer iDest = dest;
+    DREAM3D_REQUIRE(iDest->gatherFromArray(src, indices))
+    DREAM3D_REQUIRE_EQUAL(dest->getComponent(0, 0), static_cast<T>(0))
+
+    // Scatter the source in reverse order and skip the first tuple
+    std::vector<int64_t> destIndices(numSrcTuples);
+    for(size_t i = 0; i < numSrcTuples; i++)
+    {
+      destIndices[i] = static_cast<int64_t>(numSrcTuples - 1 - i);
+    }
+    destIndices[0] = -1;
+    typename DataArray<T>::Pointer reversed = DataArray<T>::CreateArray(numSrcTuples, cDims, "Reversed", true);
+    reversed->initializeWithValue(static_cast<T>(1));
+    DREAM3D_REQUIRE(reversed->scatterFromArray(src, destIndices))
+    DREAM3D_REQUIRE_EQUAL(reversed->getComponent(numSrcTuples - 1, 0), static_cast<T>(1))
+    for(size_t i = 1; i < numSrcTuples; i++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(reversed->getComponent(numSrcTuples - 1 - i, c), src->getComponent(i, c))
+      }
+    }
+
+    // Out of range indices and mismatched arrays are rejected
+    indices[10] = static_cast<int64_t>(numSrcTuples);
+    DREAM3D_REQUIRE(!dest->gatherFromArray(src, indices))
+    typename DataArray<T>::Pointer wrongComps = DataArray<T>::CreateArray(indices.size(), std::vector<size_t>(1, 2), "WrongComps", true);
+    DREAM3D_REQUIRE(!wrongComps->gatherFromArray(src, destIndices))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGatherScatter()
+  {
+    TestGatherScatterForType<uint8_t>();
+    TestGatherScatterForType<int16_t>();
+    TestGatherScatterForType<int32_t>();
+    TestGatherScatterForType<int64_t>();
+    TestGatherScatterForType<float>();
+    TestGatherScatterForType<double>();
+
+    // Arrays without a typed gather use the IDataArray implementation
+    StringDataArray::Pointer strings = StringDataArray::CreateArray(4, std::string("Strings"), true);
+    for(size_t i = 0; i < 4; i++)
+    {
+      strings->setValue(i, QString::number(i));
+    }
+    IDataArray::Pointer gathered = strings->createNewArray(3, std::vector<size_t>(1, 1), "Gathered", true);
+    DREAM3D_REQUIRE(gathered->gatherFromArray(strings, {3, -1, 1}))
+    StringDataArray::Pointer gatheredStrings = std::dynamic_pointer_cast<StringDataArray>(gathered);
+    DREAM3D_REQUIRE_EQUAL(gatheredStrings->getValue(0), QString("3"))
+    DREAM3D_REQUIRE(gatheredStrings->getValue(1).isEmpty())
+    DREAM3D_REQUIRE_EQUAL(gatheredStrings->getValue(2), QString("1"))
+
+    // Remapping a whole Attribute Matrix in place
+    std::vector<size_t> tDims = {4, 2};
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tDims, "AttrMat", AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer ints = Int32ArrayType::CreateArray(8, std::string("Ints"), true);
+    FloatArrayType::Pointer floats = FloatArrayType::CreateArray(8, std::vector<size_t>(1, 2), "Floats", true);
+    for(size_t i = 0; i < 8; i++)
+    {
+      ints->setValue(i, static_cast<int32_t>(i));
+      floats->setComponent(i, 0, static_cast<float>(i));
+      floats->setComponent(i, 1, static_cast<float>(i) * 10.0f);
+    }
+    attrMat->insertOrAssign(ints);
+    attrMat->insertOrAssign(floats);
+    std::vector<int64_t> remap = {7, 6, 5, -1, 0, 1};
+    DREAM3D_REQUIRE(attrMat->gatherAttributeArrays(*attrMat, remap, {3, 2}))
+    DREAM3D_REQUIRE_EQUAL(attrMat->getNumberOfTuples(), 6)
+    Int32ArrayType::Pointer newInts = attrMat->getAttributeArrayAs<Int32ArrayType>("Ints");
+    FloatArrayType::Pointer newFloats = attrMat->getAttributeArrayAs<FloatArrayType>("Floats");
+    DREAM3D_REQUIRE_EQUAL(newInts->getNumberOfTuples(), 6)
+    DREAM3D_REQUIRE_EQUAL(newFloats->getNumberOfTuples(), 6)
+    for(size_t i = 0; i < remap.size(); i++)
+    {
+      int32_t expected = remap[i] < 0 ? 0 : static_cast<int32_t>(remap[i]);
+      DREAM3D_REQUIRE_EQUAL(newInts->getValue(i), expected)
+      DREAM3D_REQUIRE_EQUAL(newFloats->getComponent(i, 1), static_cast<float>(expected) * 10.0f)
+    }
+    // A tuple count that does not match the indices leaves the matrix alone
+    DREAM3D_REQUIRE(!attrMat->gatherAttributeArrays(*attrMat, remap, {4, 2}))
+    DREAM3D_REQUIRE_EQUAL(attrMat->getNumberOfTuples(), 6)
+    // So does an index past the end of the source arrays
+    DREAM3D_REQUIRE(!attrMat->gatherAttributeArrays(*attrMat, {0, 1, 6}, {3}))
+    DREAM3D_REQUIRE_EQUAL(attrMat->getNumberOfTuples(), 6)
+    DREAM3D_REQUIRE_EQUAL(attrMat->getAttributeArray("Ints")->getNumberOfTuples(), 6)
+
+    // Arrays the source matrix does not have are only resized
+    AttributeMatrix::Pointer source = AttributeMatrix::New({6}, "Source", AttributeMatrix::Type::Cell);
+    source->insertOrAssign(newInts);
+    DREAM3D_REQUIRE(attrMat->gatherAttributeArrays(*source, {5, 4}, {2}))
+    DREAM3D_REQUIRE_EQUAL(attrMat->getAttributeArrayAs<Int32ArrayType>("Ints")->getValue(0), newInts->getValue(5))
+    DREAM3D_REQUIRE_EQUAL(attrMat->getAttributeArray("Floats")->getNumberOfTuples(), 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void TestMemoryMappedStorageForType()
+  {
+    std::vector<size_t> cDims = {2};
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(500, cDims, "Mapped", false);
+    array->setStoragePolicy(DataArrayStorage::StoragePolicy::MemoryMapped);
+    DREAM3D_REQUIRE_EQUAL(array->allocate(), 1)
+    DREAM3D_REQUIRE(array->isMemoryMapped())
+    DREAM3D_REQUIRE_EQUAL(array->getValue(0), static_cast<T>(0))
+    DREAM3D_REQUIRE_EQUAL(array->getValue(999), static_cast<T>(0))
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, static_cast<T>(i % 100));
+    }
+
+    // Growing the array keeps the values and initializes the new tuples
+    array->setInitValue(static_cast<T>(7));
+    array->resizeTuples(600);
+    DREAM3D_REQUIRE(array->isMemoryMapped())
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(499, 1), static_cast<T>(99))
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(599, 1), static_cast<T>(7))
+
+    // Erasing tuples allocates the smaller array with the same policy
+    std::vector<size_t> eraseIdx = {0, 1, 2};
+    DREAM3D_REQUIRE_EQUAL(array->eraseTuples(eraseIdx), 0)
+    DREAM3D_REQUIRE(array->isMemoryMapped())
+    DREAM3D_REQUIRE_EQUAL(array->getValue(0), static_cast<T>(6))
+
+    // Pointers and iterators work on the mapped memory
+    T* ptr = array->getPointer(0);
+    ptr[0] = static_cast<T>(42);
+    DREAM3D_REQUIRE_EQUAL(*(array->begin()), static_cast<T>(42))
+
+    // Deep copies keep the policy
+    typename DataArray<T>::Pointer copy = std::dynamic_pointer_cast<DataArray<T>>(array->deepCopy());
+    DREAM3D_REQUIRE(copy->isMemoryMapped())
+    DREAM3D_REQUIRE(std::equal(array->begin(), array->end(), copy->begin()))
+
+    // Switching the policy moves the values back onto the heap
+    array->setStoragePolicy(DataArrayStorage::StoragePolicy::InMemory);
+    DREAM3D_REQUIRE(!array->isMemoryMapped())
+    DREAM3D_REQUIRE(std::equal(array->begin(), array->end(), copy->begin()))
+
+    // Released pointers are always heap memory that the caller deletes
+    copy->releaseOwnership();
+    T* released = copy->getPointer(0);
+    DREAM3D_REQUIRE(!DataArrayStorage::IsMapped(released))
+    DREAM3D_REQUIRE_EQUAL(released[0], static_cast<T>(42))
+    copy = DataArray<T>::NullPointer();
+    delete[] released;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMemoryMappedStorage()
+  {
+    size_t mappedBytes = DataArrayStorage::GetMappedBytes();
+    TestMemoryMappedStorageForType<uint8_t>();
+    TestMemoryMappedStorageForType<int32_t>();
+    TestMemoryMappedStorageForType<int64_t>();
+    TestMemoryMappedStorageForType<float>();
+    TestMemoryMappedStorageForType<double>();
+    DREAM3D_REQUIRE_EQUAL(DataArrayStorage::GetMappedBytes(), mappedBytes)
+
+    // Arrays with the Automatic policy go out of core once they reach the threshold
+    size_t threshold = DataArrayStorage::GetOutOfCoreThreshold();
+    DataArrayStorage::SetOutOfCoreThreshold(4096);
+    {
+      FloatArrayType::Pointer small = FloatArrayType::CreateArray(1023, std::string("Small"), true);
+      FloatArrayType::Pointer large = FloatArrayType::CreateArray(1024, std::string("Large"), true);
+      DREAM3D_REQUIRE(!small->isMemoryMapped())
+      DREAM3D_REQUIRE(large->isMemoryMapped())
+      DREAM3D_REQUIRE(DataArrayStorage::GetMappedBytes() >= 4096)
+      small->resizeTuples(2048);
+      DREAM3D_REQUIRE(small->isMemoryMapped())
+    }
+    DataArrayStorage::SetOutOfCoreThreshold(threshold);
+    DREAM3D_REQUIRE_EQUAL(DataArrayStorage::GetMappedBytes(), mappedBytes)
+  }
+
 #define TEST_SIZE 1024
 
   // -----------------------------------------------------------------------------
@@ -1148,6 +1563,38 @@ true);
     ptr = nullptr;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void TestWrapSharedBufferForType()
+  {
+    std::vector<size_t> cDims = {1};
+    std::vector<T> external(TEST_SIZE, static_cast<T>(1));
+    int releaseCount = 0;
+    {
+      std::shared_ptr<T> buffer(external.data(), [&releaseCount](T*) { releaseCount++; });
+      typename DataArray<T>::Pointer dataPtr = DataArray<T>::WrapSharedBuffer(buffer, TEST_SIZE, cDims, "Shared Buffer");
+      buffer.reset();
+      DREAM3D_REQUIRE_EQUAL(dataPtr->getSize(), TEST_SIZE)
+
+      // Writing goes straight into the external memory since nothing else shares it
+      dataPtr->setValue(0, static_cast<T>(5));
+      DREAM3D_REQUIRE_EQUAL(external[0], static_cast<T>(5))
+      DREAM3D_REQUIRE_EQUAL(releaseCount, 0)
+
+      // The external memory can still be written by its owner so a deep copy never shares it
+      auto copy = std::dynamic_pointer_cast<DataArray<T>>(dataPtr->deepCopy());
+      DREAM3D_REQUIRE(!copy->isSharingData())
+      external[0] = static_cast<T>(6);
+      copy->setValue(1, static_cast<T>(7));
+      DREAM3D_REQUIRE_EQUAL(external[1], static_cast<T>(1))
+      DREAM3D_REQUIRE_EQUAL(copy->getValue(0), static_cast<T>(5))
+      DREAM3D_REQUIRE_EQUAL(releaseCount, 0)
+    }
+    DREAM3D_REQUIRE_EQUAL(releaseCount, 1)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1163,6 +1610,12 @@ true);
     TestWrapPointerForType<int64_t>();
     TestWrapPointerForType<float>();
     TestWrapPointerForType<double>();
+
+    TestWrapSharedBufferForType<int8_t>();
+    TestWrapSharedBufferForType<uint32_t>();
+    TestWrapSharedBufferForType<int64_t>();
+    TestWrapSharedBufferForType<float>();
+    TestWrapSharedBufferForType<double>();
   }
 
   // -----------------------------------------------------------------------------
@@ -1498,8 +1951,12 @@ true);
     DREAM3D_REGISTER_TEST(TestDataArray())
     DREAM3D_REGISTER_TEST(TestEraseElements())
     DREAM3D_REGISTER_TEST(TestcopyTuples())
+    DREAM3D_REGISTER_TEST(TestGatherScatter())
+    DREAM3D_REGISTER_TEST(TestMemoryMappedStorage())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
+    DREAM3D_REGISTER_TEST(TestCopyOnWrite())
     DREAM3D_REGISTER_TEST(TestNeighborList())
+    DREAM3D_REGISTER_TEST(TestFlatNeighborList())
     DREAM3D_REGISTER_TEST(TestWrapPointer())
     DREAM3D_REGISTER_TEST(TestPrintDataArray())
     DREAM3D_REGISTER_TEST(TestSetTuple())
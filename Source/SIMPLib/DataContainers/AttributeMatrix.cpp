@@ -36,8 +36,11 @@
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 
 // C++ Includes
+#include <algorithm>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <numeric>
 
 // HDF5 Includes
 #include <hdf5.h>
@@ -56,6 +59,7 @@
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 #include "SIMPLib/Utilities/STLUtilities.hpp"
 
@@ -493,6 +497,102 @@ void AttributeMatrix::resizeAttributeArrays(const std::vector<size_t>& tDims)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AttributeMatrix::gatherAttributeArrays(const AttributeMatrix& sourceAttrMat, const std::vector<int64_t>& srcTupleIndices, const std::vector<size_t>& tDims, AbstractFilter* filter)
+{
+  size_t numTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<>());
+  if(tDims.empty() || numTuples != srcTupleIndices.size())
+  {
+    return false;
+  }
+
+  // Pair every array with its source and check all of them before anything is modified
+  const int64_t maxIndex = srcTupleIndices.empty() ? -1 : *std::max_element(srcTupleIndices.begin(), srcTupleIndices.end());
+  std::vector<IDataArray::Pointer> sources;
+  std::vector<IDataArray::Pointer> unmatched;
+  size_t maxBytes = 0;
+  for(const auto& dataArray : getChildren())
+  {
+    IDataArray::Pointer source = sourceAttrMat.getAttributeArray(dataArray->getName());
+    if(nullptr == source.get())
+    {
+      unmatched.push_back(dataArray);
+      continue;
+    }
+    if(!source->isAllocated() || maxIndex >= static_cast<int64_t>(source->getNumberOfTuples()))
+    {
+      return false;
+    }
+    maxBytes = std::max(maxBytes, source->getSize() * source->getTypeSize());
+    sources.push_back(source);
+  }
+
+  // Arrays are gathered concurrently in batches of at most the size of the largest array. Each batch replaces
+  // its original arrays before the next one starts, so the matrix never holds much more than one extra array.
+  std::vector<IDataArray::Pointer> gathered(sources.size());
+  std::vector<uint8_t> succeeded(sources.size(), 1);
+  size_t batchStart = 0;
+  while(batchStart < sources.size())
+  {
+    size_t batchEnd = batchStart;
+    size_t batchBytes = 0;
+    ParallelTaskAlgorithm taskAlg;
+    while(batchEnd < sources.size())
+    {
+      size_t bytes = sources[batchEnd]->getSize() * sources[batchEnd]->getTypeSize();
+      if(batchEnd > batchStart && batchBytes + bytes > maxBytes)
+      {
+        break;
+      }
+      batchBytes += bytes;
+      size_t i = batchEnd++;
+      taskAlg.execute([&sources, &gathered, &succeeded, &srcTupleIndices, numTuples, i]() {
+        const IDataArray::Pointer& source = sources[i];
+        IDataArray::Pointer dest = source->createNewArray(numTuples, source->getComponentDimensions(), source->getName(), true);
+        succeeded[i] = dest->gatherFromArray(source, srcTupleIndices) ? 1 : 0;
+        gathered[i] = dest;
+      });
+    }
+    taskAlg.wait();
+
+    for(size_t i = batchStart; i < batchEnd; i++)
+    {
+      if(succeeded[i] == 0)
+      {
+        // Only an allocation failure gets here since the indices were checked above. The arrays of earlier
+        // batches were already replaced so the tuple dimensions are left as they were.
+        return false;
+      }
+      insertOrAssign(gathered[i]);
+      gathered[i].reset();
+      sources[i].reset();
+    }
+    batchStart = batchEnd;
+  }
+
+  m_TupleDims = tDims;
+  for(const auto& dataArray : unmatched)
+  {
+    dataArray->resizeTuples(numTuples);
+  }
+  if(!unmatched.empty() && nullptr != filter)
+  {
+    QStringList names;
+    for(const auto& dataArray : unmatched)
+    {
+      names << dataArray->getName();
+    }
+    QString ss = QObject::tr("Attribute Matrix '%1' has no source for the arrays '%2'. They were resized to %3 tuples without remapping their values.")
+                     .arg(getName())
+                     .arg(names.join("', '"))
+                     .arg(numTuples);
+    filter->setWarningCondition(-10501, ss);
+  }
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -616,6 +716,25 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, const QString& nam
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer AttributeMatrix::extractTupleSubset(hid_t amGid, const QString& name, const IDataArray::Pointer& dPtr, const std::vector<size_t>& tupleStart,
+                                                        const std::vector<size_t>& tupleCount) const
+{
+  if(tupleCount.empty() || nullptr == dPtr.get())
+  {
+    return dPtr;
+  }
+  // These array types have no fixed size HDF5 layout so they are read in full and then cropped in memory
+  QString objType;
+  int version = 0;
+  std::vector<size_t> tDims;
+  std::vector<size_t> cDims;
+  H5DataArrayReader::ReadRequiredAttributes(amGid, name, objType, version, tDims, cDims);
+  return H5DataArrayReader::ExtractTupleSubset(dPtr, tDims, tupleStart, tupleCount);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -623,6 +742,8 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
 {
   int err = 0;
   AttributeMatrixProxy::StorageType dasToRead = attrMatProxy->getDataArrays();
+  const std::vector<size_t> tupleStart = attrMatProxy->getTupleSubsetStart();
+  const std::vector<size_t> tupleCount = attrMatProxy->getTupleSubsetCount();
   QString classType;
   for(const auto& daToRead : dasToRead)
   {
@@ -636,11 +757,15 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
 
     if(classType.startsWith("DataArray"))
     {
-      dPtr = H5DataArrayReader::ReadIDataArray(amGid, daToRead.getName(), preflight);
+      // DataArrays read only the selected tuples straight from the file with a hyperslab
+      dPtr = H5DataArrayReader::ReadIDataArray(amGid, daToRead.getName(), tupleStart, tupleCount, preflight);
+      err = (nullptr == dPtr.get() && attrMatProxy->hasTupleSubset()) ? -1 : err;
     }
     else if(classType.compare("StringDataArray") == 0)
     {
       dPtr = H5DataArrayReader::ReadStringDataArray(amGid, daToRead.getName(), preflight);
+      dPtr = extractTupleSubset(amGid, daToRead.getName(), dPtr, tupleStart, tupleCount);
+      err = (nullptr == dPtr.get() && attrMatProxy->hasTupleSubset()) ? -1 : err;
     }
     else if(classType.compare("vector") == 0)
     {
@@ -648,6 +773,8 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     else if(classType.compare("NeighborList<T>") == 0)
     {
       dPtr = H5DataArrayReader::ReadNeighborListData(amGid, daToRead.getName(), preflight);
+      dPtr = extractTupleSubset(amGid, daToRead.getName(), dPtr, tupleStart, tupleCount);
+      err = (nullptr == dPtr.get() && attrMatProxy->hasTupleSubset()) ? -1 : err;
     }
     else if(classType.compare("Statistics") == 0)
     {
@@ -311,6 +311,23 @@ public:
    */
   void resizeAttributeArrays(const std::vector<size_t>& tDims);
 
+  /**
+   * @brief Remaps every array of this Attribute Matrix so that tuple i of the new array is tuple srcTupleIndices[i]
+   * of the array with the same name in sourceAttrMat. Negative indices produce zero filled tuples. Arrays that
+   * do not exist in sourceAttrMat are only resized and reported to the filter as a warning. The arrays are gathered
+   * concurrently in batches no larger than the largest array, and each new array replaces its original as soon as
+   * its batch is done, so sourceAttrMat may be this matrix.
+   * @param sourceAttrMat The Attribute Matrix to read tuples from
+   * @param srcTupleIndices One source tuple index per new tuple
+   * @param tDims The new tuple dimensions. Their product must equal srcTupleIndices.size()
+   * @param filter Optional filter that receives the warning about arrays without a source
+   * @return false if the tuple dimensions or indices do not fit the arrays, in which case this matrix is left
+   * unchanged, or if a new array could not be allocated. After an allocation failure the tuple dimensions and
+   * the arrays of the failed and later batches are unchanged, but the arrays of earlier batches were already
+   * replaced, so the matrix no longer holds consistent tuples and should be discarded.
+   */
+  bool gatherAttributeArrays(const AttributeMatrix& sourceAttrMat, const std::vector<int64_t>& srcTupleIndices, const std::vector<size_t>& tDims, AbstractFilter* filter = nullptr);
+
   /**
    * @brief Returns bool of whether a named array exists
    * @param name The name of the data array
@@ -673,6 +690,17 @@ private:
   std::vector<size_t> m_TupleDims;
   AttributeMatrix::Type m_Type = {};
 
+  /**
+   * @brief Crops an array that was read in full down to the tuple subset of the attribute matrix proxy
+   * @param amGid
+   * @param name
+   * @param dPtr
+   * @param tupleStart
+   * @param tupleCount
+   * @return
+   */
+  IDataArrayShPtrType extractTupleSubset(hid_t amGid, const QString& name, const IDataArrayShPtrType& dPtr, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount) const;
+
   AttributeMatrix(const AttributeMatrix&);
   void operator=(const AttributeMatrix&);
 };
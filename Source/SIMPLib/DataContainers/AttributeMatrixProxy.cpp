@@ -57,6 +57,8 @@ AttributeMatrixProxy::AttributeMatrixProxy(const AttributeMatrixProxy& amp)
   m_Name = amp.m_Name;
   m_AMType = amp.m_AMType;
   m_DataArrays = amp.m_DataArrays;
+  m_TupleSubsetStart = amp.m_TupleSubsetStart;
+  m_TupleSubsetCount = amp.m_TupleSubsetCount;
 }
 
 // -----------------------------------------------------------------------------
@@ -77,7 +79,8 @@ AttributeMatrixProxy::AttributeMatrixProxy(AttributeMatrixProxy&&) noexcept = de
 // -----------------------------------------------------------------------------
 bool AttributeMatrixProxy::operator==(const AttributeMatrixProxy& amp) const
 {
-  return m_Flag == amp.m_Flag && m_Name == amp.m_Name && m_AMType == amp.m_AMType && m_DataArrays == amp.m_DataArrays;
+  return m_Flag == amp.m_Flag && m_Name == amp.m_Name && m_AMType == amp.m_AMType && m_DataArrays == amp.m_DataArrays && m_TupleSubsetStart == amp.m_TupleSubsetStart &&
+         m_TupleSubsetCount == amp.m_TupleSubsetCount;
 }
 
 // -----------------------------------------------------------------------------
@@ -89,6 +92,20 @@ void AttributeMatrixProxy::writeJson(QJsonObject& json) const
   json["Name"] = m_Name;
   json["Type"] = static_cast<double>(m_AMType);
   json["Data Arrays"] = writeMap(m_DataArrays);
+  if(hasTupleSubset())
+  {
+    QJsonArray startArray;
+    QJsonArray countArray;
+    for(size_t i = 0; i < m_TupleSubsetStart.size(); i++)
+    {
+      startArray.push_back(static_cast<double>(m_TupleSubsetStart[i]));
+      countArray.push_back(static_cast<double>(m_TupleSubsetCount[i]));
+    }
+    QJsonObject subsetObj;
+    subsetObj["Start"] = startArray;
+    subsetObj["Count"] = countArray;
+    json["Tuple Subset"] = subsetObj;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -108,6 +125,23 @@ bool AttributeMatrixProxy::readJson(QJsonObject& json)
       m_AMType = static_cast<AttributeMatrix::Type>(json["Type"].toInt());
     }
     m_DataArrays = readMap(json["Data Arrays"].toArray());
+
+    // The tuple subset is optional so older pipeline files continue to read the whole attribute matrix
+    clearTupleSubset();
+    if(json["Tuple Subset"].isObject())
+    {
+      QJsonObject subsetObj = json["Tuple Subset"].toObject();
+      QJsonArray startArray = subsetObj["Start"].toArray();
+      QJsonArray countArray = subsetObj["Count"].toArray();
+      std::vector<size_t> start;
+      std::vector<size_t> count;
+      for(int i = 0; i < startArray.size() && i < countArray.size(); i++)
+      {
+        start.push_back(static_cast<size_t>(startArray[i].toDouble()));
+        count.push_back(static_cast<size_t>(countArray[i].toDouble()));
+      }
+      setTupleSubset(start, count);
+    }
     return true;
   }
   return false;
@@ -356,3 +390,50 @@ void AttributeMatrixProxy::setFlag(uint8_t newFlag)
 {
   m_Flag = newFlag;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AttributeMatrixProxy::setTupleSubset(const std::vector<size_t>& start, const std::vector<size_t>& count)
+{
+  if(start.size() != count.size() || start.empty())
+  {
+    clearTupleSubset();
+    return;
+  }
+  m_TupleSubsetStart = start;
+  m_TupleSubsetCount = count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AttributeMatrixProxy::clearTupleSubset()
+{
+  m_TupleSubsetStart.clear();
+  m_TupleSubsetCount.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AttributeMatrixProxy::hasTupleSubset() const
+{
+  return !m_TupleSubsetCount.empty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> AttributeMatrixProxy::getTupleSubsetStart() const
+{
+  return m_TupleSubsetStart;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> AttributeMatrixProxy::getTupleSubsetCount() const
+{
+  return m_TupleSubsetCount;
+}
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QtCore/QMap>
 #include <QtCore/QString>
 
@@ -52,6 +54,9 @@ class SIMPLib_EXPORT AttributeMatrixProxy
   PYB11_PROPERTY(AMType AMType READ getAMType WRITE setAMType)
   PYB11_PROPERTY(uint8_t Flag READ getFlag WRITE setFlag)
   PYB11_METHOD(DataArrayProxy getDataArrayProxy ARGS name RETURN_VALUE_POLICY py::return_value_policy::reference)
+  PYB11_METHOD(void setTupleSubset ARGS start count)
+  PYB11_METHOD(void clearTupleSubset)
+  PYB11_METHOD(bool hasTupleSubset)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -212,11 +217,43 @@ public:
    */
   void setFlag(uint8_t);
 
+  /**
+   * @brief Restricts the tuples that are read from the file to a box inside the attribute matrix. Both vectors
+   * use the attribute matrix tuple dimension order (fastest moving dimension first, i.e., XYZ for an Image Geometry)
+   * and must have one entry per tuple dimension. An ImageGeom that owns a Cell attribute matrix with a tuple subset
+   * is cropped to the same box when it is read.
+   * @param start The first tuple index to read along each dimension
+   * @param count The number of tuples to read along each dimension
+   */
+  void setTupleSubset(const std::vector<size_t>& start, const std::vector<size_t>& count);
+
+  /**
+   * @brief Removes any tuple subset so that the whole attribute matrix is read
+   */
+  void clearTupleSubset();
+
+  /**
+   * @brief Returns true if only a sub-box of the tuples should be read from the file
+   */
+  bool hasTupleSubset() const;
+
+  /**
+   * @brief Returns the per dimension start index of the tuple subset
+   */
+  std::vector<size_t> getTupleSubsetStart() const;
+
+  /**
+   * @brief Returns the per dimension number of tuples of the tuple subset
+   */
+  std::vector<size_t> getTupleSubsetCount() const;
+
 private:
   uint8_t m_Flag = Qt::Unchecked;
   QString m_Name;
   AttributeMatrix::Type m_AMType = AttributeMatrix::Type::Unknown;
   StorageType m_DataArrays;
+  std::vector<size_t> m_TupleSubsetStart;
+  std::vector<size_t> m_TupleSubsetCount;
 
   /**
    * @brief writeMap
@@ -35,6 +35,9 @@
 
 #include "DataContainer.h"
 
+#include <array>
+
+#include <QtCore/QStringList>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
@@ -47,12 +50,14 @@
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/Geometry/HexahedralGeom.h"
 #include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Geometry/IGeometryGrid.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/QuadGeom.h"
 #include "SIMPLib/Geometry/RectGridGeom.h"
 #include "SIMPLib/Geometry/TetrahedralGeom.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 #include "SIMPLib/Utilities/STLUtilities.hpp"
 
@@ -275,7 +280,7 @@ int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, DataContainerProxy& dcProxy)
+int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, DataContainerProxy& dcProxy, Observable* obs)
 {
   int err = 0;
   std::vector<size_t> tDims;
@@ -304,6 +309,30 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, Da
       return -1;
     }
 
+    AttributeMatrixProxy amProxy = iter.value();
+    if(amProxy.hasTupleSubset())
+    {
+      if(!H5DataArrayReader::IsValidTupleSubset(tDims, amProxy.getTupleSubsetStart(), amProxy.getTupleSubsetCount()))
+      {
+        if(nullptr != obs)
+        {
+          QStringList dimStrings;
+          for(size_t dim : tDims)
+          {
+            dimStrings << QString::number(dim);
+          }
+          QString ss = QObject::tr("The Tuple Subset of Attribute Matrix '%1/%2' does not fit inside its tuple dimensions (%3)").arg(getName()).arg(amName).arg(dimStrings.join(", "));
+          obs->setErrorCondition(-198745605, ss);
+        }
+        return -198745605;
+      }
+      if(static_cast<AttributeMatrix::Type>(amTypeTmp) == AttributeMatrix::Type::Cell)
+      {
+        cropGeometryToTupleSubset(tDims, amProxy.getTupleSubsetStart(), amProxy.getTupleSubsetCount());
+      }
+      tDims = amProxy.getTupleSubsetCount();
+    }
+
     hid_t amGid = H5Gopen(dcGid, amName.toLatin1().data(), H5P_DEFAULT);
     if(amGid < 0)
     {
@@ -317,7 +346,6 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, Da
       addOrReplaceAttributeMatrix(am);
     }
 
-    AttributeMatrixProxy amProxy = iter.value();
     err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy);
     if(err < 0)
     {
@@ -331,6 +359,62 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, Da
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainer::cropGeometryToTupleSubset(const std::vector<size_t>& tDims, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount)
+{
+  IGeometryGrid::Pointer gridGeom = std::dynamic_pointer_cast<IGeometryGrid>(m_Geometry);
+  if(tDims.size() != 3 || tupleStart.size() != 3 || tupleCount.size() != 3 || nullptr == gridGeom.get())
+  {
+    return;
+  }
+  // Several Cell Attribute Matrices may share the geometry, only the first one crops it
+  SizeVec3Type dims = gridGeom->getDimensions();
+  if(dims[0] != tDims[0] || dims[1] != tDims[1] || dims[2] != tDims[2])
+  {
+    return;
+  }
+
+  ImageGeom::Pointer image = std::dynamic_pointer_cast<ImageGeom>(m_Geometry);
+  if(nullptr != image.get())
+  {
+    FloatVec3Type origin = image->getOrigin();
+    FloatVec3Type spacing = image->getSpacing();
+    for(size_t i = 0; i < 3; i++)
+    {
+      origin[i] = origin[i] + static_cast<float>(tupleStart[i]) * spacing[i];
+    }
+    image->setOrigin(origin);
+    image->setDimensions(tupleCount[0], tupleCount[1], tupleCount[2]);
+    return;
+  }
+
+  RectGridGeom::Pointer rectGrid = std::dynamic_pointer_cast<RectGridGeom>(m_Geometry);
+  if(nullptr != rectGrid.get())
+  {
+    // The bounds arrays hold one more value than there are cells along each axis
+    std::array<FloatArrayType::Pointer, 3> bounds = {rectGrid->getXBounds(), rectGrid->getYBounds(), rectGrid->getZBounds()};
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(nullptr == bounds[i].get())
+      {
+        continue;
+      }
+      FloatArrayType::Pointer cropped = FloatArrayType::CreateArray(tupleCount[i] + 1, bounds[i]->getName(), bounds[i]->isAllocated());
+      if(bounds[i]->isAllocated())
+      {
+        cropped->copyFromArray(0, bounds[i], tupleStart[i], tupleCount[i] + 1);
+      }
+      bounds[i] = cropped;
+    }
+    rectGrid->setXBounds(bounds[0]);
+    rectGrid->setYBounds(bounds[1]);
+    rectGrid->setZBounds(bounds[2]);
+    rectGrid->setDimensions(SizeVec3Type(tupleCount[0], tupleCount[1], tupleCount[2]));
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
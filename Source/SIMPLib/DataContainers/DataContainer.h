@@ -399,9 +399,13 @@ public:
 
   /**
    * @brief Reads desired Attribute Matrices from HDF5 file
+   * @param preflight
+   * @param dcGid
+   * @param dcProxy
+   * @param obs Optional Observable that receives an error message when an Attribute Matrix cannot be read
    * @return
    */
-  virtual int readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, DataContainerProxy& dcProxy);
+  virtual int readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, DataContainerProxy& dcProxy, Observable* obs = nullptr);
 
   /**
    * @brief creates copy of dataContainer
@@ -440,4 +444,13 @@ protected:
 
 private:
   IGeometry::Pointer m_Geometry;
+
+  /**
+   * @brief Crops an ImageGeom or RectGridGeom to the tuple subset requested for its Cell Attribute Matrix so that
+   * the geometry keeps describing the cells that were actually read
+   * @param tDims The tuple dimensions stored in the file. Geometries that no longer match them were already cropped.
+   * @param tupleStart
+   * @param tupleCount
+   */
+  void cropGeometryToTupleSubset(const std::vector<size_t>& tDims, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount);
 };
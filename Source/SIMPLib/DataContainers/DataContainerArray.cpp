@@ -365,7 +365,7 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
       }
       return -198745603;
     }
-    err = this->getDataContainer(dcProxy.getName())->readAttributeMatricesFromHDF5(preflight, dcGid, dcProxy);
+    err = this->getDataContainer(dcProxy.getName())->readAttributeMatricesFromHDF5(preflight, dcGid, dcProxy, obs);
     if(err < 0)
     {
       if(nullptr != obs)
@@ -687,7 +687,7 @@ DataContainerArray::Pointer DataContainerArray::deepCopy(bool forceNoAllocate) c
   MontageCollection mccopy = MontageCollection();
   for(const auto& montage : montageCollection)
   {
-    AbstractMontage::Pointer montageCopy = montage->propagate(dcaCopy);
+    AbstractMontage::Pointer montageCopy = montage->propagate(dcaCopy, forceNoAllocate);
     dcaCopy->addMontage(montageCopy);
   }
 
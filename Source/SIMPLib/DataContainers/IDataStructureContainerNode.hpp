@@ -40,6 +40,8 @@
 #include <string>
 #include <vector>
 
+#include <QtCore/QHash>
+
 #include "IDataStructureNode.h"
 
 template <class DerivedChild_t>
@@ -60,6 +62,57 @@ public:
 
 private:
   ChildCollection m_ChildrenNodes;
+  QHash<QString, size_t> m_ChildIndices; // Child name to position in m_ChildrenNodes
+
+  /**
+   * @brief Returns the position of the child with the given name.
+   * Returns -1 if there is no child with the given name.
+   * @param name
+   * @return
+   */
+  int64_t findIndex(const QString& name) const
+  {
+    auto iter = m_ChildIndices.constFind(name);
+    if(iter == m_ChildIndices.constEnd())
+    {
+      return -1;
+    }
+    return static_cast<int64_t>(iter.value());
+  }
+
+  /**
+   * @brief Removes the child at the given position from the children collection
+   * and the name lookup. The parent connection is not changed.
+   * @param index
+   * @return
+   */
+  ChildShPtr takeChildAt(size_t index)
+  {
+    ChildShPtr child = m_ChildrenNodes[index];
+    m_ChildIndices.remove(child->getName());
+    m_ChildrenNodes.erase(m_ChildrenNodes.begin() + index);
+    for(size_t i = index; i < m_ChildrenNodes.size(); i++)
+    {
+      m_ChildIndices[m_ChildrenNodes[i]->getName()] = i;
+    }
+    return child;
+  }
+
+  /**
+   * @brief Moves the name lookup entry of a child that was renamed.
+   * @param child
+   * @param oldName
+   */
+  void updateChildName(const IDataStructureNode* child, const QString& oldName) override
+  {
+    int64_t index = findIndex(oldName);
+    if(index < 0 || m_ChildrenNodes[index].get() != child)
+    {
+      return;
+    }
+    m_ChildIndices.remove(oldName);
+    m_ChildIndices.insert(child->getName(), static_cast<size_t>(index));
+  }
 
 protected:
 public:
@@ -210,7 +263,10 @@ public:
    */
   constexpr void clear() noexcept
   {
-    auto children = getChildren();
+    // Empty the collection first so the children do not remove themselves one at a time
+    ChildCollection children;
+    children.swap(m_ChildrenNodes);
+    m_ChildIndices.clear();
     for(auto& child : children)
     {
       if(child != nullptr)
@@ -218,7 +274,6 @@ public:
         destroyParentConnection(child.get());
       }
     }
-    m_ChildrenNodes.clear();
   }
 
   /**
@@ -229,16 +284,12 @@ public:
    */
   constexpr iterator find(const QString& name)
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
+    int64_t index = findIndex(name);
+    if(index < 0)
     {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
+      return end();
     }
-
-    return end();
+    return begin() + index;
   }
 
   /**
@@ -249,16 +300,12 @@ public:
    */
   constexpr const_iterator find(const QString& name) const
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
+    int64_t index = findIndex(name);
+    if(index < 0)
     {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
+      return cend();
     }
-
-    return cend();
+    return cbegin() + index;
   }
 
   /**
@@ -269,17 +316,12 @@ public:
    */
   constexpr ChildShPtr getChildByName(const QString& name) const
   {
-    HashType nameHash = CreateStringHash(name);
-
-    const auto& children = getChildren();
-    for(const auto& child : children)
+    int64_t index = findIndex(name);
+    if(index < 0)
     {
-      if(child->checkNameHash(nameHash))
-      {
-        return child;
-      }
+      return nullptr;
     }
-    return nullptr;
+    return m_ChildrenNodes[index];
   }
 
   /**
@@ -290,7 +332,7 @@ public:
    */
   constexpr bool contains(const QString& name) const
   {
-    return getChildByName(name) != nullptr;
+    return m_ChildIndices.contains(name);
   }
 
   /**
@@ -301,15 +343,11 @@ public:
    */
   constexpr bool contains(const ChildShPtr& obj) const
   {
-    const auto& children = getChildren();
-    for(const auto& child : children)
+    if(nullptr == obj)
     {
-      if(child == obj)
-      {
-        return true;
-      }
+      return false;
     }
-    return false;
+    return getChildByName(obj->getName()) == obj;
   }
 
   /**
@@ -320,12 +358,7 @@ public:
    */
   constexpr int64_t getIndex(const QString& name) const
   {
-    auto iter = find(name);
-    if(iter == cend())
-    {
-      return -1;
-    }
-    return iter - begin();
+    return findIndex(name);
   }
 
   /**
@@ -385,6 +418,7 @@ public:
     }
     typename ChildCollection::size_type size = m_ChildrenNodes.size();
     m_ChildrenNodes.push_back(node);
+    m_ChildIndices.insert(node->getName(), size);
 
     createParentConnection(node.get(), this);
     return (size != m_ChildrenNodes.size());
@@ -417,6 +451,7 @@ public:
       }
     }
 
+    m_ChildIndices.insert(node->getName(), m_ChildrenNodes.size());
     m_ChildrenNodes.push_back(node);
     createParentConnection(node.get(), this);
     return true;
@@ -428,8 +463,7 @@ public:
    */
   void erase(iterator iter)
   {
-    ChildShPtr child = (*iter);
-    m_ChildrenNodes.erase(iter);
+    ChildShPtr child = takeChildAt(static_cast<size_t>(iter - begin()));
     destroyParentConnection(child.get());
   }
 
@@ -445,16 +479,12 @@ public:
       return NullPointer();
     }
 
-    for(auto iter = m_ChildrenNodes.begin(); iter != m_ChildrenNodes.end(); ++iter)
+    int64_t index = findIndex(rmChild->getName());
+    if(index < 0 || m_ChildrenNodes[index].get() != rmChild)
     {
-      if((*iter).get() == rmChild)
-      {
-        ChildShPtr ptr = *iter;
-        m_ChildrenNodes.erase(iter);
-        return ptr;
-      }
+      return NullPointer();
     }
 
-    return NullPointer();
+    return takeChildAt(static_cast<size_t>(index));
   }
 };
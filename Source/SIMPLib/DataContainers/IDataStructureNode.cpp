@@ -112,8 +112,10 @@ bool IDataStructureNode::setName(const QString& newName)
   }
   else if(!m_Parent->hasChildWithName(newName))
   {
+    const QString oldName = m_Name;
     m_Name = newName;
     updateNameHash();
+    m_Parent->updateChildName(this, oldName);
     return true;
   }
 
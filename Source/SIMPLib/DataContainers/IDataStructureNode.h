@@ -209,6 +209,16 @@ public:
    */
   virtual IDataStructureNode::Pointer removeChildNode(const IDataStructureNode* rmChild) = 0;
 
+private:
+  friend IDataStructureNode;
+
+  /**
+   * @brief Called after a child node was renamed so that name lookups stay in sync.
+   * @param child
+   * @param oldName
+   */
+  virtual void updateChildName(const IDataStructureNode* child, const QString& oldName) = 0;
+
 protected:
   /**
    * @brief Sets the child's parent container.  This does not add the child to the parent's collection.
@@ -0,0 +1,161 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class IDataStructureContainerNodeTest
+{
+  const size_t k_ArrayCount = 2000;
+
+public:
+  IDataStructureContainerNodeTest() = default;
+  ~IDataStructureContainerNodeTest() = default;
+  IDataStructureContainerNodeTest(const IDataStructureContainerNodeTest&) = delete;            // Copy Constructor
+  IDataStructureContainerNodeTest(IDataStructureContainerNodeTest&&) = delete;                 // Move Constructor
+  IDataStructureContainerNodeTest& operator=(const IDataStructureContainerNodeTest&) = delete; // Copy Assignment
+  IDataStructureContainerNodeTest& operator=(IDataStructureContainerNodeTest&&) = delete;      // Move Assignment
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AttributeMatrix::Pointer createAttributeMatrix() const
+  {
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New({1}, "CellData", AttributeMatrix::Type::Cell);
+    for(size_t i = 0; i < k_ArrayCount; i++)
+    {
+      attrMat->insertOrAssign(Int32ArrayType::CreateArray(1, QString("Array_%1").arg(i), true));
+    }
+    return attrMat;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool indicesMatchNames(const AttributeMatrix& attrMat) const
+  {
+    for(size_t i = 0; i < attrMat.size(); i++)
+    {
+      if(attrMat.getIndex(attrMat.getChildren()[i]->getName()) != static_cast<int64_t>(i))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestInsertAndRemove()
+  {
+    AttributeMatrix::Pointer attrMat = createAttributeMatrix();
+    DREAM3D_REQUIRE_EQUAL(attrMat->size(), k_ArrayCount)
+    DREAM3D_REQUIRE(attrMat->contains("Array_1999"))
+    DREAM3D_REQUIRE_EQUAL(attrMat->getIndex("Array_10"), 10)
+
+    IDataArray::Pointer array = attrMat->getAttributeArray("Array_10");
+    DREAM3D_REQUIRE_VALID_POINTER(array)
+    DREAM3D_REQUIRE(attrMat->contains(array))
+    attrMat->removeAttributeArray("Array_10");
+    DREAM3D_REQUIRE(!attrMat->contains("Array_10"))
+    DREAM3D_REQUIRE(!attrMat->contains(array))
+    DREAM3D_REQUIRE_EQUAL(attrMat->getIndex("Array_11"), 10)
+    DREAM3D_REQUIRE(indicesMatchNames(*attrMat))
+
+    // Replacing an array keeps a single entry for its name
+    Int32ArrayType::Pointer replacement = Int32ArrayType::CreateArray(1, std::string("Array_20"), true);
+    attrMat->insertOrAssign(replacement);
+    DREAM3D_REQUIRE_EQUAL(attrMat->size(), k_ArrayCount - 1)
+    DREAM3D_REQUIRE(attrMat->getAttributeArray("Array_20") == replacement)
+    DREAM3D_REQUIRE(indicesMatchNames(*attrMat))
+
+    attrMat->clear();
+    DREAM3D_REQUIRE(attrMat->empty())
+    DREAM3D_REQUIRE(!attrMat->contains("Array_0"))
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRenameAndMove()
+  {
+    AttributeMatrix::Pointer attrMat = createAttributeMatrix();
+    IDataArray::Pointer array = attrMat->getAttributeArray("Array_5");
+
+    DREAM3D_REQUIRE_EQUAL(attrMat->renameAttributeArray("Array_5", "Renamed"), RenameErrorCodes::SUCCESS)
+    DREAM3D_REQUIRE(!attrMat->contains("Array_5"))
+    DREAM3D_REQUIRE(attrMat->getAttributeArray("Renamed") == array)
+    DREAM3D_REQUIRE_EQUAL(attrMat->renameAttributeArray("Array_6", "Renamed"), RenameErrorCodes::NEW_EXISTS)
+
+    // Renaming the array directly keeps its container in sync as well
+    DREAM3D_REQUIRE(array->setName("Array_5"))
+    DREAM3D_REQUIRE(attrMat->getAttributeArray("Array_5") == array)
+    DREAM3D_REQUIRE(!attrMat->contains("Renamed"))
+
+    // Moving the array to another container removes it from the first one
+    AttributeMatrix::Pointer otherAttrMat = AttributeMatrix::New({1}, "OtherData", AttributeMatrix::Type::Cell);
+    otherAttrMat->insertOrAssign(array);
+    DREAM3D_REQUIRE(!attrMat->contains("Array_5"))
+    DREAM3D_REQUIRE(otherAttrMat->getAttributeArray("Array_5") == array)
+    DREAM3D_REQUIRE(indicesMatchNames(*attrMat))
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dc->insertOrAssign(attrMat);
+    dca->insertOrAssign(dc);
+    DREAM3D_REQUIRE(dca->renameDataContainer("DataContainer", "Renamed"))
+    DREAM3D_REQUIRE(dca->getDataContainer("Renamed") == dc)
+    DREAM3D_REQUIRE(dca->getPrereqArrayFromPath<Int32ArrayType>(nullptr, DataArrayPath("Renamed", "CellData", "Array_1999")) != nullptr)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestInsertAndRemove())
+    DREAM3D_REGISTER_TEST(TestRenameAndMove())
+  }
+};
@@ -35,6 +35,13 @@
 
 #include "FilterPipeline.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <set>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -45,7 +52,11 @@
 #include "SIMPLib/Filtering/BadFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/PipelineDependencyGraph.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
+#include "SIMPLib/Messages/AbstractErrorMessage.h"
 #include "SIMPLib/Messages/AbstractMessageHandler.h"
+#include "SIMPLib/Messages/AbstractWarningMessage.h"
 #include "SIMPLib/Messages/FilterErrorMessage.h"
 #include "SIMPLib/Messages/FilterProgressMessage.h"
 #include "SIMPLib/Messages/FilterStatusMessage.h"
@@ -54,8 +65,13 @@
 #include "SIMPLib/Messages/PipelineProgressMessage.h"
 #include "SIMPLib/Messages/PipelineStatusMessage.h"
 #include "SIMPLib/Messages/PipelineWarningMessage.h"
+#include "SIMPLib/Utilities/SIMPLH5Mutex.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_group.h>
+#endif
+
 #define RENAME_ENABLED 1
 
 /**
@@ -141,6 +157,9 @@ FilterPipeline::Pointer FilterPipeline::deepCopy()
   // Convert from JSon
   FilterPipeline::Pointer copy = FilterPipeline::New();
   copy->fromJson(json);
+  copy->setReleaseDeadArrays(m_ReleaseDeadArrays);
+  copy->setExecuteConcurrently(m_ExecuteConcurrently);
+  copy->setPreservedPaths(m_PreservedPaths);
 
   return copy;
 }
@@ -361,6 +380,14 @@ void FilterPipeline::cancel()
   {
     m_CurrentFilter->setCancel(true);
   }
+  if(m_ExecuteConcurrently)
+  {
+    // More than one filter may be running
+    for(const auto& filter : m_Pipeline)
+    {
+      filter->setCancel(true);
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -719,10 +746,14 @@ void FilterPipeline::connectFilterNotifications(AbstractFilter* filter)
     connect(filter, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), messageReceiver, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)));
   }
 
-  connect(filter, &AbstractFilter::messageGenerated, [=](AbstractMessage::Pointer msg) {
-    FilterPipelineMessageHandler msgHandler(this);
-    msg->visit(&msgHandler);
-  });
+  // Filters only emit on the thread that runs them here. Concurrent execution relays worker thread messages instead.
+  connect(
+      filter, &AbstractFilter::messageGenerated, this,
+      [=](AbstractMessage::Pointer msg) {
+        FilterPipelineMessageHandler msgHandler(this);
+        msg->visit(&msgHandler);
+      },
+      Qt::DirectConnection);
 }
 
 // -----------------------------------------------------------------------------
@@ -742,6 +773,14 @@ void FilterPipeline::disconnectFilterNotifications(AbstractFilter* filter)
 //
 // -----------------------------------------------------------------------------
 int FilterPipeline::preflightPipeline()
+{
+  return preflightPipelineFrom(DataContainerArray::NullPointer());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterPipeline::preflightPipelineFrom(const DataContainerArray::Pointer& initialDca)
 {
   if(m_State != FilterPipeline::State::Idle)
   {
@@ -755,18 +794,64 @@ int FilterPipeline::preflightPipeline()
   // Create the DataContainer object
   DataContainerArray::Pointer dca = DataContainerArray::New();
 
+  // Cached snapshots assume the pipeline starts from an empty DataContainerArray
+  PipelinePreflightCache::Pointer preflightCache = m_PreflightCache;
+  if(nullptr != initialDca && initialDca->getNumDataContainers() > 0)
+  {
+    dca = initialDca->deepCopy(true);
+    preflightCache.reset();
+  }
+
   clearErrorCode();
   int preflightError = 0;
 
   DataArrayPath::RenameContainer renamedPaths;
 
+  // The structure before the current filter. Snapshots are never modified after they are created so the
+  // same object is handed to the previous filter, the rename pass of the current filter and the cache.
+  DataContainerArray::Pointer snapshot = dca->deepCopy(false);
+
+  // Resume after the last filter that did not change since the cached preflight
+  int startIndex = 0;
+  if(nullptr != preflightCache)
+  {
+    startIndex = static_cast<int>(preflightCache->invalidateChanged(m_Pipeline));
+    for(int i = 0; i < startIndex; i++)
+    {
+      const AbstractFilter::Pointer& filter = m_Pipeline.at(i);
+      restoreCachedPreflight(filter, preflightCache->at(static_cast<size_t>(i)));
+      if(filter->getEnabled())
+      {
+        preflightError |= filter->getErrorCode();
+      }
+    }
+    if(startIndex > 0)
+    {
+      const PipelinePreflightCache::Snapshot& cached = preflightCache->at(static_cast<size_t>(startIndex - 1));
+      snapshot = cached.dataContainerArray;
+      renamedPaths = cached.renamedPaths;
+      dca = snapshot->deepCopy(false);
+    }
+  }
+
   // Start looping through each filter in the Pipeline and preflight everything
-  for(const auto& filter : m_Pipeline)
+  for(int index = startIndex; index < m_Pipeline.size(); index++)
   {
+    if(m_PreflightCanceled)
+    {
+      QString ss = QObject::tr("Preflight of pipeline '%1' was canceled.").arg(getName());
+      preflightError = -204;
+      setErrorCondition(preflightError, ss);
+      break;
+    }
+
+    const AbstractFilter::Pointer& filter = m_Pipeline.at(index);
+    std::vector<PipelinePreflightCache::Issue> issues;
+
     // Do not preflight disabled filters
     if(filter->getEnabled())
     {
-      filter->setDataContainerArray(dca->deepCopy(true));
+      filter->setDataContainerArray(snapshot);
 #if RENAME_ENABLED
       // Avoid renaming filters as soon as they are added to the pipeline
       if(filter->property("HasRenameValues").toBool())
@@ -782,13 +867,36 @@ int FilterPipeline::preflightPipeline()
       filter->setDataContainerArray(dca);
       setCurrentFilter(filter);
       connectFilterNotifications(filter.get());
+      if(nullptr != preflightCache)
+      {
+        // Remember the errors and warnings so they can be reported again while the snapshot is valid
+        connect(filter.get(), &AbstractFilter::messageGenerated, [&issues](const AbstractMessage::Pointer& msg) {
+          if(const auto* errorMsg = dynamic_cast<const AbstractErrorMessage*>(msg.get()))
+          {
+            issues.push_back({true, errorMsg->getCode(), errorMsg->getMessageText()});
+          }
+          else if(const auto* warningMsg = dynamic_cast<const AbstractWarningMessage*>(msg.get()))
+          {
+            issues.push_back({false, warningMsg->getCode(), warningMsg->getMessageText()});
+          }
+        });
+      }
       filter->clearRenamedPaths();
-      filter->preflight();
+      {
+        // Preflights may run on a worker thread while the GUI thread reads files, and HDF5 is not thread safe
+        SIMPLH5Mutex::LockType h5Lock;
+        if(PipelineDependencyGraph::AccessesFiles(filter.get()))
+        {
+          h5Lock = SIMPLH5Mutex::Lock();
+        }
+        filter->preflight();
+      }
       disconnectFilterNotifications(filter.get());
 
       filter->setCancel(false); // Reset the cancel flag
       preflightError |= filter->getErrorCode();
-      filter->setDataContainerArray(dca->deepCopy(false));
+      snapshot = dca->deepCopy(false);
+      filter->setDataContainerArray(snapshot);
 #if RENAME_ENABLED
       // Check if an existing renamed path was deleted by this filter
       const std::list<DataArrayPath> deletedPaths = filter->getDeletedPaths();
@@ -830,7 +938,7 @@ int FilterPipeline::preflightPipeline()
     else
     {
       // Some widgets require the updated path to be valid before it can be set in the widget
-      filter->setDataContainerArray(dca->deepCopy(false));
+      filter->setDataContainerArray(snapshot);
       filter->renameDataArrayPaths(renamedPaths);
 
       // Undo filter renaming
@@ -844,12 +952,62 @@ int FilterPipeline::preflightPipeline()
       }
     }
 #endif
+
+    if(nullptr != preflightCache)
+    {
+      PipelinePreflightCache::Snapshot cached;
+      cached.filter = filter;
+      cached.enabled = filter->getEnabled();
+      cached.parameters = PipelinePreflightCache::Fingerprint(filter.get());
+      cached.dataContainerArray = snapshot;
+      cached.renamedPaths = renamedPaths;
+      cached.issues = std::move(issues);
+      preflightCache->store(static_cast<size_t>(index), std::move(cached));
+    }
   }
   setCurrentFilter(AbstractFilter::NullPointer());
+  m_PreflightCanceled = false;
 
   return preflightError;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::cancelPreflight()
+{
+  m_PreflightCanceled = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::restoreCachedPreflight(const AbstractFilter::Pointer& filter, const PipelinePreflightCache::Snapshot& snapshot)
+{
+  filter->setDataContainerArray(snapshot.dataContainerArray);
+  if(!filter->getEnabled())
+  {
+    return;
+  }
+
+  // Setting the conditions again restores the error and warning codes and sends the messages to the receivers
+  setCurrentFilter(filter);
+  connectFilterNotifications(filter.get());
+  for(const PipelinePreflightCache::Issue& issue : snapshot.issues)
+  {
+    if(issue.isError)
+    {
+      filter->setErrorCondition(issue.code, issue.messageText);
+    }
+    else
+    {
+      filter->setWarningCondition(issue.code, issue.messageText);
+    }
+  }
+  disconnectFilterNotifications(filter.get());
+  filter->setCancel(false);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -873,10 +1031,20 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
     return DataContainerArray::NullPointer();
   }
 
-  int err = 0;
-
   connectSignalsSlots();
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // The dependency graph needs the paths each filter creates, which are only known after a preflight
+  if(m_ExecuteConcurrently && preflightPipelineFrom(dca) < 0)
+  {
+    QString ss = QObject::tr("Pipeline '%1' could not be executed because its preflight failed.").arg(getName());
+    setErrorCondition(-205, ss);
+    notifyProgressMessage(100, "");
+    finishFailedPipeline();
+    return DataContainerArray::NullPointer();
+  }
+#endif
+
   m_ExecutionResult = FilterPipeline::ExecutionResult::Invalid;
 
   m_State = FilterPipeline::State::Executing;
@@ -888,9 +1056,68 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
   QTextStream out(&msg);
   out << "Pipline Start: " << now.toString(Qt::ISODate);
   notifyStatusMessage(msg);
+
+  std::unique_ptr<PipelineMemoryPlanner> memoryPlanner;
+  if(m_ReleaseDeadArrays)
+  {
+    memoryPlanner = std::make_unique<PipelineMemoryPlanner>(m_Pipeline, m_PreservedPaths);
+  }
+
+  bool completed = false;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(m_ExecuteConcurrently)
+  {
+    completed = executeDependencyGraph(memoryPlanner.get());
+  }
+  else
+#endif
+  {
+    completed = executeSequentially(memoryPlanner.get());
+  }
+  if(!completed)
+  {
+    return m_Dca;
+  }
+
+  now = QDateTime::currentDateTime();
+  msg.clear();
+  out << "Pipline End: " << now.toString(Qt::ISODate);
+  notifyStatusMessage(msg);
+
+  disconnectSignalsSlots();
+
+  switch(m_State)
+  {
+  case FilterPipeline::State::Canceling:
+    m_ExecutionResult = FilterPipeline::ExecutionResult::Canceled;
+    notifyStatusMessage("Pipeline Canceled");
+    break;
+  case FilterPipeline::State::Executing:
+    m_ExecutionResult = FilterPipeline::ExecutionResult::Completed;
+    notifyStatusMessage("Pipeline Complete");
+    break;
+  case FilterPipeline::State::Idle:
+    throw PipelineIdleException();
+    break;
+  }
+
+  m_State = FilterPipeline::State::Idle;
+
+  Q_EMIT pipelineFinished();
+
+  return m_Dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::executeSequentially(PipelineMemoryPlanner* memoryPlanner)
+{
   // Start looping through the Pipeline
+  int pipelineIndex = -1;
   for(const auto& filt : m_Pipeline)
   {
+    pipelineIndex++;
     int filtIndex = filt->getPipelineIndex();
     QString ss = QObject::tr("[%1/%2] %3").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
     notifyStatusMessage(ss);
@@ -907,20 +1134,18 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
       filt->execute();
       disconnectFilterNotifications(filt.get());
       filt->setDataContainerArray(DataContainerArray::NullPointer());
-      err = filt->getErrorCode();
+      // Filters fetch their array pointers again on every run, so arrays written by this one can be shared by deep copies again
+      IDataArray::ReleaseWritablePointers();
+      int err = filt->getErrorCode();
       if(err < 0)
       {
-        ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
-        setErrorCondition(err, ss);
-
-        notifyProgressMessage(100, "");
+        finishFailedExecution(filt, err);
+        return false;
+      }
 
-        Q_EMIT filt->filterCompleted(filt.get());
-        Q_EMIT pipelineFinished();
-        disconnectSignalsSlots();
-        m_State = FilterPipeline::State::Idle;
-        m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
-        return m_Dca;
+      if(nullptr != memoryPlanner)
+      {
+        releaseDeadArrays(memoryPlanner, pipelineIndex, filt);
       }
     }
 
@@ -936,33 +1161,364 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
 
     notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
   }
-  now = QDateTime::currentDateTime();
-  msg.clear();
-  out << "Pipline End: " << now.toString(Qt::ISODate);
-  notifyStatusMessage(msg);
+  return true;
+}
 
-  disconnectSignalsSlots();
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::executeDependencyGraph(PipelineMemoryPlanner* memoryPlanner)
+{
+  PipelineDependencyGraph graph(m_Pipeline);
+  const int numFilters = m_Pipeline.size();
 
-  switch(m_State)
+  // Ready filters are launched in pipeline order
+  std::vector<size_t> pendingDependencies(numFilters, 0);
+  std::set<int> readyFilters;
+  for(int i = 0; i < numFilters; i++)
   {
-  case FilterPipeline::State::Canceling:
-    m_ExecutionResult = FilterPipeline::ExecutionResult::Canceled;
-    notifyStatusMessage("Pipeline Canceled");
-    break;
-  case FilterPipeline::State::Executing:
-    m_ExecutionResult = FilterPipeline::ExecutionResult::Completed;
-    notifyStatusMessage("Pipeline Complete");
-    break;
-  case FilterPipeline::State::Idle:
-    throw PipelineIdleException();
-    break;
+    pendingDependencies[i] = graph.getDependencies(i).size();
+    if(pendingDependencies[i] == 0)
+    {
+      readyFilters.insert(i);
+    }
   }
 
-  m_State = FilterPipeline::State::Idle;
+  std::vector<DataContainerArray::Pointer> localDcas(numFilters);
+  std::vector<std::exception_ptr> exceptions(numFilters);
+  std::vector<bool> finished(numFilters, false);
+  std::deque<int> finishedQueue;
+  std::deque<AbstractMessage::Pointer> pendingMessages;
+  std::mutex mutex;
+  std::condition_variable finishedCondition;
+  tbb::task_group taskGroup;
+
+  int running = 0;
+  int numFinished = 0;
+  int finishedPrefix = -1;
+  int failedIndex = -1;
+  int failedError = 0;
+  int exceptionIndex = -1;
+
+  while(true)
+  {
+    while(failedIndex < 0 && exceptionIndex < 0 && m_State != FilterPipeline::State::Canceling && !readyFilters.empty())
+    {
+      int index = *readyFilters.begin();
+      readyFilters.erase(readyFilters.begin());
+      const AbstractFilter::Pointer& filt = m_Pipeline.at(index);
+
+      QString ss = QObject::tr("[%1/%2] %3").arg(filt->getPipelineIndex() + 1).arg(numFilters).arg(filt->getHumanLabel());
+      notifyStatusMessage(ss);
+      Q_EMIT filt->filterInProgress(filt.get());
+
+      running++;
+      if(!filt->getEnabled())
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        finishedQueue.push_back(index);
+        continue;
+      }
 
+      // Barriers run alone and see the whole DataContainerArray. Every other filter gets a private
+      // DataContainerArray holding only the DataContainers it touches so that concurrently running
+      // filters never modify the same container.
+      DataContainerArray::Pointer localDca = m_Dca;
+      if(!graph.isBarrier(index))
+      {
+        localDca = DataContainerArray::New();
+        for(const QString& dcName : graph.getDataContainers(index))
+        {
+          auto iter = m_Dca->find(dcName);
+          if(iter != m_Dca->end())
+          {
+            DataContainer::Pointer dc = *iter;
+            m_Dca->erase(iter);
+            localDca->push_back(dc);
+          }
+        }
+      }
+      localDcas[index] = localDca;
+
+      // Messages are emitted on worker threads, so they are queued and dispatched on this thread
+      connect(
+          filt.get(), &AbstractFilter::messageGenerated, this,
+          [&mutex, &pendingMessages, &finishedCondition](const AbstractMessage::Pointer& msg) {
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              pendingMessages.push_back(msg);
+            }
+            finishedCondition.notify_one();
+          },
+          Qt::DirectConnection);
+      filt->setDataContainerArray(localDca);
+      setCurrentFilter(filt);
+
+      AbstractFilter* filterPtr = filt.get();
+      bool accessesFiles = graph.accessesFiles(index);
+      std::exception_ptr& filterException = exceptions[index];
+      taskGroup.run([filterPtr, index, accessesFiles, &filterException, &mutex, &finishedQueue, &finishedCondition]() {
+        try
+        {
+          // The graph already keeps file filters in one lane. The lock also keeps out HDF5 users outside the pipeline.
+          SIMPLH5Mutex::LockType h5Lock;
+          if(accessesFiles)
+          {
+            h5Lock = SIMPLH5Mutex::Lock();
+          }
+          filterPtr->execute();
+        } catch(...)
+        {
+          filterException = std::current_exception();
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          finishedQueue.push_back(index);
+        }
+        finishedCondition.notify_one();
+      });
+    }
+
+    if(running == 0)
+    {
+      break;
+    }
+
+    int index = -1;
+    std::deque<AbstractMessage::Pointer> messages;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      finishedCondition.wait(lock, [&finishedQueue, &pendingMessages]() { return !finishedQueue.empty() || !pendingMessages.empty(); });
+      messages.swap(pendingMessages);
+      if(!finishedQueue.empty())
+      {
+        index = finishedQueue.front();
+        finishedQueue.pop_front();
+      }
+    }
+    for(const AbstractMessage::Pointer& msg : messages)
+    {
+      dispatchFilterMessage(msg);
+    }
+    if(index < 0)
+    {
+      continue;
+    }
+    running--;
+
+    const AbstractFilter::Pointer& filt = m_Pipeline.at(index);
+    if(filt->getEnabled())
+    {
+      disconnect(filt.get(), &AbstractFilter::messageGenerated, this, nullptr);
+      filt->setDataContainerArray(DataContainerArray::NullPointer());
+      // Other filters that are still running may keep writing through their array pointers
+      if(running == 0)
+      {
+        IDataArray::ReleaseWritablePointers();
+      }
+
+      // Return the DataContainers to the pipeline's DataContainerArray
+      DataContainerArray::Pointer localDca = localDcas[index];
+      localDcas[index].reset();
+      if(localDca != m_Dca)
+      {
+        for(const DataContainer::Pointer& dc : localDca->getDataContainers())
+        {
+          localDca->erase(localDca->find(dc->getName()));
+          m_Dca->insertOrAssign(dc);
+        }
+      }
+
+      // Report the failure with the lowest pipeline index so the outcome does not depend on timing
+      if(exceptions[index])
+      {
+        exceptionIndex = (exceptionIndex < 0) ? index : std::min(exceptionIndex, index);
+        continue;
+      }
+      int err = filt->getErrorCode();
+      if(err < 0)
+      {
+        if(failedIndex < 0 || index < failedIndex)
+        {
+          failedIndex = index;
+          failedError = err;
+        }
+        continue;
+      }
+    }
+
+    finished[index] = true;
+    numFinished++;
+    while(finishedPrefix + 1 < numFilters && finished[finishedPrefix + 1])
+    {
+      finishedPrefix++;
+    }
+
+    // Only arrays that no filter after the fully finished prefix of the pipeline references can be released
+    if(nullptr != memoryPlanner && filt->getEnabled())
+    {
+      releaseDeadArrays(memoryPlanner, finishedPrefix, filt);
+    }
+
+    if(m_State != FilterPipeline::State::Canceling)
+    {
+      Q_EMIT filt->filterCompleted(filt.get());
+      notifyProgressMessage(static_cast<int>(static_cast<float>(numFinished) / numFilters * 100.0f), "");
+    }
+
+    for(int dependent : graph.getDependents(index))
+    {
+      pendingDependencies[dependent]--;
+      if(pendingDependencies[dependent] == 0)
+      {
+        readyFilters.insert(dependent);
+      }
+    }
+  }
+  taskGroup.wait();
+  setCurrentFilter(AbstractFilter::NullPointer());
+
+  if(m_State == FilterPipeline::State::Canceling)
+  {
+    // Clear cancel filter state
+    for(const auto& filt : m_Pipeline)
+    {
+      filt->setCancel(false);
+    }
+  }
+
+  if(exceptionIndex >= 0)
+  {
+    std::rethrow_exception(exceptions[exceptionIndex]);
+  }
+
+  if(failedIndex >= 0)
+  {
+    finishFailedExecution(m_Pipeline.at(failedIndex), failedError);
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::dispatchFilterMessage(const AbstractMessage::Pointer& msg)
+{
+  for(const auto& messageReceiver : m_MessageReceivers)
+  {
+    QMetaObject::invokeMethod(messageReceiver, "processPipelineMessage", Q_ARG(AbstractMessage::Pointer, msg));
+  }
+
+  FilterPipelineMessageHandler msgHandler(this);
+  msg->visit(&msgHandler);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::finishFailedExecution(const AbstractFilter::Pointer& filt, int err)
+{
+  int filtIndex = filt->getPipelineIndex();
+  QString ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+  setErrorCondition(err, ss);
+
+  notifyProgressMessage(100, "");
+
+  Q_EMIT filt->filterCompleted(filt.get());
+  finishFailedPipeline();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::finishFailedPipeline()
+{
   Q_EMIT pipelineFinished();
+  disconnectSignalsSlots();
+  m_State = FilterPipeline::State::Idle;
+  m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
+}
 
-  return m_Dca;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::releaseDeadArrays(PipelineMemoryPlanner* memoryPlanner, int pipelineIndex, const AbstractFilter::Pointer& filt)
+{
+  size_t releasedBytes = 0;
+  size_t releasedCount = memoryPlanner->releaseDeadArrays(pipelineIndex, m_Dca, releasedBytes);
+  if(releasedCount > 0)
+  {
+    double releasedMB = static_cast<double>(releasedBytes) / (1024.0 * 1024.0);
+    QString ss = QObject::tr("[%1/%2] Released %3 unused arrays (%4 MB)").arg(filt->getPipelineIndex() + 1).arg(m_Pipeline.size()).arg(releasedCount).arg(releasedMB, 0, 'f', 2);
+    notifyStatusMessage(ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setExecuteConcurrently(bool value)
+{
+  m_ExecuteConcurrently = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::getExecuteConcurrently() const
+{
+  return m_ExecuteConcurrently;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setReleaseDeadArrays(bool value)
+{
+  m_ReleaseDeadArrays = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::getReleaseDeadArrays() const
+{
+  return m_ReleaseDeadArrays;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setPreservedPaths(const std::vector<DataArrayPath>& value)
+{
+  m_PreservedPaths = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<DataArrayPath> FilterPipeline::getPreservedPaths() const
+{
+  return m_PreservedPaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setPreflightCache(const PipelinePreflightCache::Pointer& value)
+{
+  m_PreflightCache = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelinePreflightCache::Pointer FilterPipeline::getPreflightCache() const
+{
+  return m_PreflightCache;
 }
 
 // -----------------------------------------------------------------------------
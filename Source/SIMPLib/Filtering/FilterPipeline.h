@@ -35,7 +35,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
@@ -46,9 +48,11 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/PipelinePreflightCache.h"
 
 class IObserver;
 class FilterPipelineMessageHandler;
+class PipelineMemoryPlanner;
 class DataContainerArray;
 using DataContainerArrayShPtrType = std::shared_ptr<DataContainerArray>;
 
@@ -200,6 +204,12 @@ public:
    */
   virtual int preflightPipeline();
 
+  /**
+   * @brief Asks a preflight that is running on another thread to stop before the next filter. The preflight
+   * then returns -204. Snapshots of the filters that were already preflighted stay in the preflight cache.
+   */
+  void cancelPreflight();
+
   /**
    * @brief
    */
@@ -280,6 +290,61 @@ public:
    */
   void clearWarningCode();
 
+  /**
+   * @brief Enables concurrent execution. When enabled, execute() builds a PipelineDependencyGraph from the
+   * DataArrayPaths each filter references and runs filters that touch disjoint DataContainers at the same
+   * time. execute() preflights the pipeline first so that created paths are known and fails with -205 if
+   * the preflight fails. Filters with file parameters run one at a time while holding SIMPLH5Mutex.
+   * Falls back to sequential execution when SIMPLib is built without parallel algorithms.
+   * @param value
+   */
+  void setExecuteConcurrently(bool value);
+
+  /**
+   * @brief Returns true if execute() runs independent filters concurrently.
+   * @return
+   */
+  bool getExecuteConcurrently() const;
+
+  /**
+   * @brief Enables the pipeline memory planner. When enabled, execute() removes each DataArray from the
+   * DataContainerArray as soon as the last filter that references it has finished.
+   * @param value
+   */
+  void setReleaseDeadArrays(bool value);
+
+  /**
+   * @brief Returns true if execute() releases arrays that are no longer referenced by later filters.
+   * @return
+   */
+  bool getReleaseDeadArrays() const;
+
+  /**
+   * @brief Sets the paths that the memory planner must keep alive because they are outputs of the
+   * pipeline. DataContainer and AttributeMatrix paths preserve every array below them.
+   * @param value
+   */
+  void setPreservedPaths(const std::vector<DataArrayPath>& value);
+
+  /**
+   * @brief Returns the paths the memory planner keeps alive.
+   * @return
+   */
+  std::vector<DataArrayPath> getPreservedPaths() const;
+
+  /**
+   * @brief Sets the cache preflightPipeline() uses to skip the leading filters that did not change since the
+   * last preflight. The cache may be shared by successive FilterPipeline objects built from the same filters.
+   * @param value
+   */
+  void setPreflightCache(const PipelinePreflightCache::Pointer& value);
+
+  /**
+   * @brief Returns the preflight cache or a nullptr if every preflight starts from scratch.
+   * @return
+   */
+  PipelinePreflightCache::Pointer getPreflightCache() const;
+
   /**
    * @brief This method returns a deep copy of the FilterPipeline and all its filters
    * @return
@@ -367,12 +432,77 @@ private:
 
   DataContainerArrayShPtrType m_Dca;
 
+  bool m_ReleaseDeadArrays = false;
+  std::vector<DataArrayPath> m_PreservedPaths;
+  bool m_ExecuteConcurrently = false;
+  PipelinePreflightCache::Pointer m_PreflightCache;
+  std::atomic_bool m_PreflightCanceled = {false};
+
   int m_ErrorCode = 0;
   int m_WarningCode = 0;
 
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Gives a filter whose preflight snapshot is still valid its cached DataContainerArray back and
+   * reports its cached errors and warnings again.
+   * @param filter
+   * @param snapshot
+   */
+  void restoreCachedPreflight(const AbstractFilter::Pointer& filter, const PipelinePreflightCache::Snapshot& snapshot);
+
+  /**
+   * @brief Runs the enabled filters one after another. Returns false if a filter failed.
+   * @param memoryPlanner Optional planner used to release dead arrays
+   * @return
+   */
+  bool executeSequentially(PipelineMemoryPlanner* memoryPlanner);
+
+  /**
+   * @brief Preflights the pipeline starting from the structure of the given DataContainerArray. The preflight
+   * cache is only used when the initial DataContainerArray is null or empty.
+   * @param initialDca
+   * @return
+   */
+  int preflightPipelineFrom(const DataContainerArray::Pointer& initialDca);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  /**
+   * @brief Runs the filters as soon as all the filters they depend on have finished. Returns false if a filter failed.
+   * @param memoryPlanner Optional planner used to release dead arrays
+   * @return
+   */
+  bool executeDependencyGraph(PipelineMemoryPlanner* memoryPlanner);
+
+  /**
+   * @brief Hands a message a filter emitted on a worker thread to the observers and the pipeline's own
+   * message handling. Must be called on the thread that runs execute().
+   * @param msg
+   */
+  void dispatchFilterMessage(const AbstractMessage::Pointer& msg);
+#endif
+
+  /**
+   * @brief Reports the error of the given filter and resets the pipeline state after a failed execution.
+   * @param filt
+   * @param err
+   */
+  void finishFailedExecution(const AbstractFilter::Pointer& filt, int err);
+
+  /**
+   * @brief Lets listeners know the pipeline finished and resets the pipeline state after a failure.
+   */
+  void finishFailedPipeline();
+
+  /**
+   * @brief Releases the arrays that no filter after pipelineIndex references.
+   * @param memoryPlanner
+   * @param pipelineIndex
+   * @param filt The filter that just finished
+   */
+  void releaseDeadArrays(PipelineMemoryPlanner* memoryPlanner, int pipelineIndex, const AbstractFilter::Pointer& filt);
+
 public:
   FilterPipeline(const FilterPipeline&) = delete;            // Copy Constructor Not Implemented
   FilterPipeline(FilterPipeline&&) = delete;                 // Move Constructor Not Implemented
@@ -0,0 +1,180 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineDependencyGraph.h"
+
+#include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
+#include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
+#include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputPathFilterParameter.h"
+#include "SIMPLib/FilterParameters/MultiInputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDependencyGraph::PipelineDependencyGraph(const FilterContainerType& pipeline)
+{
+  m_Nodes.resize(pipeline.size());
+  for(int i = 0; i < pipeline.size(); i++)
+  {
+    const AbstractFilter::Pointer& filter = pipeline.at(i);
+    Node& node = m_Nodes[i];
+
+    // Disabled filters do not touch any data and therefore never conflict
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+    node.dataContainers = FindDataContainers(filter.get(), node.barrier);
+    node.fileAccess = AccessesFiles(filter.get());
+
+    for(int j = 0; j < i; j++)
+    {
+      if(!pipeline.at(j)->getEnabled())
+      {
+        continue;
+      }
+      const Node& prev = m_Nodes[j];
+      if(node.barrier || prev.barrier || (node.fileAccess && prev.fileAccess) || node.dataContainers.intersects(prev.dataContainers))
+      {
+        node.dependencies.push_back(j);
+        m_Nodes[j].dependents.push_back(i);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDependencyGraph::~PipelineDependencyGraph() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QSet<QString> PipelineDependencyGraph::FindDataContainers(AbstractFilter* filter, bool& isBarrier)
+{
+  QSet<QString> dataContainers;
+  std::vector<DataArrayPath> paths = PipelineMemoryPlanner::FindReferencedPaths(filter, isBarrier);
+  for(const DataArrayPath& path : paths)
+  {
+    dataContainers.insert(path.getDataContainerName());
+  }
+  for(const DataArrayPath& path : filter->getDeletedPaths())
+  {
+    if(!path.getDataContainerName().isEmpty())
+    {
+      dataContainers.insert(path.getDataContainerName());
+    }
+  }
+
+  // A filter that references nothing may still have side effects that depend on pipeline order
+  if(dataContainers.isEmpty())
+  {
+    isBarrier = true;
+  }
+  return dataContainers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDependencyGraph::AccessesFiles(AbstractFilter* filter)
+{
+  FilterParameterVectorType filterParams = filter->getFilterParameters();
+  for(const FilterParameter::Pointer& filterParam : filterParams)
+  {
+    FilterParameter* parameter = filterParam.get();
+    if(dynamic_cast<InputFileFilterParameter*>(parameter) != nullptr || dynamic_cast<OutputFileFilterParameter*>(parameter) != nullptr ||
+       dynamic_cast<InputPathFilterParameter*>(parameter) != nullptr || dynamic_cast<OutputPathFilterParameter*>(parameter) != nullptr ||
+       dynamic_cast<MultiInputFileFilterParameter*>(parameter) != nullptr || dynamic_cast<FileListInfoFilterParameter*>(parameter) != nullptr ||
+       dynamic_cast<DataContainerReaderFilterParameter*>(parameter) != nullptr || dynamic_cast<ImportHDF5DatasetFilterParameter*>(parameter) != nullptr)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineDependencyGraph::size() const
+{
+  return m_Nodes.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int>& PipelineDependencyGraph::getDependencies(int index) const
+{
+  return m_Nodes[index].dependencies;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int>& PipelineDependencyGraph::getDependents(int index) const
+{
+  return m_Nodes[index].dependents;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QSet<QString>& PipelineDependencyGraph::getDataContainers(int index) const
+{
+  return m_Nodes[index].dataContainers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDependencyGraph::isBarrier(int index) const
+{
+  return m_Nodes[index].barrier;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDependencyGraph::accessesFiles(int index) const
+{
+  return m_Nodes[index].fileAccess;
+}
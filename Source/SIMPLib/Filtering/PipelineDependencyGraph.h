@@ -0,0 +1,146 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QList>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+/**
+ * @brief The PipelineDependencyGraph class builds a dependency DAG over the filters of a pipeline so
+ * that filters operating on disjoint DataContainers can be executed concurrently. Each filter is mapped
+ * to the set of DataContainers it reads, creates or deletes (see PipelineMemoryPlanner::FindReferencedPaths).
+ * A filter depends on every earlier filter whose set intersects its own.
+ *
+ * Dependencies are tracked per DataContainer rather than per AttributeMatrix because filters working on
+ * different AttributeMatrices of the same DataContainer still modify that DataContainer's child list.
+ * Filters whose footprint cannot be determined (DataContainerWriter, unknown required-array parameters or
+ * no referenced paths at all) are barriers that depend on, and are depended on by, every other filter.
+ *
+ * Filters that read or write files share a single lane: each one depends on the previous file filter so
+ * that HDF5, which is not built thread safe, is never entered from two filters at the same time.
+ */
+class SIMPLib_EXPORT PipelineDependencyGraph
+{
+public:
+  using FilterContainerType = QList<AbstractFilter::Pointer>;
+
+  /**
+   * @brief PipelineDependencyGraph
+   * @param pipeline The filters in execution order. preflight() should have been run so that created paths are known.
+   */
+  PipelineDependencyGraph(const FilterContainerType& pipeline);
+  ~PipelineDependencyGraph();
+
+  /**
+   * @brief Returns the names of the DataContainers the filter touches.
+   * @param filter
+   * @param isBarrier Set to true if the filter must not run concurrently with any other filter
+   * @return
+   */
+  static QSet<QString> FindDataContainers(AbstractFilter* filter, bool& isBarrier);
+
+  /**
+   * @brief Returns true if the filter has a file or directory parameter and may therefore access HDF5
+   * or other file based libraries while it executes.
+   * @param filter
+   * @return
+   */
+  static bool AccessesFiles(AbstractFilter* filter);
+
+  /**
+   * @brief Returns the number of filters in the graph
+   * @return
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the pipeline indices of the earlier filters the given filter must wait for.
+   * @param index
+   * @return
+   */
+  const std::vector<int>& getDependencies(int index) const;
+
+  /**
+   * @brief Returns the pipeline indices of the later filters that wait for the given filter.
+   * @param index
+   * @return
+   */
+  const std::vector<int>& getDependents(int index) const;
+
+  /**
+   * @brief Returns the DataContainers the filter at the given index touches.
+   * @param index
+   * @return
+   */
+  const QSet<QString>& getDataContainers(int index) const;
+
+  /**
+   * @brief Returns true if the filter at the given index is a barrier.
+   * @param index
+   * @return
+   */
+  bool isBarrier(int index) const;
+
+  /**
+   * @brief Returns true if the filter at the given index runs in the file lane.
+   * @param index
+   * @return
+   */
+  bool accessesFiles(int index) const;
+
+private:
+  struct Node
+  {
+    bool barrier = false;
+    bool fileAccess = false;
+    QSet<QString> dataContainers;
+    std::vector<int> dependencies;
+    std::vector<int> dependents;
+  };
+
+  std::vector<Node> m_Nodes;
+
+public:
+  PipelineDependencyGraph(const PipelineDependencyGraph&) = delete;            // Copy Constructor Not Implemented
+  PipelineDependencyGraph(PipelineDependencyGraph&&) = delete;                 // Move Constructor Not Implemented
+  PipelineDependencyGraph& operator=(const PipelineDependencyGraph&) = delete; // Copy Assignment Not Implemented
+  PipelineDependencyGraph& operator=(PipelineDependencyGraph&&) = delete;      // Move Assignment Not Implemented
+};
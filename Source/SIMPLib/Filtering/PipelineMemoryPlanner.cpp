@@ -0,0 +1,242 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineMemoryPlanner.h"
+
+#include <algorithm>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+#include "SIMPLib/Filtering/ComparisonInputs.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMemoryPlanner::PipelineMemoryPlanner(const FilterContainerType& pipeline, const std::vector<DataArrayPath>& preservedPaths)
+: m_PreservedPaths(preservedPaths)
+{
+  m_References.resize(pipeline.size());
+  for(int i = 0; i < pipeline.size(); i++)
+  {
+    const AbstractFilter::Pointer& filter = pipeline.at(i);
+    FilterReferences& refs = m_References[i];
+    refs.enabled = filter->getEnabled();
+    if(refs.enabled)
+    {
+      refs.paths = FindReferencedPaths(filter.get(), refs.referencesAll);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMemoryPlanner::~PipelineMemoryPlanner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<DataArrayPath> PipelineMemoryPlanner::FindReferencedPaths(AbstractFilter* filter, bool& referencesAll)
+{
+  std::vector<DataArrayPath> paths;
+  referencesAll = false;
+
+  // The DataContainerWriter consumes every array that exists when it executes
+  if(filter->getNameOfClass() == "DataContainerWriter")
+  {
+    referencesAll = true;
+    return paths;
+  }
+
+  FilterParameterVectorType filterParams = filter->getFilterParameters();
+  for(const FilterParameter::Pointer& filterParam : filterParams)
+  {
+    QString propertyName = filterParam->getPropertyName();
+    if(propertyName.isEmpty())
+    {
+      continue;
+    }
+
+    QVariant var = filter->property(propertyName.toLatin1().constData());
+    int type = var.userType();
+    if(type == qMetaTypeId<DataArrayPath>())
+    {
+      paths.push_back(var.value<DataArrayPath>());
+    }
+    else if(type == qMetaTypeId<QVector<DataArrayPath>>())
+    {
+      QVector<DataArrayPath> selectedPaths = var.value<QVector<DataArrayPath>>();
+      paths.insert(paths.end(), selectedPaths.begin(), selectedPaths.end());
+    }
+    else if(type == qMetaTypeId<DataArrayPathVec>())
+    {
+      DataArrayPathVec selectedPaths = var.value<DataArrayPathVec>();
+      paths.insert(paths.end(), selectedPaths.begin(), selectedPaths.end());
+    }
+    else if(type == qMetaTypeId<ComparisonInputs>())
+    {
+      ComparisonInputs inputs = var.value<ComparisonInputs>();
+      for(const ComparisonInput_t& input : inputs.getInputs())
+      {
+        paths.emplace_back(input.dataContainerName, input.attributeMatrixName, input.attributeArrayName);
+      }
+    }
+    else if(type == qMetaTypeId<DataContainerArrayProxy>())
+    {
+      // Readers list the DataContainers they will import in their proxy
+      DataContainerArrayProxy proxy = var.value<DataContainerArrayProxy>();
+      for(const DataContainerProxy& dcProxy : proxy.getDataContainers())
+      {
+        if(dcProxy.getFlag() != Qt::Unchecked)
+        {
+          paths.emplace_back(dcProxy.getName(), "", "");
+        }
+      }
+    }
+    else if(filterParam->getCategory() == FilterParameter::Category::RequiredArray)
+    {
+      if(type == QMetaType::QString)
+      {
+        // DataContainer selections may be stored as a plain name
+        paths.emplace_back(var.toString(), "", "");
+      }
+      else
+      {
+        referencesAll = true;
+      }
+    }
+  }
+
+  std::list<DataArrayPath> createdPaths = filter->getCreatedPaths();
+  paths.insert(paths.end(), createdPaths.begin(), createdPaths.end());
+
+  // Drop empty selections so they do not match anything
+  paths.erase(std::remove_if(paths.begin(), paths.end(), [](const DataArrayPath& path) { return path.getDataContainerName().isEmpty(); }), paths.end());
+
+  return paths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineMemoryPlanner::PathCovers(const DataArrayPath& reference, const DataArrayPath& arrayPath)
+{
+  if(reference.getDataContainerName() != arrayPath.getDataContainerName())
+  {
+    return false;
+  }
+  if(!reference.getAttributeMatrixName().isEmpty() && reference.getAttributeMatrixName() != arrayPath.getAttributeMatrixName())
+  {
+    return false;
+  }
+  if(!reference.getDataArrayName().isEmpty() && reference.getDataArrayName() != arrayPath.getDataArrayName())
+  {
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineMemoryPlanner::isLiveAfter(const DataArrayPath& arrayPath, int pipelineIndex) const
+{
+  for(const DataArrayPath& preservedPath : m_PreservedPaths)
+  {
+    if(PathCovers(preservedPath, arrayPath))
+    {
+      return true;
+    }
+  }
+
+  for(size_t i = static_cast<size_t>(pipelineIndex + 1); i < m_References.size(); i++)
+  {
+    const FilterReferences& refs = m_References[i];
+    if(!refs.enabled)
+    {
+      continue;
+    }
+    if(refs.referencesAll)
+    {
+      return true;
+    }
+    for(const DataArrayPath& reference : refs.paths)
+    {
+      if(PathCovers(reference, arrayPath))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineMemoryPlanner::releaseDeadArrays(int pipelineIndex, const DataContainerArrayShPtrType& dca, size_t& releasedBytes) const
+{
+  releasedBytes = 0;
+  size_t releasedCount = 0;
+  if(nullptr == dca.get())
+  {
+    return releasedCount;
+  }
+
+  for(const auto& dc : dca->getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      QList<QString> deadArrays;
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        if(!isLiveAfter(DataArrayPath(dc->getName(), am->getName(), arrayName), pipelineIndex))
+        {
+          deadArrays.push_back(arrayName);
+        }
+      }
+      for(const QString& arrayName : deadArrays)
+      {
+        IDataArray::Pointer array = am->removeAttributeArray(arrayName);
+        if(nullptr != array.get())
+        {
+          releasedBytes += array->getSize() * array->getTypeSize();
+          releasedCount++;
+        }
+      }
+    }
+  }
+  return releasedCount;
+}
@@ -0,0 +1,120 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QList>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+class DataContainerArray;
+using DataContainerArrayShPtrType = std::shared_ptr<DataContainerArray>;
+
+/**
+ * @brief The PipelineMemoryPlanner class performs a liveness analysis over the DataArrayPaths that
+ * each filter of a pipeline references through its filter parameters and created paths. FilterPipeline
+ * uses it to remove every DataArray whose last consumer has finished executing, which keeps peak memory
+ * close to the working set of the pipeline instead of the sum of all intermediate arrays.
+ *
+ * The analysis is conservative: a reference to a DataContainer or AttributeMatrix keeps every array
+ * below it alive, and a filter with a required-array parameter the planner cannot interpret (as well
+ * as any DataContainerWriter) is treated as referencing the entire DataContainerArray.
+ */
+class SIMPLib_EXPORT PipelineMemoryPlanner
+{
+public:
+  using FilterContainerType = QList<AbstractFilter::Pointer>;
+
+  /**
+   * @brief PipelineMemoryPlanner
+   * @param pipeline The filters in execution order
+   * @param preservedPaths Paths that are never released (pipeline outputs)
+   */
+  PipelineMemoryPlanner(const FilterContainerType& pipeline, const std::vector<DataArrayPath>& preservedPaths);
+  ~PipelineMemoryPlanner();
+
+  /**
+   * @brief Collects the DataArrayPaths the filter references through its filter parameters and created paths.
+   * @param filter
+   * @param referencesAll Set to true if the filter may touch arrays that cannot be determined from its parameters
+   * @return
+   */
+  static std::vector<DataArrayPath> FindReferencedPaths(AbstractFilter* filter, bool& referencesAll);
+
+  /**
+   * @brief Returns true if the reference (DataContainer, AttributeMatrix or DataArray path) covers the array path.
+   * @param reference
+   * @param arrayPath
+   * @return
+   */
+  static bool PathCovers(const DataArrayPath& reference, const DataArrayPath& arrayPath);
+
+  /**
+   * @brief Returns true if the array is preserved or referenced by any enabled filter after pipelineIndex.
+   * @param arrayPath
+   * @param pipelineIndex
+   * @return
+   */
+  bool isLiveAfter(const DataArrayPath& arrayPath, int pipelineIndex) const;
+
+  /**
+   * @brief Removes every DataArray in the DataContainerArray that is not live after pipelineIndex.
+   * @param pipelineIndex Position of the filter that just finished executing
+   * @param dca
+   * @param releasedBytes Number of bytes held by the removed arrays
+   * @return The number of removed arrays
+   */
+  size_t releaseDeadArrays(int pipelineIndex, const DataContainerArrayShPtrType& dca, size_t& releasedBytes) const;
+
+private:
+  struct FilterReferences
+  {
+    bool enabled = false;
+    bool referencesAll = false;
+    std::vector<DataArrayPath> paths;
+  };
+
+  std::vector<FilterReferences> m_References;
+  std::vector<DataArrayPath> m_PreservedPaths;
+
+public:
+  PipelineMemoryPlanner(const PipelineMemoryPlanner&) = delete;            // Copy Constructor Not Implemented
+  PipelineMemoryPlanner(PipelineMemoryPlanner&&) = delete;                 // Move Constructor Not Implemented
+  PipelineMemoryPlanner& operator=(const PipelineMemoryPlanner&) = delete; // Copy Assignment Not Implemented
+  PipelineMemoryPlanner& operator=(PipelineMemoryPlanner&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,134 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelinePreflightCache.h"
+
+#include <algorithm>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelinePreflightCache::PipelinePreflightCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelinePreflightCache::~PipelinePreflightCache() = default;
+
+// -----------------------------------------------------------------------------
+PipelinePreflightCache::Pointer PipelinePreflightCache::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+PipelinePreflightCache::Pointer PipelinePreflightCache::New()
+{
+  Pointer sharedPtr(new(PipelinePreflightCache));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelinePreflightCache::Fingerprint(AbstractFilter* filter)
+{
+  QJsonObject json;
+  json[SIMPL::Settings::FilterName] = filter->getNameOfClass();
+  json[SIMPL::Settings::FilterEnabled] = filter->getEnabled();
+  filter->writeFilterParameters(json);
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelinePreflightCache::invalidateChanged(const FilterContainerType& pipeline)
+{
+  size_t count = std::min(m_Snapshots.size(), static_cast<size_t>(pipeline.size()));
+  size_t valid = 0;
+  for(; valid < count; valid++)
+  {
+    const Snapshot& snapshot = m_Snapshots[valid];
+    const AbstractFilter::Pointer& filter = pipeline.at(static_cast<int>(valid));
+    if(snapshot.filter.lock() != filter || snapshot.enabled != filter->getEnabled() || snapshot.parameters != Fingerprint(filter.get()))
+    {
+      break;
+    }
+  }
+  invalidate(valid);
+  return valid;
+}
+
+// -----------------------------------------------------------------------------
+void PipelinePreflightCache::invalidate(size_t index)
+{
+  if(index < m_Snapshots.size())
+  {
+    m_Snapshots.resize(index);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void PipelinePreflightCache::store(size_t index, Snapshot snapshot)
+{
+  invalidate(index);
+  if(index != m_Snapshots.size())
+  {
+    // A gap would make the snapshots after it unusable
+    return;
+  }
+  m_Snapshots.push_back(std::move(snapshot));
+}
+
+// -----------------------------------------------------------------------------
+const PipelinePreflightCache::Snapshot& PipelinePreflightCache::at(size_t index) const
+{
+  return m_Snapshots.at(index);
+}
+
+// -----------------------------------------------------------------------------
+size_t PipelinePreflightCache::size() const
+{
+  return m_Snapshots.size();
+}
+
+// -----------------------------------------------------------------------------
+bool PipelinePreflightCache::empty() const
+{
+  return m_Snapshots.empty();
+}
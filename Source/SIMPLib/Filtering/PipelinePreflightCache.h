@@ -0,0 +1,162 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+class DataContainerArray;
+using DataContainerArrayShPtrType = std::shared_ptr<DataContainerArray>;
+
+/**
+ * @brief The PipelinePreflightCache class remembers the structure of the DataContainerArray after each filter
+ * of the last preflight. When FilterPipeline::preflightPipeline() is given a cache it compares every filter with
+ * its cached snapshot (identity, enabled state and filter parameters), keeps the leading filters that did not
+ * change and only preflights the filters from the first edited one onward. The cached filters get their
+ * snapshot back and their errors and warnings are reported again.
+ *
+ * Snapshots are never modified once they are stored. A snapshot is shared between the cache, the filter that
+ * produced it and the rename pass of the next filter, so every preflighted filter costs a single copy of the
+ * structure. The cache outlives the FilterPipeline objects so a GUI that builds a new pipeline for every
+ * preflight can still use it.
+ *
+ * Preflights that depend on something other than the filter parameters (e.g. the contents of an input file)
+ * are not detected. Call invalidate() when those change.
+ */
+class SIMPLib_EXPORT PipelinePreflightCache
+{
+public:
+  using Self = PipelinePreflightCache;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  using FilterContainerType = QList<AbstractFilter::Pointer>;
+
+  /**
+   * @brief An error or warning that a filter reported during its preflight
+   */
+  struct Issue
+  {
+    bool isError = false;
+    int code = 0;
+    QString messageText;
+  };
+
+  /**
+   * @brief The state of the preflight directly after a filter
+   */
+  struct Snapshot
+  {
+    AbstractFilter::WeakPointer filter;
+    bool enabled = false;
+    QJsonObject parameters;
+    DataContainerArrayShPtrType dataContainerArray;
+    DataArrayPath::RenameContainer renamedPaths;
+    std::vector<Issue> issues;
+  };
+
+  virtual ~PipelinePreflightCache();
+
+  /**
+   * @brief Returns the filter parameters and the enabled state of the filter as they are compared against the cache
+   * @param filter
+   * @return
+   */
+  static QJsonObject Fingerprint(AbstractFilter* filter);
+
+  /**
+   * @brief Drops every snapshot that no longer matches its filter in the pipeline together with all snapshots after it.
+   * @param pipeline
+   * @return The number of leading filters whose snapshots are still valid
+   */
+  size_t invalidateChanged(const FilterContainerType& pipeline);
+
+  /**
+   * @brief Drops the snapshots of the filter at index and of all filters after it
+   * @param index
+   */
+  void invalidate(size_t index = 0);
+
+  /**
+   * @brief Stores the snapshot of the filter at index. Snapshots after index are dropped.
+   * @param index
+   * @param snapshot
+   */
+  void store(size_t index, Snapshot snapshot);
+
+  /**
+   * @brief Returns the snapshot of the filter at index
+   * @param index
+   * @return
+   */
+  const Snapshot& at(size_t index) const;
+
+  /**
+   * @brief Returns the number of cached snapshots
+   * @return
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns true if nothing is cached
+   * @return
+   */
+  bool empty() const;
+
+protected:
+  PipelinePreflightCache();
+
+private:
+  std::vector<Snapshot> m_Snapshots;
+
+public:
+  PipelinePreflightCache(const PipelinePreflightCache&) = delete;            // Copy Constructor Not Implemented
+  PipelinePreflightCache(PipelinePreflightCache&&) = delete;                 // Move Constructor Not Implemented
+  PipelinePreflightCache& operator=(const PipelinePreflightCache&) = delete; // Copy Assignment Not Implemented
+  PipelinePreflightCache& operator=(PipelinePreflightCache&&) = delete;      // Move Assignment Not Implemented
+};
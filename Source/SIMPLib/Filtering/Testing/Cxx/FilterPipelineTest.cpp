@@ -39,8 +39,17 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/CoreFilters/ArrayCalculator.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/RawBinaryReader.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineDependencyGraph.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
+#include "SIMPLib/Filtering/PipelinePreflightCache.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 
 #ifdef SIMPL_BUILD_TEST_FILTERS
@@ -151,6 +160,356 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createMemoryPlannerDataStructure()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    std::vector<size_t> tDims(1, 10);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "AttributeMatrix", AttributeMatrix::Type::Cell);
+    AttributeMatrix::Pointer other = AttributeMatrix::New(tDims, "OtherMatrix", AttributeMatrix::Type::Cell);
+
+    FloatArrayType::Pointer a = FloatArrayType::CreateArray(10, std::string("A"), true);
+    a->initializeWithValue(1.0f);
+    FloatArrayType::Pointer b = FloatArrayType::CreateArray(10, std::string("B"), true);
+    b->initializeWithValue(2.0f);
+    FloatArrayType::Pointer x = FloatArrayType::CreateArray(10, std::string("X"), true);
+    x->initializeWithValue(3.0f);
+    am->insertOrAssign(a);
+    am->insertOrAssign(b);
+    other->insertOrAssign(x);
+
+    dc->addOrReplaceAttributeMatrix(am);
+    dc->addOrReplaceAttributeMatrix(other);
+    dca->addOrReplaceDataContainer(dc);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer createMemoryPlannerPipeline()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    ArrayCalculator::Pointer calc0 = ArrayCalculator::New();
+    calc0->setSelectedAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    calc0->setInfixEquation("A + B");
+    calc0->setCalculatedArray(DataArrayPath("DataContainer", "AttributeMatrix", "Sum"));
+    calc0->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    pipeline->pushBack(calc0);
+
+    ArrayCalculator::Pointer calc1 = ArrayCalculator::New();
+    calc1->setSelectedAttributeMatrix(DataArrayPath("DataContainer", "OtherMatrix", ""));
+    calc1->setInfixEquation("X * 2");
+    calc1->setCalculatedArray(DataArrayPath("DataContainer", "OtherMatrix", "Y"));
+    calc1->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    pipeline->pushBack(calc1);
+
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMemoryPlannerPathCovers()
+  {
+    DataArrayPath arrayPath("DataContainer", "AttributeMatrix", "A");
+    DREAM3D_REQUIRE(PipelineMemoryPlanner::PathCovers(DataArrayPath("DataContainer", "", ""), arrayPath))
+    DREAM3D_REQUIRE(PipelineMemoryPlanner::PathCovers(DataArrayPath("DataContainer", "AttributeMatrix", ""), arrayPath))
+    DREAM3D_REQUIRE(PipelineMemoryPlanner::PathCovers(arrayPath, arrayPath))
+    DREAM3D_REQUIRE(!PipelineMemoryPlanner::PathCovers(DataArrayPath("DataContainer", "OtherMatrix", ""), arrayPath))
+    DREAM3D_REQUIRE(!PipelineMemoryPlanner::PathCovers(DataArrayPath("DataContainer", "AttributeMatrix", "B"), arrayPath))
+    DREAM3D_REQUIRE(!PipelineMemoryPlanner::PathCovers(DataArrayPath("Other", "AttributeMatrix", "A"), arrayPath))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReleaseDeadArrays()
+  {
+    // Without the planner every array survives the pipeline
+    {
+      FilterPipeline::Pointer pipeline = createMemoryPlannerPipeline();
+      DREAM3D_REQUIRE(!pipeline->getReleaseDeadArrays())
+      DataContainerArray::Pointer dca = pipeline->execute(createMemoryPlannerDataStructure());
+      DREAM3D_REQUIRE(pipeline->getErrorCode() >= 0)
+
+      AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+      AttributeMatrix::Pointer other = dca->getAttributeMatrix(DataArrayPath("DataContainer", "OtherMatrix", ""));
+      DREAM3D_REQUIRE_EQUAL(am->getNumAttributeArrays(), 3)
+      DREAM3D_REQUIRE_EQUAL(other->getNumAttributeArrays(), 2)
+    }
+
+    // A and B are dead once the first calculator finishes, X once the second finishes
+    {
+      FilterPipeline::Pointer pipeline = createMemoryPlannerPipeline();
+      pipeline->setReleaseDeadArrays(true);
+      pipeline->setPreservedPaths({DataArrayPath("DataContainer", "AttributeMatrix", "Sum"), DataArrayPath("DataContainer", "OtherMatrix", "Y")});
+      DataContainerArray::Pointer dca = pipeline->execute(createMemoryPlannerDataStructure());
+      DREAM3D_REQUIRE(pipeline->getErrorCode() >= 0)
+
+      AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+      AttributeMatrix::Pointer other = dca->getAttributeMatrix(DataArrayPath("DataContainer", "OtherMatrix", ""));
+      DREAM3D_REQUIRE_EQUAL(am->getNumAttributeArrays(), 1)
+      DREAM3D_REQUIRE_EQUAL(other->getNumAttributeArrays(), 1)
+
+      FloatArrayType::Pointer sum = am->getAttributeArrayAs<FloatArrayType>("Sum");
+      FloatArrayType::Pointer y = other->getAttributeArrayAs<FloatArrayType>("Y");
+      DREAM3D_REQUIRE_VALID_POINTER(sum.get())
+      DREAM3D_REQUIRE_VALID_POINTER(y.get())
+      DREAM3D_REQUIRE_EQUAL(sum->getValue(0), 3.0f)
+      DREAM3D_REQUIRE_EQUAL(y->getValue(0), 6.0f)
+    }
+
+    // Preserving a DataContainer keeps everything below it
+    {
+      FilterPipeline::Pointer pipeline = createMemoryPlannerPipeline();
+      pipeline->setReleaseDeadArrays(true);
+      pipeline->setPreservedPaths({DataArrayPath("DataContainer", "", "")});
+      DataContainerArray::Pointer dca = pipeline->execute(createMemoryPlannerDataStructure());
+      DREAM3D_REQUIRE(pipeline->getErrorCode() >= 0)
+
+      AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+      DREAM3D_REQUIRE_EQUAL(am->getNumAttributeArrays(), 3)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createConcurrentDataStructure()
+  {
+    DataContainerArray::Pointer dca = createMemoryPlannerDataStructure();
+    DataContainer::Pointer dc = DataContainer::New("Second");
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, 10), "AttributeMatrix", AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer x = FloatArrayType::CreateArray(10, std::string("X"), true);
+    x->initializeWithValue(5.0f);
+    am->insertOrAssign(x);
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ArrayCalculator::Pointer createCalculator(const DataArrayPath& amPath, const QString& equation, const QString& outputName)
+  {
+    ArrayCalculator::Pointer calc = ArrayCalculator::New();
+    calc->setSelectedAttributeMatrix(amPath);
+    calc->setInfixEquation(equation);
+    calc->setCalculatedArray(DataArrayPath(amPath.getDataContainerName(), amPath.getAttributeMatrixName(), outputName));
+    calc->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    return calc;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer createConcurrentPipeline()
+  {
+    DataArrayPath firstPath("DataContainer", "AttributeMatrix", "");
+    DataArrayPath secondPath("Second", "AttributeMatrix", "");
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->pushBack(createCalculator(firstPath, "A + B", "Sum"));
+    pipeline->pushBack(createCalculator(secondPath, "X * 2", "Y"));
+    pipeline->pushBack(createCalculator(firstPath, "Sum * 2", "Sum2"));
+    pipeline->pushBack(createCalculator(secondPath, "Y + 1", "Z"));
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDependencyGraph()
+  {
+    FilterPipeline::Pointer pipeline = createConcurrentPipeline();
+    PipelineDependencyGraph graph(pipeline->getFilterContainer());
+    DREAM3D_REQUIRE_EQUAL(graph.size(), 4)
+
+    DREAM3D_REQUIRE(graph.getDependencies(0).empty())
+    DREAM3D_REQUIRE(graph.getDependencies(1).empty())
+    DREAM3D_REQUIRE_EQUAL(graph.getDependencies(2).size(), 1)
+    DREAM3D_REQUIRE_EQUAL(graph.getDependencies(2).front(), 0)
+    DREAM3D_REQUIRE_EQUAL(graph.getDependencies(3).size(), 1)
+    DREAM3D_REQUIRE_EQUAL(graph.getDependencies(3).front(), 1)
+    DREAM3D_REQUIRE(!graph.isBarrier(0))
+    DREAM3D_REQUIRE(graph.getDataContainers(1).contains("Second"))
+
+    // Disabling a filter removes it from the graph
+    pipeline->getFilterContainer().at(0)->setEnabled(false);
+    PipelineDependencyGraph disabledGraph(pipeline->getFilterContainer());
+    DREAM3D_REQUIRE(disabledGraph.getDependencies(2).empty())
+
+    // Filters that access files share one lane even when their DataContainers are disjoint
+    FilterPipeline::Pointer readers = FilterPipeline::New();
+    RawBinaryReader::Pointer firstReader = RawBinaryReader::New();
+    firstReader->setCreatedAttributeArrayPath(DataArrayPath("DataContainer", "AttributeMatrix", "Raw"));
+    readers->pushBack(firstReader);
+    readers->pushBack(createCalculator(DataArrayPath("Second", "AttributeMatrix", ""), "X * 2", "Y"));
+    RawBinaryReader::Pointer secondReader = RawBinaryReader::New();
+    secondReader->setCreatedAttributeArrayPath(DataArrayPath("Third", "AttributeMatrix", "Raw"));
+    readers->pushBack(secondReader);
+
+    PipelineDependencyGraph fileGraph(readers->getFilterContainer());
+    DREAM3D_REQUIRE(fileGraph.accessesFiles(0))
+    DREAM3D_REQUIRE(!fileGraph.accessesFiles(1))
+    DREAM3D_REQUIRE(fileGraph.getDependencies(1).empty())
+    DREAM3D_REQUIRE_EQUAL(fileGraph.getDependencies(2).size(), 1)
+    DREAM3D_REQUIRE_EQUAL(fileGraph.getDependencies(2).front(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestExecuteConcurrently()
+  {
+    FilterPipeline::Pointer pipeline = createConcurrentPipeline();
+    pipeline->setExecuteConcurrently(true);
+    DataContainerArray::Pointer dca = pipeline->execute(createConcurrentDataStructure());
+    DREAM3D_REQUIRE(pipeline->getErrorCode() >= 0)
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+    DREAM3D_REQUIRE_EQUAL(dca->getNumDataContainers(), 2)
+
+    AttributeMatrix::Pointer first = dca->getAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    AttributeMatrix::Pointer second = dca->getAttributeMatrix(DataArrayPath("Second", "AttributeMatrix", ""));
+    FloatArrayType::Pointer sum2 = first->getAttributeArrayAs<FloatArrayType>("Sum2");
+    FloatArrayType::Pointer z = second->getAttributeArrayAs<FloatArrayType>("Z");
+    DREAM3D_REQUIRE_VALID_POINTER(sum2.get())
+    DREAM3D_REQUIRE_VALID_POINTER(z.get())
+    DREAM3D_REQUIRE_EQUAL(sum2->getValue(9), 6.0f)
+    DREAM3D_REQUIRE_EQUAL(z->getValue(9), 11.0f)
+
+    // A failing filter stops the pipeline and is reported with its own error code
+    FilterPipeline::Pointer failing = createConcurrentPipeline();
+    failing->pushBack(createCalculator(DataArrayPath("Second", "AttributeMatrix", ""), "DoesNotExist + 1", "W"));
+    failing->setExecuteConcurrently(true);
+    int finishedCount = 0;
+    QObject::connect(failing.get(), &FilterPipeline::pipelineFinished, [&finishedCount]() { finishedCount++; });
+    failing->execute(createConcurrentDataStructure());
+    DREAM3D_REQUIRE(failing->getErrorCode() < 0)
+    DREAM3D_REQUIRE(failing->getExecutionResult() == FilterPipeline::ExecutionResult::Failed)
+    DREAM3D_REQUIRE(failing->getState() == FilterPipeline::State::Idle)
+    DREAM3D_REQUIRE_EQUAL(finishedCount, 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer createPreflightCachePipeline()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer createDataContainer = CreateDataContainer::New();
+    createDataContainer->setDataContainerName(DataArrayPath("DataContainer", "", ""));
+    pipeline->pushBack(createDataContainer);
+
+    CreateAttributeMatrix::Pointer createAttrMat = CreateAttributeMatrix::New();
+    createAttrMat->setAttributeMatrixType(3);
+    createAttrMat->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    DynamicTableData dtd;
+    dtd.setTableData({{10.0}});
+    createAttrMat->setTupleDimensions(dtd);
+    pipeline->pushBack(createAttrMat);
+
+    CreateDataArray::Pointer createDataArray = CreateDataArray::New();
+    createDataArray->setInitializationType(0);
+    createDataArray->setInitializationValue("1");
+    createDataArray->setNewArray(DataArrayPath("DataContainer", "AttributeMatrix", "A"));
+    createDataArray->setNumberOfComponents(1);
+    createDataArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    pipeline->pushBack(createDataArray);
+
+    DataArrayPath amPath("DataContainer", "AttributeMatrix", "");
+    pipeline->pushBack(createCalculator(amPath, "A * 2", "B"));
+    pipeline->pushBack(createCalculator(amPath, "B + 1", "C"));
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIncrementalPreflight()
+  {
+    PipelinePreflightCache::Pointer cache = PipelinePreflightCache::New();
+    FilterPipeline::Pointer pipeline = createPreflightCachePipeline();
+    pipeline->setPreflightCache(cache);
+    FilterPipeline::FilterContainerType filters = pipeline->getFilterContainer();
+
+    DREAM3D_REQUIRE(pipeline->preflightPipeline() >= 0)
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 5)
+    DataArrayPath cPath("DataContainer", "AttributeMatrix", "C");
+    DREAM3D_REQUIRE(filters.at(4)->getDataContainerArray()->doesAttributeArrayExist(cPath))
+    std::vector<DataContainerArray::Pointer> firstSnapshots;
+    for(const auto& filter : filters)
+    {
+      firstSnapshots.push_back(filter->getDataContainerArray());
+    }
+
+    // Nothing changed: every filter gets its cached snapshot back
+    DREAM3D_REQUIRE(pipeline->preflightPipeline() >= 0)
+    for(int i = 0; i < filters.size(); i++)
+    {
+      DREAM3D_REQUIRE(filters.at(i)->getDataContainerArray() == firstSnapshots[i])
+    }
+
+    // Editing the fourth filter preflights it and everything after it again
+    ArrayCalculator::Pointer calc = std::dynamic_pointer_cast<ArrayCalculator>(filters.at(3));
+    calc->setInfixEquation("A + 1");
+    DREAM3D_REQUIRE(pipeline->preflightPipeline() >= 0)
+    for(int i = 0; i < 3; i++)
+    {
+      DREAM3D_REQUIRE(filters.at(i)->getDataContainerArray() == firstSnapshots[i])
+    }
+    DREAM3D_REQUIRE(filters.at(3)->getDataContainerArray() != firstSnapshots[3])
+    DREAM3D_REQUIRE(filters.at(4)->getDataContainerArray() != firstSnapshots[4])
+
+    // Errors of cached filters are reported again, also to a new pipeline built from the same filters
+    calc->setInfixEquation("DoesNotExist + 1");
+    DREAM3D_REQUIRE(pipeline->preflightPipeline() < 0)
+    DREAM3D_REQUIRE(calc->getErrorCode() < 0)
+    FilterPipeline::Pointer rebuilt = FilterPipeline::New();
+    for(const auto& filter : filters)
+    {
+      filter->clearErrorCode();
+      rebuilt->pushBack(filter);
+    }
+    rebuilt->setPreflightCache(cache);
+    DREAM3D_REQUIRE(rebuilt->preflightPipeline() < 0)
+    DREAM3D_REQUIRE(calc->getErrorCode() < 0)
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 5)
+
+    // Inserting a filter in front invalidates the whole cache
+    calc->setInfixEquation("A * 2");
+    rebuilt->insert(0, createCalculator(DataArrayPath("Other", "AttributeMatrix", ""), "X", "Y"));
+    DREAM3D_REQUIRE(rebuilt->preflightPipeline() < 0)
+    DREAM3D_REQUIRE(filters.at(0)->getDataContainerArray() != firstSnapshots[0])
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 6)
+
+    // Removing it again gives the same result as a preflight without cache
+    rebuilt->erase(0);
+    DREAM3D_REQUIRE(rebuilt->preflightPipeline() >= 0)
+    FilterPipeline::Pointer uncached = createPreflightCachePipeline();
+    DREAM3D_REQUIRE(uncached->preflightPipeline() >= 0)
+    DREAM3D_REQUIRE_EQUAL(filters.at(4)->getDataContainerArray()->getDataContainerNames().size(), 1)
+    DREAM3D_REQUIRE(filters.at(4)->getDataContainerArray()->doesAttributeArrayExist(cPath))
+    DREAM3D_REQUIRE(uncached->getFilterContainer().at(4)->getDataContainerArray()->doesAttributeArrayExist(cPath))
+
+    cache->invalidate();
+    DREAM3D_REQUIRE(cache->empty())
+
+    // A canceled preflight stops before the next filter and keeps what was already cached
+    rebuilt->cancelPreflight();
+    DREAM3D_REQUIRE_EQUAL(rebuilt->preflightPipeline(), -204)
+    DREAM3D_REQUIRE(cache->empty())
+    DREAM3D_REQUIRE(rebuilt->preflightPipeline() >= 0)
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 5)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -165,6 +524,11 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestMemoryPlannerPathCovers());
+    DREAM3D_REGISTER_TEST(TestReleaseDeadArrays());
+    DREAM3D_REGISTER_TEST(TestDependencyGraph());
+    DREAM3D_REGISTER_TEST(TestExecuteConcurrently());
+    DREAM3D_REGISTER_TEST(TestIncrementalPreflight());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
@@ -0,0 +1,371 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ThresholdEngine.h"
+
+#include <algorithm>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Compares the values of one DataArray<T> against a constant. The comparison operator is chosen
+ * once per block so the inner loops stay branch free.
+ */
+template <typename T>
+class ComparisonKernel : public ThresholdEngine::Kernel
+{
+public:
+  ComparisonKernel(const IDataArray::Pointer& input, SIMPL::Comparison::Enumeration compOperator, double compValue)
+  : m_Input(input)
+  , m_Data(std::dynamic_pointer_cast<DataArray<T>>(input)->getConstPointer(0))
+  , m_CompOperator(compOperator)
+  , m_CompValue(static_cast<T>(compValue))
+  {
+  }
+  ~ComparisonKernel() override = default;
+
+  void evaluate(size_t start, size_t count, uint8_t* result) const override
+  {
+    const T* data = m_Data + start;
+    const T v = m_CompValue;
+    switch(m_CompOperator)
+    {
+    case SIMPL::Comparison::Operator_LessThan:
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] = static_cast<uint8_t>(data[i] < v);
+      }
+      break;
+    case SIMPL::Comparison::Operator_GreaterThan:
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] = static_cast<uint8_t>(data[i] > v);
+      }
+      break;
+    case SIMPL::Comparison::Operator_Equal:
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] = static_cast<uint8_t>(data[i] == v);
+      }
+      break;
+    case SIMPL::Comparison::Operator_NotEqual:
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] = static_cast<uint8_t>(data[i] != v);
+      }
+      break;
+    default:
+      std::fill(result, result + count, 0);
+      break;
+    }
+  }
+
+private:
+  IDataArray::Pointer m_Input;
+  const T* m_Data = nullptr;
+  SIMPL::Comparison::Enumeration m_CompOperator = SIMPL::Comparison::Operator_Unknown;
+  T m_CompValue = {};
+};
+
+/**
+ * @brief Creates the kernel if the array is a DataArray<T>. Returns false otherwise.
+ */
+template <typename T>
+bool createKernel(const IDataArray::Pointer& input, SIMPL::Comparison::Enumeration compOperator, double compValue, std::shared_ptr<ThresholdEngine::Kernel>& kernel)
+{
+  if(std::dynamic_pointer_cast<DataArray<T>>(input) == nullptr)
+  {
+    return false;
+  }
+  kernel = std::make_shared<ComparisonKernel<T>>(input, compOperator, compValue);
+  return true;
+}
+
+/**
+ * @brief Evaluates a range of blocks and stores them either as bool values or as packed bits
+ */
+class EvaluateBlocksImpl
+{
+public:
+  EvaluateBlocksImpl(const ThresholdEngine* engine, bool* output, uint64_t* packed)
+  : m_Engine(engine)
+  , m_Output(output)
+  , m_Packed(packed)
+  {
+  }
+  EvaluateBlocksImpl(const EvaluateBlocksImpl&) = default;
+  EvaluateBlocksImpl(EvaluateBlocksImpl&&) = default;
+  EvaluateBlocksImpl& operator=(const EvaluateBlocksImpl&) = delete;
+  EvaluateBlocksImpl& operator=(EvaluateBlocksImpl&&) = delete;
+  ~EvaluateBlocksImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::vector<uint8_t> result(ThresholdEngine::k_BlockSize);
+    std::vector<std::vector<uint8_t>> scratch(m_Engine->getScratchDepth(), std::vector<uint8_t>(ThresholdEngine::k_BlockSize));
+    const size_t numTuples = m_Engine->getNumberOfTuples();
+
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      m_Engine->evaluateBlock(block, result.data(), scratch);
+
+      const size_t start = block * ThresholdEngine::k_BlockSize;
+      const size_t count = std::min(ThresholdEngine::k_BlockSize, numTuples - start);
+      if(nullptr != m_Output)
+      {
+        bool* output = m_Output + start;
+        for(size_t i = 0; i < count; i++)
+        {
+          output[i] = (result[i] != 0);
+        }
+      }
+      if(nullptr != m_Packed)
+      {
+        uint64_t* words = m_Packed + start / 64;
+        for(size_t w = 0; w * 64 < count; w++)
+        {
+          const size_t bits = std::min<size_t>(64, count - w * 64);
+          uint64_t word = 0;
+          for(size_t b = 0; b < bits; b++)
+          {
+            word |= static_cast<uint64_t>(result[w * 64 + b] != 0) << b;
+          }
+          words[w] = word;
+        }
+      }
+    }
+  }
+
+private:
+  const ThresholdEngine* m_Engine = nullptr;
+  bool* m_Output = nullptr;
+  uint64_t* m_Packed = nullptr;
+};
+
+/**
+ * @brief Returns the nesting depth below a set
+ */
+size_t setDepth(const ThresholdEngine::Node& set)
+{
+  size_t depth = 0;
+  for(const auto& child : set.children)
+  {
+    if(nullptr == child.kernel)
+    {
+      depth = std::max(depth, setDepth(child));
+    }
+  }
+  return depth + 1;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+ThresholdEngine::ThresholdEngine(size_t numTuples)
+: m_NumTuples(numTuples)
+{
+  m_OpenSets.push_back(&m_Root);
+}
+
+// -----------------------------------------------------------------------------
+ThresholdEngine::~ThresholdEngine() = default;
+
+// -----------------------------------------------------------------------------
+bool ThresholdEngine::addComparison(int32_t unionOperator, const IDataArray::Pointer& input, SIMPL::Comparison::Enumeration compOperator, double compValue)
+{
+  if(nullptr == input || input->getNumberOfComponents() != 1 || input->getNumberOfTuples() != m_NumTuples)
+  {
+    return false;
+  }
+
+  std::shared_ptr<Kernel> kernel;
+  bool created = createKernel<float>(input, compOperator, compValue, kernel) || createKernel<double>(input, compOperator, compValue, kernel) ||
+                 createKernel<int8_t>(input, compOperator, compValue, kernel) || createKernel<uint8_t>(input, compOperator, compValue, kernel) ||
+                 createKernel<int16_t>(input, compOperator, compValue, kernel) || createKernel<uint16_t>(input, compOperator, compValue, kernel) ||
+                 createKernel<int32_t>(input, compOperator, compValue, kernel) || createKernel<uint32_t>(input, compOperator, compValue, kernel) ||
+                 createKernel<int64_t>(input, compOperator, compValue, kernel) || createKernel<uint64_t>(input, compOperator, compValue, kernel) ||
+                 createKernel<bool>(input, compOperator, compValue, kernel);
+  if(!created)
+  {
+    return false;
+  }
+
+  Node node;
+  node.unionOperator = unionOperator;
+  node.kernel = kernel;
+  m_OpenSets.back()->children.push_back(node);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+void ThresholdEngine::beginSet(int32_t unionOperator, bool invert)
+{
+  Node node;
+  node.unionOperator = unionOperator;
+  node.invert = invert;
+  m_OpenSets.back()->children.push_back(node);
+  m_OpenSets.push_back(&(m_OpenSets.back()->children.back()));
+}
+
+// -----------------------------------------------------------------------------
+void ThresholdEngine::endSet()
+{
+  // The root set is never closed
+  if(m_OpenSets.size() > 1)
+  {
+    m_OpenSets.pop_back();
+  }
+}
+
+// -----------------------------------------------------------------------------
+void ThresholdEngine::setInvertResult(bool invert)
+{
+  m_Root.invert = invert;
+}
+
+// -----------------------------------------------------------------------------
+void ThresholdEngine::setParallelizationEnabled(bool doParallel)
+{
+  m_ParallelizationEnabled = doParallel;
+}
+
+// -----------------------------------------------------------------------------
+size_t ThresholdEngine::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+size_t ThresholdEngine::getScratchDepth() const
+{
+  return setDepth(m_Root);
+}
+
+// -----------------------------------------------------------------------------
+void ThresholdEngine::execute(bool* output) const
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setParallelizationEnabled(dataAlg.getParallelizationEnabled() && m_ParallelizationEnabled);
+  dataAlg.setRange(0, (m_NumTuples + k_BlockSize - 1) / k_BlockSize);
+  dataAlg.execute(EvaluateBlocksImpl(this, output, nullptr));
+}
+
+// -----------------------------------------------------------------------------
+std::vector<uint64_t> ThresholdEngine::executePacked() const
+{
+  std::vector<uint64_t> packed((m_NumTuples + 63) / 64, 0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setParallelizationEnabled(dataAlg.getParallelizationEnabled() && m_ParallelizationEnabled);
+  dataAlg.setRange(0, (m_NumTuples + k_BlockSize - 1) / k_BlockSize);
+  dataAlg.execute(EvaluateBlocksImpl(this, nullptr, packed.data()));
+  return packed;
+}
+
+// -----------------------------------------------------------------------------
+void ThresholdEngine::evaluateBlock(size_t block, uint8_t* result, std::vector<std::vector<uint8_t>>& scratch) const
+{
+  const size_t start = block * k_BlockSize;
+  const size_t count = std::min(k_BlockSize, m_NumTuples - start);
+  evaluateSet(m_Root, start, count, result, scratch, 0);
+}
+
+// -----------------------------------------------------------------------------
+void ThresholdEngine::evaluateSet(const Node& set, size_t start, size_t count, uint8_t* result, std::vector<std::vector<uint8_t>>& scratch, size_t depth) const
+{
+  if(set.children.empty())
+  {
+    std::fill(result, result + count, static_cast<uint8_t>(set.invert));
+    return;
+  }
+
+  uint8_t* value = scratch[depth].data();
+  for(size_t c = 0; c < set.children.size(); c++)
+  {
+    const Node& child = set.children[c];
+    const bool isOr = (child.unionOperator == SIMPL::Union::Operator_Or);
+
+    // Skip a child that cannot change the block
+    if(c > 0)
+    {
+      if(isOr && std::all_of(result, result + count, [](uint8_t v) { return v != 0; }))
+      {
+        continue;
+      }
+      if(!isOr && std::none_of(result, result + count, [](uint8_t v) { return v != 0; }))
+      {
+        continue;
+      }
+    }
+
+    // The first child initializes the result and the others are combined into it
+    uint8_t* target = (c == 0) ? result : value;
+    if(nullptr != child.kernel)
+    {
+      child.kernel->evaluate(start, count, target);
+    }
+    else
+    {
+      evaluateSet(child, start, count, target, scratch, depth + 1);
+    }
+
+    if(c > 0)
+    {
+      if(isOr)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          result[i] |= value[i];
+        }
+      }
+      else
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          result[i] &= value[i];
+        }
+      }
+    }
+  }
+
+  if(set.invert)
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      result[i] ^= 1;
+    }
+  }
+}
@@ -0,0 +1,189 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @brief The ThresholdEngine class evaluates a tree of threshold comparisons in a single pass over the
+ * input arrays. The comparisons are added in the order the threshold filters apply them: the first entry
+ * of every set initializes the set's result and each following entry is combined into it with its own
+ * union operator, left to right. A set may invert its result before it is combined into its parent.
+ *
+ * The tuples are split into blocks that fit in the cache. Each block is evaluated on a worker thread with
+ * tight per array comparison loops that the compiler can vectorize, and a comparison is skipped for a block
+ * whose result it cannot change (an And into an all false block or an Or into an all true block). No full
+ * size temporary arrays are created. The result can be written to a bool array or packed 64 tuples per word.
+ */
+class SIMPLib_EXPORT ThresholdEngine
+{
+public:
+  /**
+   * @brief Number of tuples in each block. It is a multiple of 64 so blocks never share a packed word.
+   */
+  static constexpr size_t k_BlockSize = 4096;
+
+  /**
+   * @brief The Kernel class compares a block of values of one array against a constant
+   */
+  class Kernel
+  {
+  public:
+    Kernel() = default;
+    virtual ~Kernel() = default;
+
+    /**
+     * @brief Writes 1 to result[i] for each tuple start + i that passes the comparison and 0 otherwise
+     * @param start
+     * @param count
+     * @param result
+     */
+    virtual void evaluate(size_t start, size_t count, uint8_t* result) const = 0;
+
+  public:
+    Kernel(const Kernel&) = delete;            // Copy Constructor Not Implemented
+    Kernel(Kernel&&) = delete;                 // Move Constructor Not Implemented
+    Kernel& operator=(const Kernel&) = delete; // Copy Assignment Not Implemented
+    Kernel& operator=(Kernel&&) = delete;      // Move Assignment Not Implemented
+  };
+
+  /**
+   * @brief The Node struct is either a single comparison or a set of child nodes
+   */
+  struct Node
+  {
+    int32_t unionOperator = SIMPL::Union::Operator_And;
+    bool invert = false;
+    std::shared_ptr<Kernel> kernel;
+    std::vector<Node> children;
+  };
+
+  /**
+   * @brief ThresholdEngine
+   * @param numTuples Number of tuples every compared array must have
+   */
+  ThresholdEngine(size_t numTuples);
+  ~ThresholdEngine();
+
+  /**
+   * @brief Adds a comparison to the innermost open set
+   * @param unionOperator How the comparison is combined into the set. Ignored for the first entry of a set.
+   * @param input A scalar array with numTuples tuples of any numeric type or bool
+   * @param compOperator
+   * @param compValue The value is cast to the type of the array before comparing, like ThresholdFilterHelper does
+   * @return false if the array is missing, is not scalar, has the wrong number of tuples or an unsupported type
+   */
+  bool addComparison(int32_t unionOperator, const IDataArray::Pointer& input, SIMPL::Comparison::Enumeration compOperator, double compValue);
+
+  /**
+   * @brief Opens a nested set. Comparisons and sets added until the matching endSet() belong to it.
+   * A set without any entries evaluates to false.
+   * @param unionOperator How the set is combined into its parent. Ignored for the first entry of a set.
+   * @param invert Whether the result of the set is inverted before it is combined into its parent
+   */
+  void beginSet(int32_t unionOperator, bool invert);
+
+  /**
+   * @brief Closes the innermost open set
+   */
+  void endSet();
+
+  /**
+   * @brief Sets whether the final result is inverted
+   * @param invert
+   */
+  void setInvertResult(bool invert);
+
+  /**
+   * @brief Sets whether blocks are evaluated on multiple threads
+   * @param doParallel
+   */
+  void setParallelizationEnabled(bool doParallel);
+
+  /**
+   * @brief Returns the number of tuples the engine evaluates
+   * @return
+   */
+  size_t getNumberOfTuples() const;
+
+  /**
+   * @brief Evaluates all comparisons and writes the result of each tuple to output
+   * @param output Must hold numTuples values
+   */
+  void execute(bool* output) const;
+
+  /**
+   * @brief Evaluates all comparisons and returns the result packed 64 tuples per word. Tuple i is
+   * bit (i % 64) of word (i / 64). The unused bits of the last word are 0.
+   * @return
+   */
+  std::vector<uint64_t> executePacked() const;
+
+  /**
+   * @brief Evaluates one block of tuples into result, which must hold k_BlockSize values
+   * @param block
+   * @param result
+   * @param scratch One buffer per nesting level, reused between calls by the same thread
+   */
+  void evaluateBlock(size_t block, uint8_t* result, std::vector<std::vector<uint8_t>>& scratch) const;
+
+  /**
+   * @brief Returns how many scratch buffers evaluateBlock() needs
+   * @return
+   */
+  size_t getScratchDepth() const;
+
+private:
+  size_t m_NumTuples = 0;
+  Node m_Root;
+  std::vector<Node*> m_OpenSets;
+  bool m_ParallelizationEnabled = true;
+
+  /**
+   * @brief Evaluates a set for count tuples starting at start
+   */
+  void evaluateSet(const Node& set, size_t start, size_t count, uint8_t* result, std::vector<std::vector<uint8_t>>& scratch, size_t depth) const;
+
+public:
+  ThresholdEngine(const ThresholdEngine&) = delete;            // Copy Constructor Not Implemented
+  ThresholdEngine(ThresholdEngine&&) = delete;                 // Move Constructor Not Implemented
+  ThresholdEngine& operator=(const ThresholdEngine&) = delete; // Copy Assignment Not Implemented
+  ThresholdEngine& operator=(ThresholdEngine&&) = delete;      // Move Assignment Not Implemented
+};
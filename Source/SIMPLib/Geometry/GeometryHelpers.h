@@ -31,10 +31,14 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -47,6 +51,11 @@
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_sort.h>
+#endif
 
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
@@ -215,6 +224,241 @@ public:
   }
 };
 
+namespace Detail
+{
+/**
+ * @brief The GenerateElementKeysImpl class writes the sorted vertex keys (edges or faces) of
+ * every element in a range into a flat, pre-sized key buffer.  Each element owns a fixed
+ * slot of the buffer so the ranges can be processed concurrently without synchronization.
+ */
+template <typename T, size_t KeySize>
+class GenerateElementKeysImpl
+{
+public:
+  using KeyType = std::array<T, KeySize>;
+  using LocalKeysType = std::vector<std::array<size_t, KeySize>>;
+
+  GenerateElementKeysImpl(const T* elems, size_t numVertsPerElem, const LocalKeysType& localKeys, KeyType* keys)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_LocalKeys(localKeys)
+  , m_Keys(keys)
+  {
+  }
+  GenerateElementKeysImpl(const GenerateElementKeysImpl&) = default;
+  GenerateElementKeysImpl(GenerateElementKeysImpl&&) noexcept = default;
+  GenerateElementKeysImpl& operator=(const GenerateElementKeysImpl&) = delete;
+  GenerateElementKeysImpl& operator=(GenerateElementKeysImpl&&) noexcept = delete;
+  ~GenerateElementKeysImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    size_t keysPerElem = m_LocalKeys.size();
+    for(size_t i = start; i < end; i++)
+    {
+      const T* verts = m_Elems + i * m_NumVertsPerElem;
+      KeyType* elemKeys = m_Keys + i * keysPerElem;
+      for(size_t k = 0; k < keysPerElem; k++)
+      {
+        KeyType& key = elemKeys[k];
+        for(size_t j = 0; j < KeySize; j++)
+        {
+          key[j] = verts[m_LocalKeys[k][j]];
+        }
+        std::sort(key.begin(), key.end());
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    generate(range.min(), range.max());
+  }
+
+private:
+  const T* m_Elems;
+  size_t m_NumVertsPerElem;
+  const LocalKeysType& m_LocalKeys;
+  KeyType* m_Keys;
+};
+
+/**
+ * @brief The CountElementsContainingVertImpl class counts how many elements reference each
+ * vertex.  Elements in different ranges may share a vertex so the counters are atomic.
+ */
+template <typename T, typename K>
+class CountElementsContainingVertImpl
+{
+public:
+  CountElementsContainingVertImpl(const K* elems, size_t numVertsPerElem, std::atomic<T>* linkCount)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_LinkCount(linkCount)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t elemId = range.min(); elemId < range.max(); elemId++)
+    {
+      const K* verts = m_Elems + elemId * m_NumVertsPerElem;
+      for(size_t j = 0; j < m_NumVertsPerElem; j++)
+      {
+        m_LinkCount[verts[j]].fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+private:
+  const K* m_Elems;
+  size_t m_NumVertsPerElem;
+  std::atomic<T>* m_LinkCount;
+};
+
+/**
+ * @brief The FillElementsContainingVertImpl class writes each element id into the lists of
+ * its vertices.  The per vertex insert position is claimed atomically, so lists filled in
+ * parallel are not in element order until SortElementListsImpl has run.
+ */
+template <typename T, typename K>
+class FillElementsContainingVertImpl
+{
+public:
+  FillElementsContainingVertImpl(const K* elems, size_t numVertsPerElem, std::atomic<T>* linkLoc, DynamicListArray<T, K>* dynamicList)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_LinkLoc(linkLoc)
+  , m_DynamicList(dynamicList)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t elemId = range.min(); elemId < range.max(); elemId++)
+    {
+      const K* verts = m_Elems + elemId * m_NumVertsPerElem;
+      for(size_t j = 0; j < m_NumVertsPerElem; j++)
+      {
+        T pos = m_LinkLoc[verts[j]].fetch_add(1, std::memory_order_relaxed);
+        m_DynamicList->insertCellReference(verts[j], pos, elemId);
+      }
+    }
+  }
+
+private:
+  const K* m_Elems;
+  size_t m_NumVertsPerElem;
+  std::atomic<T>* m_LinkLoc;
+  DynamicListArray<T, K>* m_DynamicList;
+};
+
+/**
+ * @brief The SortElementListsImpl class sorts every list of a DynamicListArray in place.
+ */
+template <typename T, typename K>
+class SortElementListsImpl
+{
+public:
+  SortElementListsImpl(DynamicListArray<T, K>* dynamicList)
+  : m_DynamicList(dynamicList)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      K* elems = m_DynamicList->getElementListPointer(i);
+      std::sort(elems, elems + m_DynamicList->getNumberOfElements(i));
+    }
+  }
+
+private:
+  DynamicListArray<T, K>* m_DynamicList;
+};
+
+/**
+ * @brief The FindElementNeighborsImpl class finds the elements that share numSharedVerts
+ * vertices with each element of a range.  Without a destination list it only records the
+ * neighbor count of each element; with one it writes the neighbors into the (already sized)
+ * list of each element.  Neighbors are kept in first encounter order.
+ */
+template <typename T, typename K>
+class FindElementNeighborsImpl
+{
+public:
+  FindElementNeighborsImpl(const K* elems, size_t numVertsPerElem, size_t numSharedVerts, const DynamicListArray<T, K>* elemsContainingVert, T* linkCount, DynamicListArray<T, K>* dynamicList)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_NumSharedVerts(numSharedVerts)
+  , m_ElemsContainingVert(elemsContainingVert)
+  , m_LinkCount(linkCount)
+  , m_DynamicList(dynamicList)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    // Reuse this vector for each element of the range. Avoids re-allocating the memory each time through the loop
+    std::vector<K> neighbors;
+    neighbors.reserve(32);
+    for(size_t t = range.min(); t < range.max(); t++)
+    {
+      neighbors.clear();
+      const K* seedElem = m_Elems + t * m_NumVertsPerElem;
+      for(size_t v = 0; v < m_NumVertsPerElem; ++v)
+      {
+        T nEs = m_ElemsContainingVert->getNumberOfElements(seedElem[v]);
+        K* vertIdxs = m_ElemsContainingVert->getElementListPointer(seedElem[v]);
+        for(T vt = 0; vt < nEs; ++vt)
+        {
+          // Skip the source element and any element already added as a neighbor
+          if(vertIdxs[vt] == static_cast<K>(t) || std::find(neighbors.begin(), neighbors.end(), vertIdxs[vt]) != neighbors.end())
+          {
+            continue;
+          }
+          const K* vertCell = m_Elems + vertIdxs[vt] * m_NumVertsPerElem;
+          size_t vCount = 0;
+          // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
+          // If there is numSharedVerts match then that element is a neighbor of the source.
+          for(size_t i = 0; i < m_NumVertsPerElem; i++)
+          {
+            for(size_t j = 0; j < m_NumVertsPerElem; j++)
+            {
+              if(seedElem[i] == vertCell[j])
+              {
+                vCount++;
+              }
+            }
+          }
+          if(vCount == m_NumSharedVerts)
+          {
+            neighbors.push_back(vertIdxs[vt]);
+          }
+        }
+      }
+
+      if(m_DynamicList == nullptr)
+      {
+        m_LinkCount[t] = static_cast<T>(neighbors.size());
+      }
+      else if(!neighbors.empty())
+      {
+        ::memcpy(m_DynamicList->getElementListPointer(t), neighbors.data(), neighbors.size() * sizeof(K));
+      }
+    }
+  }
+
+private:
+  const K* m_Elems;
+  size_t m_NumVertsPerElem;
+  size_t m_NumSharedVerts;
+  const DynamicListArray<T, K>* m_ElemsContainingVert;
+  T* m_LinkCount;
+  DynamicListArray<T, K>* m_DynamicList;
+};
+} // namespace Detail
+
 /**
  * @brief The Connectivity class
  */
@@ -224,6 +468,144 @@ public:
   Connectivity() = default;
   virtual ~Connectivity() = default;
 
+  /**
+   * @brief The ExtractionMethod enum selects how the Find*Edges / Find*Faces functions
+   * de-duplicate the edges or faces they generate.  OrderedSet inserts every key into a
+   * std::set / std::map on a single thread; SortedKeys generates all keys in parallel into a
+   * single flat buffer and sorts it.  Both produce identical lists in the same (lexicographic)
+   * order.  Automatic picks SortedKeys once the element count reaches k_SortedKeysThreshold.
+   */
+  enum class ExtractionMethod : int
+  {
+    Automatic = 0,
+    OrderedSet = 1,
+    SortedKeys = 2
+  };
+
+  static constexpr size_t k_SortedKeysThreshold = 10000;
+
+  /**
+   * @brief UseSortedKeys
+   * @param method
+   * @param numElems
+   * @return
+   */
+  static bool UseSortedKeys(ExtractionMethod method, size_t numElems)
+  {
+    if(method == ExtractionMethod::Automatic)
+    {
+      return numElems >= k_SortedKeysThreshold;
+    }
+    return method == ExtractionMethod::SortedKeys;
+  }
+
+  /**
+   * @brief FindUniqueKeys generates the sorted vertex keys described by localKeys for every
+   * element of elemList, sorts them and writes the unique keys to keyList in lexicographic order.
+   * The key buffer is allocated once (numElems * localKeys.size() keys) so the memory footprint is
+   * known up front instead of growing one tree node per key.
+   * @param elemList
+   * @param localKeys Element-local vertex indices of each edge/face
+   * @param unsharedOnly If true, only keys that occur exactly once are written
+   * @param keyList
+   */
+  template <typename T, size_t KeySize>
+  static void FindUniqueKeys(const typename DataArray<T>::Pointer& elemList, const std::vector<std::array<size_t, KeySize>>& localKeys, bool unsharedOnly,
+                             const typename DataArray<T>::Pointer& keyList)
+  {
+    using KeyType = std::array<T, KeySize>;
+
+    size_t numElems = elemList->getNumberOfTuples();
+    size_t numVertsPerElem = elemList->getNumberOfComponents();
+    std::vector<KeyType> keys(numElems * localKeys.size());
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute(Detail::GenerateElementKeysImpl<T, KeySize>(elemList->getPointer(0), numVertsPerElem, localKeys, keys.data()));
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_sort(keys.begin(), keys.end());
+#else
+    std::sort(keys.begin(), keys.end());
+#endif
+
+    // Compact the sorted keys in place; equal keys are adjacent
+    size_t numKeys = keys.size();
+    size_t count = 0;
+    size_t i = 0;
+    while(i < numKeys)
+    {
+      size_t j = i + 1;
+      while(j < numKeys && keys[j] == keys[i])
+      {
+        j++;
+      }
+      if(!unsharedOnly || (j - i) == 1)
+      {
+        keys[count] = keys[i];
+        count++;
+      }
+      i = j;
+    }
+
+    keyList->resizeTuples(count);
+    if(count > 0)
+    {
+      std::copy_n(keys.front().data(), count * KeySize, keyList->getPointer(0));
+    }
+  }
+
+  /**
+   * @brief TetEdgeKeys
+   * @return
+   */
+  static std::vector<std::array<size_t, 2>> TetEdgeKeys()
+  {
+    return {{{0, 1}}, {{0, 2}}, {{1, 2}}, {{0, 3}}, {{1, 3}}, {{2, 3}}};
+  }
+
+  /**
+   * @brief HexEdgeKeys
+   * @return
+   */
+  static std::vector<std::array<size_t, 2>> HexEdgeKeys()
+  {
+    return {{{0, 1}}, {{1, 2}}, {{2, 3}}, {{3, 0}}, {{0, 4}}, {{1, 5}}, {{2, 6}}, {{3, 7}}, {{4, 5}}, {{5, 6}}, {{6, 7}}, {{7, 4}}};
+  }
+
+  /**
+   * @brief TetFaceKeys
+   * @return
+   */
+  static std::vector<std::array<size_t, 3>> TetFaceKeys()
+  {
+    return {{{0, 1, 2}}, {{1, 2, 3}}, {{0, 2, 3}}, {{0, 1, 3}}};
+  }
+
+  /**
+   * @brief HexFaceKeys
+   * @return
+   */
+  static std::vector<std::array<size_t, 4>> HexFaceKeys()
+  {
+    return {{{0, 1, 5, 4}}, {{1, 2, 6, 5}}, {{2, 3, 7, 6}}, {{3, 0, 4, 7}}, {{0, 1, 2, 3}}, {{4, 5, 6, 7}}};
+  }
+
+  /**
+   * @brief PolygonEdgeKeys
+   * @param numVertsPerElem
+   * @return
+   */
+  static std::vector<std::array<size_t, 2>> PolygonEdgeKeys(size_t numVertsPerElem)
+  {
+    std::vector<std::array<size_t, 2>> localKeys(numVertsPerElem);
+    for(size_t j = 0; j < numVertsPerElem; j++)
+    {
+      localKeys[j] = {{j, (j + 1) % numVertsPerElem}};
+    }
+    return localKeys;
+  }
+
   /**
    * @brief FindElementsContainingVert
    * @param elemList
@@ -235,38 +617,32 @@ public:
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
+    const K* elems = elemList->getPointer(0);
 
-    // Allocate the basic structures
-    QVector<T> linkCount(numVerts, 0);
-    size_t elemId = 0;
+    // Traverse data to determine number of uses of each point
+    std::vector<std::atomic<T>> linkCount(numVerts);
+    ParallelDataAlgorithm countAlg;
+    countAlg.setRange(0, numElems);
+    countAlg.execute(Detail::CountElementsContainingVertImpl<T, K>(elems, numVertsPerElem, linkCount.data()));
 
-    // Fill out lists with number of references to cells
-    typename DataArray<K>::Pointer linkLocPtr = DataArray<K>::CreateArray(numVerts, std::string("_INTERNAL_USE_ONLY_Vertices"), true);
-    linkLocPtr->initializeWithValue(0);
-    K* linkLoc = linkLocPtr->getPointer(0);
-    K* verts = nullptr;
+    // Now allocate storage for the links as a single slab
+    dynamicList->allocateLists(linkCount);
 
-    // vtkPolyData *pdata = static_cast<vtkPolyData *>(data);
-    // Traverse data to determine number of uses of each point
-    for(elemId = 0; elemId < numElems; elemId++)
+    // Fill the lists, reusing the counters as the insert position of each vertex
+    for(std::atomic<T>& loc : linkCount)
     {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        linkCount[verts[j]]++;
-      }
+      loc.store(0, std::memory_order_relaxed);
     }
+    ParallelDataAlgorithm fillAlg;
+    fillAlg.setRange(0, numElems);
+    fillAlg.execute(Detail::FillElementsContainingVertImpl<T, K>(elems, numVertsPerElem, linkCount.data(), dynamicList.get()));
 
-    // Now allocate storage for the links
-    dynamicList->allocateLists(linkCount);
-
-    for(elemId = 0; elemId < numElems; elemId++)
+    // A parallel fill leaves each list in arbitrary order; restore ascending element order
+    if(fillAlg.getParallelizationEnabled())
     {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        dynamicList->insertCellReference(verts[j], (linkLoc[verts[j]])++, elemId);
-      }
+      ParallelDataAlgorithm sortAlg;
+      sortAlg.setRange(0, numVerts);
+      sortAlg.execute(Detail::SortElementListsImpl<T, K>(dynamicList.get()));
     }
   }
 
@@ -285,7 +661,7 @@ public:
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
     size_t numSharedVerts = 0;
-    QVector<T> linkCount(numElems, 0);
+    std::vector<T> linkCount(numElems, 0);
     int err = 0;
 
     switch(geometryType)
@@ -325,79 +701,19 @@ public:
       return -1;
     }
 
-    dynamicList->allocateLists(linkCount);
-
-    // Allocate an array of bools that we use each iteration so that we don't put duplicates into the array
-    typename DataArray<bool>::Pointer visitedPtr = DataArray<bool>::CreateArray(numElems, std::string("_INTERNAL_USE_ONLY_Visited"), true);
-    visitedPtr->initializeWithValue(false);
-    bool* visited = visitedPtr->getPointer(0);
+    const K* elems = elemList->getPointer(0);
 
-    // Reuse this vector for each loop. Avoids re-allocating the memory each time through the loop
-    QVector<K> loop_neighbors(32, 0);
-
-    // Build up the element adjacency list now that we have the element links
-    for(size_t t = 0; t < numElems; ++t)
-    {
-      //   qDebug() << "Analyzing Cell " << t << "\n";
-      K* seedElem = elemList->getTuplePointer(t);
-      for(size_t v = 0; v < numVertsPerElem; ++v)
-      {
-        //   qDebug() << " vert " << v << "\n";
-        T nEs = elemsContainingVert->getNumberOfElements(seedElem[v]);
-        K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
+    // Count the neighbors of every element so the lists can be carved out of one slab
+    ParallelDataAlgorithm countAlg;
+    countAlg.setRange(0, numElems);
+    countAlg.execute(Detail::FindElementNeighborsImpl<T, K>(elems, numVertsPerElem, numSharedVerts, elemsContainingVert.get(), linkCount.data(), nullptr));
 
-        for(T vt = 0; vt < nEs; ++vt)
-        {
-          if(vertIdxs[vt] == static_cast<K>(t))
-          {
-            continue;
-          } // This is the same element as our "source"
-          if(visited[vertIdxs[vt]] == true)
-          {
-            continue;
-          } // We already added this element so loop again
-          //      qDebug() << "   Comparing Element " << vertIdxs[vt] << "\n";
-          K* vertCell = elemList->getTuplePointer(vertIdxs[vt]);
-          size_t vCount = 0;
-          // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
-          // If there is numSharedVerts match then that element is a neighbor of the source. If there are more than numVertsPerElem
-          // matches then there is a real problem with the mesh and the program is going to return an error.
-          for(size_t i = 0; i < numVertsPerElem; i++)
-          {
-            for(size_t j = 0; j < numVertsPerElem; j++)
-            {
-              if(seedElem[i] == vertCell[j])
-              {
-                vCount++;
-              }
-            }
-          }
+    dynamicList->allocateLists(linkCount);
 
-          // So if our vertex match count is numSharedVerts and we have not visited the element in question then add this element index
-          // into the list of vertex indices as neighbors for the source element.
-          if(vCount == numSharedVerts)
-          {
-            // qDebug() << "       Neighbor: " << vertIdxs[vt] << "\n";
-            // Use the current count of neighbors as the index
-            // into the loop_neighbors vector and place the value of the vertex element at that index
-            loop_neighbors[linkCount[t]] = vertIdxs[vt];
-            linkCount[t]++; // Increment the count for the next time through
-            if(linkCount[t] >= loop_neighbors.size())
-            {
-              loop_neighbors.resize(loop_neighbors.size() + 10);
-            }
-            visited[vertIdxs[vt]] = true; // Set this element as visited so we do NOT add it again
-          }
-        }
-      }
-      // Reset all the visited cell indexs back to false (zero)
-      for(int64_t k = 0; k < linkCount[t]; ++k)
-      {
-        visited[loop_neighbors[k]] = false;
-      }
-      // Allocate the array storage for the current edge to hold its vertex list
-      dynamicList->setElementList(t, linkCount[t], &(loop_neighbors[0]));
-    }
+    // Build up the element adjacency list now that every list is sized
+    ParallelDataAlgorithm fillAlg;
+    fillAlg.setRange(0, numElems);
+    fillAlg.execute(Detail::FindElementNeighborsImpl<T, K>(elems, numVertsPerElem, numSharedVerts, elemsContainingVert.get(), linkCount.data(), dynamicList.get()));
 
     return err;
   }
@@ -408,9 +724,14 @@ public:
    * @param edgeList
    */
   template <typename T>
-  static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = elemList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 2>(elemList, PolygonEdgeKeys(elemList->getNumberOfComponents()), false, edgeList);
+      return;
+    }
     size_t numVertsPerElem = elemList->getNumberOfComponents();
     T v0 = 0;
     T v1 = 0;
@@ -472,11 +793,17 @@ public:
    * @brief FindTetEdges
    * @param tetList
    * @param edgeList
+   * @param method
    */
   template <typename T>
-  static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
+  static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = tetList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 2>(tetList, TetEdgeKeys(), false, edgeList);
+      return;
+    }
 
     std::pair<T, T> edge;
     std::set<std::pair<T, T>> edgeSet;
@@ -518,11 +845,17 @@ public:
    * @brief FindHexEdges
    * @param hexList
    * @param edgeList
+   * @param method
    */
   template <typename T>
-  static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edge_List)
+  static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edge_List, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = hexList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 2>(hexList, HexEdgeKeys(), false, edge_List);
+      return;
+    }
 
     std::pair<T, T> edge;
     std::set<std::pair<T, T>> edgeSet;
@@ -573,11 +906,17 @@ public:
    * @brief FindTetFaces
    * @param tetList
    * @param edgeList
+   * @param method
    */
   template <typename T>
-  static void FindTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
+  static void FindTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = tetList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 3>(tetList, TetFaceKeys(), false, faceList);
+      return;
+    }
 
     std::tuple<T, T, T> face;
     std::set<std::tuple<T, T, T>> faceSet;
@@ -618,11 +957,17 @@ public:
    * @brief FindHexFaces
    * @param hexList
    * @param edgeList
+   * @param method
    */
   template <typename T>
-  static void FindHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
+  static void FindHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = hexList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 4>(hexList, HexFaceKeys(), false, faceList);
+      return;
+    }
 
     std::tuple<T, T, T, T> face;
     std::set<std::tuple<T, T, T, T>> faceSet;
@@ -667,11 +1012,17 @@ public:
    * @brief Find2DUnsharedEdges
    * @param elemList
    * @param edgeList
+   * @param method
    */
   template <typename T>
-  static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = elemList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 2>(elemList, PolygonEdgeKeys(elemList->getNumberOfComponents()), true, edgeList);
+      return;
+    }
     size_t numVertsPerElem = elemList->getNumberOfComponents();
     T v0 = 0;
     T v1 = 0;
@@ -746,11 +1097,17 @@ public:
    * @brief FindUnsharedTetEdges
    * @param tetList
    * @param edgeList
+   * @param method
    */
   template <typename T>
-  static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
+  static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = tetList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 2>(tetList, TetEdgeKeys(), true, edgeList);
+      return;
+    }
 
     std::pair<T, T> edge;
     std::map<std::pair<T, T>, T> edgeMap;
@@ -805,11 +1162,17 @@ public:
    * @brief FindUnsharedHexEdges
    * @param hexList
    * @param edgeList
+   * @param method
    */
   template <typename T>
-  static void FindUnsharedHexEdges(typename DataArray<T>::Pointer& hexList, typename DataArray<T>::Pointer& edge_List)
+  static void FindUnsharedHexEdges(typename DataArray<T>::Pointer& hexList, typename DataArray<T>::Pointer& edge_List, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = hexList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 2>(hexList, HexEdgeKeys(), true, edge_List);
+      return;
+    }
 
     std::pair<T, T> edge;
     std::map<std::pair<T, T>, T> edgeMap;
@@ -873,11 +1236,17 @@ public:
    * @brief FindUnsharedTetFaces
    * @param tetList
    * @param edgeList
+   * @param method
    */
   template <typename T>
-  static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
+  static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = tetList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 3>(tetList, TetFaceKeys(), true, faceList);
+      return;
+    }
 
     std::tuple<T, T, T> face;
     std::map<std::tuple<T, T, T>, T> faceMap;
@@ -931,11 +1300,17 @@ public:
    * @brief FindUnsharedHexFaces
    * @param hexList
    * @param edgeList
+   * @param method
    */
   template <typename T>
-  static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
+  static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList, ExtractionMethod method = ExtractionMethod::Automatic)
   {
     size_t numElems = hexList->getNumberOfTuples();
+    if(UseSortedKeys(method, numElems))
+    {
+      FindUniqueKeys<T, 4>(hexList, HexFaceKeys(), true, faceList);
+      return;
+    }
 
     std::tuple<T, T, T, T> face;
     std::map<std::tuple<T, T, T, T>, T> faceMap;
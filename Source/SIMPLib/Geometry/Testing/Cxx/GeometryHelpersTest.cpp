@@ -0,0 +1,338 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+#include <iostream>
+
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+// Set to 1 to time the std::set and sorted key extraction methods. The benchmark is not run by default.
+#ifndef RUN_GEOMETRY_HELPERS_BENCHMARK
+#define RUN_GEOMETRY_HELPERS_BENCHMARK 0
+#endif
+
+class GeometryHelpersTest
+{
+public:
+  GeometryHelpersTest() = default;
+
+  virtual ~GeometryHelpersTest() = default;
+
+  using Connectivity = GeometryHelpers::Connectivity;
+  using ExtractionMethod = GeometryHelpers::Connectivity::ExtractionMethod;
+  using FindFunctionType = void (*)(DataArray<size_t>::Pointer, DataArray<size_t>::Pointer, ExtractionMethod);
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  size_t vertexId(size_t x, size_t y, size_t z, size_t nx, size_t ny)
+  {
+    return (z * (ny + 1) + y) * (nx + 1) + x;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two triangles per cell of an nx * ny grid
+  // -----------------------------------------------------------------------------
+  DataArray<size_t>::Pointer createTriangles(size_t nx, size_t ny)
+  {
+    DataArray<size_t>::Pointer tris = DataArray<size_t>::CreateArray(2 * nx * ny, {3}, "Triangles", true);
+    size_t* ptr = tris->getPointer(0);
+    for(size_t y = 0; y < ny; y++)
+    {
+      for(size_t x = 0; x < nx; x++)
+      {
+        size_t v0 = vertexId(x, y, 0, nx, ny);
+        size_t v1 = vertexId(x + 1, y, 0, nx, ny);
+        size_t v2 = vertexId(x + 1, y + 1, 0, nx, ny);
+        size_t v3 = vertexId(x, y + 1, 0, nx, ny);
+        *ptr++ = v0;
+        *ptr++ = v1;
+        *ptr++ = v2;
+        *ptr++ = v2;
+        *ptr++ = v3;
+        *ptr++ = v0;
+      }
+    }
+    return tris;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataArray<size_t>::Pointer createHexahedra(size_t nx, size_t ny, size_t nz)
+  {
+    DataArray<size_t>::Pointer hexas = DataArray<size_t>::CreateArray(nx * ny * nz, {8}, "Hexahedra", true);
+    size_t* ptr = hexas->getPointer(0);
+    for(size_t z = 0; z < nz; z++)
+    {
+      for(size_t y = 0; y < ny; y++)
+      {
+        for(size_t x = 0; x < nx; x++)
+        {
+          for(size_t k = 0; k < 2; k++)
+          {
+            *ptr++ = vertexId(x, y, z + k, nx, ny);
+            *ptr++ = vertexId(x + 1, y, z + k, nx, ny);
+            *ptr++ = vertexId(x + 1, y + 1, z + k, nx, ny);
+            *ptr++ = vertexId(x, y + 1, z + k, nx, ny);
+          }
+        }
+      }
+    }
+    return hexas;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Six tetrahedra per hexahedron sharing the 0-6 diagonal
+  // -----------------------------------------------------------------------------
+  DataArray<size_t>::Pointer createTetrahedra(size_t nx, size_t ny, size_t nz)
+  {
+    DataArray<size_t>::Pointer hexas = createHexahedra(nx, ny, nz);
+    size_t numHexas = hexas->getNumberOfTuples();
+    DataArray<size_t>::Pointer tets = DataArray<size_t>::CreateArray(6 * numHexas, {4}, "Tetrahedra", true);
+    const size_t split[6][4] = {{0, 1, 2, 6}, {0, 2, 3, 6}, {0, 3, 7, 6}, {0, 7, 4, 6}, {0, 4, 5, 6}, {0, 5, 1, 6}};
+    size_t* ptr = tets->getPointer(0);
+    for(size_t i = 0; i < numHexas; i++)
+    {
+      size_t* verts = hexas->getTuplePointer(i);
+      for(const auto& tet : split)
+      {
+        for(size_t j : tet)
+        {
+          *ptr++ = verts[j];
+        }
+      }
+    }
+    return tets;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataArray<size_t>::Pointer runFind(FindFunctionType func, const DataArray<size_t>::Pointer& elems, ExtractionMethod method, size_t numComps)
+  {
+    DataArray<size_t>::Pointer keys = DataArray<size_t>::CreateArray(0, {numComps}, "Keys", true);
+    func(elems, keys, method);
+    return keys;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void compareMethods(FindFunctionType func, const DataArray<size_t>::Pointer& elems, size_t numComps, size_t expectedTuples)
+  {
+    DataArray<size_t>::Pointer setKeys = runFind(func, elems, ExtractionMethod::OrderedSet, numComps);
+    DataArray<size_t>::Pointer sortedKeys = runFind(func, elems, ExtractionMethod::SortedKeys, numComps);
+    DataArray<size_t>::Pointer autoKeys = runFind(func, elems, ExtractionMethod::Automatic, numComps);
+
+    DREAM3D_REQUIRE_EQUAL(setKeys->getNumberOfTuples(), expectedTuples)
+    DREAM3D_REQUIRE_EQUAL(sortedKeys->getNumberOfTuples(), expectedTuples)
+    DREAM3D_REQUIRE_EQUAL(autoKeys->getNumberOfTuples(), expectedTuples)
+
+    size_t numValues = expectedTuples * numComps;
+    for(size_t i = 0; i < numValues; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(setKeys->getValue(i), sortedKeys->getValue(i))
+      DREAM3D_REQUIRE_EQUAL(setKeys->getValue(i), autoKeys->getValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTriangleEdges()
+  {
+    const size_t nx = 7;
+    const size_t ny = 5;
+    DataArray<size_t>::Pointer tris = createTriangles(nx, ny);
+
+    compareMethods(Connectivity::Find2DElementEdges<size_t>, tris, 2, nx * (ny + 1) + ny * (nx + 1) + nx * ny);
+    compareMethods(Connectivity::Find2DUnsharedEdges<size_t>, tris, 2, 2 * (nx + ny));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTetrahedralEdgesAndFaces()
+  {
+    const size_t nx = 4;
+    const size_t ny = 3;
+    const size_t nz = 2;
+    DataArray<size_t>::Pointer tets = createTetrahedra(nx, ny, nz);
+
+    // Grid edges + one diagonal per grid face + one body diagonal per cell
+    size_t gridEdges = nx * (ny + 1) * (nz + 1) + ny * (nx + 1) * (nz + 1) + nz * (nx + 1) * (ny + 1);
+    size_t gridFaces = nx * ny * (nz + 1) + ny * nz * (nx + 1) + nx * nz * (ny + 1);
+    size_t boundaryFaces = 2 * (nx * ny + ny * nz + nx * nz);
+    compareMethods(Connectivity::FindTetEdges<size_t>, tets, 2, gridEdges + gridFaces + nx * ny * nz);
+    compareMethods(Connectivity::FindTetFaces<size_t>, tets, 3, 2 * gridFaces + 6 * nx * ny * nz);
+    compareMethods(Connectivity::FindUnsharedTetFaces<size_t>, tets, 3, 2 * boundaryFaces);
+
+    DataArray<size_t>::Pointer setKeys = runFind(Connectivity::FindUnsharedTetEdges<size_t>, tets, ExtractionMethod::OrderedSet, 2);
+    DataArray<size_t>::Pointer sortedKeys = runFind(Connectivity::FindUnsharedTetEdges<size_t>, tets, ExtractionMethod::SortedKeys, 2);
+    DREAM3D_REQUIRE_EQUAL(setKeys->getNumberOfTuples(), sortedKeys->getNumberOfTuples())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void checkElementLinks(const DataArray<size_t>::Pointer& elems, size_t numVerts, IGeometry::Type geometryType, size_t expectedNeighbors)
+  {
+    size_t numElems = elems->getNumberOfTuples();
+    size_t numVertsPerElem = elems->getNumberOfComponents();
+
+    ElementDynamicList::Pointer elemsContainingVert = ElementDynamicList::New();
+    Connectivity::FindElementsContainingVert<uint16_t, size_t>(elems, elemsContainingVert, numVerts);
+    DREAM3D_REQUIRE_EQUAL(elemsContainingVert->size(), numVerts)
+
+    // Every element must appear once in the list of each of its vertices, in ascending order
+    size_t total = 0;
+    for(size_t v = 0; v < numVerts; v++)
+    {
+      uint16_t count = elemsContainingVert->getNumberOfElements(v);
+      size_t* list = elemsContainingVert->getElementListPointer(v);
+      for(uint16_t k = 0; k < count; k++)
+      {
+        size_t* verts = elems->getTuplePointer(list[k]);
+        DREAM3D_REQUIRE(std::find(verts, verts + numVertsPerElem, v) != verts + numVertsPerElem)
+        if(k > 0)
+        {
+          DREAM3D_REQUIRE(list[k - 1] < list[k])
+        }
+      }
+      total += count;
+    }
+    DREAM3D_REQUIRE_EQUAL(total, numElems * numVertsPerElem)
+
+    ElementDynamicList::Pointer neighbors = ElementDynamicList::New();
+    int err = Connectivity::FindElementNeighbors<uint16_t, size_t>(elems, elemsContainingVert, neighbors, geometryType);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(neighbors->size(), numElems)
+
+    // Neighborhood is symmetric and every shared edge/face is counted from both sides
+    total = 0;
+    for(size_t e = 0; e < numElems; e++)
+    {
+      uint16_t count = neighbors->getNumberOfElements(e);
+      size_t* list = neighbors->getElementListPointer(e);
+      for(uint16_t k = 0; k < count; k++)
+      {
+        size_t* back = neighbors->getElementListPointer(list[k]);
+        uint16_t backCount = neighbors->getNumberOfElements(list[k]);
+        DREAM3D_REQUIRE(std::find(back, back + backCount, e) != back + backCount)
+      }
+      total += count;
+    }
+    DREAM3D_REQUIRE_EQUAL(total, expectedNeighbors)
+
+    ElementDynamicList::Pointer copy = neighbors->deepCopy();
+    for(size_t e = 0; e < numElems; e++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copy->getNumberOfElements(e), neighbors->getNumberOfElements(e))
+      DREAM3D_REQUIRE(std::equal(neighbors->getElementListPointer(e), neighbors->getElementListPointer(e) + neighbors->getNumberOfElements(e), copy->getElementListPointer(e)))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestElementLinks()
+  {
+    const size_t nx = 6;
+    const size_t ny = 5;
+    const size_t nz = 4;
+
+    // Each triangle pair shares its diagonal, plus every interior grid edge
+    size_t interiorEdges = nx * ny + (nx - 1) * ny + nx * (ny - 1);
+    checkElementLinks(createTriangles(nx, ny), (nx + 1) * (ny + 1), IGeometry::Type::Triangle, 2 * interiorEdges);
+
+    size_t interiorFaces = (nx - 1) * ny * nz + nx * (ny - 1) * nz + nx * ny * (nz - 1);
+    checkElementLinks(createHexahedra(nx, ny, nz), (nx + 1) * (ny + 1) * (nz + 1), IGeometry::Type::Hexahedral, 2 * interiorFaces);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHexahedralEdgesAndFaces()
+  {
+    const size_t nx = 4;
+    const size_t ny = 3;
+    const size_t nz = 2;
+    DataArray<size_t>::Pointer hexas = createHexahedra(nx, ny, nz);
+
+    size_t gridEdges = nx * (ny + 1) * (nz + 1) + ny * (nx + 1) * (nz + 1) + nz * (nx + 1) * (ny + 1);
+    size_t gridFaces = nx * ny * (nz + 1) + ny * nz * (nx + 1) + nx * nz * (ny + 1);
+    size_t boundaryFaces = 2 * (nx * ny + ny * nz + nx * nz);
+    compareMethods(Connectivity::FindHexEdges<size_t>, hexas, 2, gridEdges);
+    compareMethods(Connectivity::FindHexFaces<size_t>, hexas, 4, gridFaces);
+    compareMethods(Connectivity::FindUnsharedHexFaces<size_t>, hexas, 4, boundaryFaces);
+
+    DataArray<size_t>::Pointer setKeys = DataArray<size_t>::CreateArray(0, {2}, "Keys", true);
+    DataArray<size_t>::Pointer sortedKeys = DataArray<size_t>::CreateArray(0, {2}, "Keys", true);
+    Connectivity::FindUnsharedHexEdges<size_t>(hexas, setKeys, ExtractionMethod::OrderedSet);
+    Connectivity::FindUnsharedHexEdges<size_t>(hexas, sortedKeys, ExtractionMethod::SortedKeys);
+    DREAM3D_REQUIRE_EQUAL(setKeys->getNumberOfTuples(), sortedKeys->getNumberOfTuples())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void benchmarkFind(const QString& name, FindFunctionType func, const DataArray<size_t>::Pointer& elems, size_t numComps)
+  {
+    std::array<ExtractionMethod, 2> methods = {ExtractionMethod::OrderedSet, ExtractionMethod::SortedKeys};
+    std::array<const char*, 2> labels = {"std::set", "Sorted Keys"};
+    std::array<size_t, 2> counts = {0, 0};
+    for(size_t m = 0; m < methods.size(); m++)
+    {
+      auto start = std::chrono::steady_clock::now();
+      DataArray<size_t>::Pointer keys = runFind(func, elems, methods[m], numComps);
+      auto end = std::chrono::steady_clock::now();
+      counts[m] = keys->getNumberOfTuples();
+
+      auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+      std::cout << "\t" << name.toStdString() << " [" << labels[m] << "] " << elems->getNumberOfTuples() << " elements: " << elapsed.count() << " milliseconds" << std::endl;
+    }
+    DREAM3D_REQUIRE_EQUAL(counts[0], counts[1])
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void BenchmarkExtractionMethods()
+  {
+    DataArray<size_t>::Pointer tris = createTriangles(500, 500);
+    benchmarkFind("Find2DElementEdges", Connectivity::Find2DElementEdges<size_t>, tris, 2);
+    benchmarkFind("Find2DUnsharedEdges", Connectivity::Find2DUnsharedEdges<size_t>, tris, 2);
+
+    DataArray<size_t>::Pointer tets = createTetrahedra(40, 40, 40);
+    benchmarkFind("FindTetEdges", Connectivity::FindTetEdges<size_t>, tets, 2);
+    benchmarkFind("FindTetFaces", Connectivity::FindTetFaces<size_t>, tets, 3);
+
+    DataArray<size_t>::Pointer hexas = createHexahedra(60, 60, 60);
+    benchmarkFind("FindHexEdges", Connectivity::FindHexEdges<size_t>, hexas, 2);
+    benchmarkFind("FindHexFaces", Connectivity::FindHexFaces<size_t>, hexas, 4);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GeometryHelpersTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestTriangleEdges());
+    DREAM3D_REGISTER_TEST(TestTetrahedralEdgesAndFaces());
+    DREAM3D_REGISTER_TEST(TestHexahedralEdgesAndFaces());
+    DREAM3D_REGISTER_TEST(TestElementLinks());
+#if RUN_GEOMETRY_HELPERS_BENCHMARK
+    DREAM3D_REGISTER_TEST(BenchmarkExtractionMethods());
+#endif
+  }
+
+private:
+  GeometryHelpersTest(const GeometryHelpersTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GeometryHelpersTest&) = delete;      // Move assignment Not Implemented
+};
@@ -0,0 +1,415 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5ChunkedDatasetWriter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <QtCore/QByteArray>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+
+namespace
+{
+thread_local const H5ChunkedDatasetWriter::Options* s_CurrentOptions = nullptr;
+
+/**
+ * @brief The ChunkLayout struct describes how a dataset is split into contiguous chunks
+ */
+struct ChunkLayout
+{
+  std::vector<hsize_t> dims;
+  std::vector<hsize_t> chunkDims;
+  size_t splitDim = 0;
+  size_t innerElements = 1;
+  size_t chunksPerSplit = 1;
+  size_t numChunks = 0;
+  size_t chunkElements = 0;
+  size_t typeSize = 0;
+
+  /**
+   * @brief Returns the first element of the chunk in the array and the number of elements that lie inside the dataset
+   */
+  void elementRange(size_t chunk, size_t& start, size_t& count) const
+  {
+    size_t outer = chunk / chunksPerSplit;
+    size_t splitStart = (chunk % chunksPerSplit) * chunkDims[splitDim];
+    start = (outer * dims[splitDim] + splitStart) * innerElements;
+    count = std::min<size_t>(chunkDims[splitDim], dims[splitDim] - splitStart) * innerElements;
+  }
+
+  /**
+   * @brief Returns the logical offset of the chunk in the dataset
+   */
+  std::vector<hsize_t> offset(size_t chunk) const
+  {
+    std::vector<hsize_t> offsets(dims.size(), 0);
+    size_t outer = chunk / chunksPerSplit;
+    offsets[splitDim] = (chunk % chunksPerSplit) * chunkDims[splitDim];
+    for(size_t i = splitDim; i > 0; i--)
+    {
+      offsets[i - 1] = outer % dims[i - 1];
+      outer = outer / dims[i - 1];
+    }
+    return offsets;
+  }
+};
+
+/**
+ * @brief The EncodedChunk struct holds one chunk as it is stored in the file
+ */
+struct EncodedChunk
+{
+  QByteArray bytes;
+  int dataOffset = 0;
+  uint32_t filterMask = 0;
+};
+
+/**
+ * @brief The EncodeChunksImpl class shuffles and compresses a range of chunks
+ */
+class EncodeChunksImpl
+{
+public:
+  EncodeChunksImpl(const ChunkLayout* layout, const char* data, const H5ChunkedDatasetWriter::Options* options, size_t firstChunk, std::vector<EncodedChunk>* chunks)
+  : m_Layout(layout)
+  , m_Data(data)
+  , m_Options(options)
+  , m_FirstChunk(firstChunk)
+  , m_Chunks(chunks)
+  {
+  }
+  EncodeChunksImpl(const EncodeChunksImpl&) = default;           // Copy Constructor Not Implemented
+  EncodeChunksImpl(EncodeChunksImpl&&) = default;                // Move Constructor Not Implemented
+  EncodeChunksImpl& operator=(const EncodeChunksImpl&) = delete; // Copy Assignment Not Implemented
+  EncodeChunksImpl& operator=(EncodeChunksImpl&&) = delete;      // Move Assignment Not Implemented
+  ~EncodeChunksImpl() = default;
+
+  void encode(size_t index) const
+  {
+    const size_t typeSize = m_Layout->typeSize;
+    const int chunkBytes = static_cast<int>(m_Layout->chunkElements * typeSize);
+    size_t start = 0;
+    size_t count = 0;
+    m_Layout->elementRange(m_FirstChunk + index, start, count);
+    const char* source = m_Data + start * typeSize;
+
+    // Edge chunks are padded with zeros; HDF5 ignores the values outside of the dataset
+    QByteArray raw;
+    if(m_Options->shuffle || count != m_Layout->chunkElements)
+    {
+      raw = QByteArray(chunkBytes, '\0');
+      if(m_Options->shuffle)
+      {
+        QByteArray padded;
+        if(count != m_Layout->chunkElements)
+        {
+          padded = QByteArray(chunkBytes, '\0');
+          std::memcpy(padded.data(), source, count * typeSize);
+          source = padded.constData();
+        }
+        H5ChunkedDatasetWriter::ShuffleBytes(source, m_Layout->chunkElements, typeSize, raw.data());
+      }
+      else
+      {
+        std::memcpy(raw.data(), source, count * typeSize);
+      }
+      source = raw.constData();
+    }
+
+    // qCompress() produces a zlib stream, the format the deflate filter expects, behind a 4 byte length
+    EncodedChunk& chunk = (*m_Chunks)[index];
+    chunk.bytes = qCompress(reinterpret_cast<const uchar*>(source), chunkBytes, m_Options->compressionLevel);
+    chunk.dataOffset = 4;
+    chunk.filterMask = 0;
+    if(chunk.bytes.size() - chunk.dataOffset >= chunkBytes)
+    {
+      // Like the deflate filter itself, store chunks that do not compress without it
+      chunk.bytes = (source == raw.constData()) ? raw : QByteArray(source, chunkBytes);
+      chunk.dataOffset = 0;
+      chunk.filterMask = m_Options->shuffle ? 0x2 : 0x1;
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      encode(i);
+    }
+  }
+
+  void operator()() const
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, m_Chunks->size());
+    dataAlg.execute(*this);
+  }
+
+private:
+  const ChunkLayout* m_Layout = nullptr;
+  const char* m_Data = nullptr;
+  const H5ChunkedDatasetWriter::Options* m_Options = nullptr;
+  size_t m_FirstChunk = 0;
+  std::vector<EncodedChunk>* m_Chunks = nullptr;
+};
+
+#if H5_VERSION_GE(1, 10, 3)
+/**
+ * @brief Writes the already filtered chunks directly into the dataset. The chunks of the next batch are
+ * encoded on other threads while the current batch is written.
+ * @return
+ */
+herr_t WriteEncodedChunks(hid_t datasetId, const ChunkLayout& layout, const char* data, const H5ChunkedDatasetWriter::Options& options)
+{
+  const size_t chunkBytes = layout.chunkElements * layout.typeSize;
+  const size_t chunksPerBatch = std::max<size_t>(1, H5ChunkedDatasetWriter::k_BatchBytes / chunkBytes);
+
+  std::vector<EncodedChunk> current(std::min(chunksPerBatch, layout.numChunks));
+  EncodeChunksImpl(&layout, data, &options, 0, &current)();
+
+  std::vector<EncodedChunk> next;
+  for(size_t batchStart = 0; batchStart < layout.numChunks; batchStart += chunksPerBatch)
+  {
+    size_t nextStart = batchStart + chunksPerBatch;
+    ParallelTaskAlgorithm taskAlg;
+    if(nextStart < layout.numChunks)
+    {
+      next.resize(std::min(chunksPerBatch, layout.numChunks - nextStart));
+      taskAlg.execute(EncodeChunksImpl(&layout, data, &options, nextStart, &next));
+    }
+
+    herr_t err = 0;
+    for(size_t i = 0; i < current.size() && err >= 0; i++)
+    {
+      const EncodedChunk& chunk = current[i];
+      std::vector<hsize_t> offset = layout.offset(batchStart + i);
+      err = H5Dwrite_chunk(datasetId, H5P_DEFAULT, chunk.filterMask, offset.data(), static_cast<size_t>(chunk.bytes.size() - chunk.dataOffset), chunk.bytes.constData() + chunk.dataOffset);
+    }
+    taskAlg.wait();
+    if(err < 0)
+    {
+      return err;
+    }
+    current.swap(next);
+  }
+  return 0;
+}
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5ChunkedDatasetWriter::Options::isEnabled() const
+{
+  return chunked || compressionLevel > 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5ChunkedDatasetWriter::ScopedOptions::ScopedOptions(const Options& options)
+: m_Options(options)
+, m_Previous(s_CurrentOptions)
+{
+  s_CurrentOptions = &m_Options;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5ChunkedDatasetWriter::ScopedOptions::~ScopedOptions()
+{
+  s_CurrentOptions = m_Previous;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5ChunkedDatasetWriter::H5ChunkedDatasetWriter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5ChunkedDatasetWriter::~H5ChunkedDatasetWriter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const H5ChunkedDatasetWriter::Options& H5ChunkedDatasetWriter::CurrentOptions()
+{
+  static const Options k_DefaultOptions;
+  return (nullptr != s_CurrentOptions) ? *s_CurrentOptions : k_DefaultOptions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<hsize_t> H5ChunkedDatasetWriter::ComputeChunkDimensions(const std::vector<hsize_t>& dims, size_t numComponentDims, size_t typeSize, size_t chunkBytes)
+{
+  if(dims.empty() || std::find(dims.begin(), dims.end(), 0) != dims.end())
+  {
+    return std::vector<hsize_t>();
+  }
+
+  std::vector<hsize_t> chunkDims(dims.size(), 1);
+  size_t bytes = typeSize;
+  size_t numTupleDims = dims.size() - std::min(numComponentDims, dims.size());
+  for(size_t i = dims.size(); i > 0; i--)
+  {
+    size_t dim = i - 1;
+    // Component dimensions are always whole so every chunk holds complete tuples
+    if(dim >= numTupleDims || bytes * dims[dim] <= chunkBytes)
+    {
+      chunkDims[dim] = dims[dim];
+      bytes = bytes * dims[dim];
+      continue;
+    }
+    chunkDims[dim] = std::max<size_t>(1, chunkBytes / bytes);
+    bytes = bytes * chunkDims[dim];
+    break;
+  }
+
+  // HDF5 limits a chunk to 4 GB
+  if(bytes >= std::numeric_limits<uint32_t>::max())
+  {
+    return std::vector<hsize_t>();
+  }
+  return chunkDims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5ChunkedDatasetWriter::ShuffleBytes(const char* source, size_t numElements, size_t typeSize, char* destination)
+{
+  for(size_t b = 0; b < typeSize; b++)
+  {
+    char* dest = destination + b * numElements;
+    const char* src = source + b;
+    for(size_t i = 0; i < numElements; i++)
+    {
+      dest[i] = src[i * typeSize];
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5ChunkedDatasetWriter::WriteDataset(hid_t locId, const QString& name, int rank, const hsize_t* dims, const void* data, hid_t dataType, size_t typeSize, size_t numComponentDims,
+                                            const Options& options)
+{
+  ChunkLayout layout;
+  layout.dims = std::vector<hsize_t>(dims, dims + rank);
+  layout.typeSize = typeSize;
+  layout.chunkDims = ComputeChunkDimensions(layout.dims, numComponentDims, typeSize, options.chunkBytes);
+
+  hid_t dataspaceId = H5Screate_simple(rank, dims, nullptr);
+  if(dataspaceId < 0)
+  {
+    return -1;
+  }
+  hid_t dcplId = H5Pcreate(H5P_DATASET_CREATE);
+
+  bool compress = false;
+  if(!layout.chunkDims.empty())
+  {
+    H5Pset_chunk(dcplId, rank, layout.chunkDims.data());
+    compress = options.compressionLevel > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+    if(compress && options.shuffle)
+    {
+      H5Pset_shuffle(dcplId);
+    }
+    if(compress)
+    {
+      H5Pset_deflate(dcplId, static_cast<unsigned>(std::min(options.compressionLevel, 9)));
+    }
+  }
+
+  herr_t err = -1;
+  hid_t datasetId = H5Dcreate(locId, name.toStdString().c_str(), dataType, dataspaceId, H5P_DEFAULT, dcplId, H5P_DEFAULT);
+  if(datasetId >= 0)
+  {
+    bool written = false;
+#if H5_VERSION_GE(1, 10, 3)
+    if(compress)
+    {
+      // The split dimension is the slowest dimension that is followed only by whole dimensions
+      layout.splitDim = layout.dims.size() - 1;
+      while(layout.splitDim > 0 && layout.chunkDims[layout.splitDim] == layout.dims[layout.splitDim])
+      {
+        layout.splitDim--;
+      }
+      for(size_t i = layout.splitDim + 1; i < layout.dims.size(); i++)
+      {
+        layout.innerElements *= layout.dims[i];
+      }
+      size_t outerElements = 1;
+      for(size_t i = 0; i < layout.splitDim; i++)
+      {
+        outerElements *= layout.dims[i];
+      }
+      layout.chunksPerSplit = (layout.dims[layout.splitDim] + layout.chunkDims[layout.splitDim] - 1) / layout.chunkDims[layout.splitDim];
+      layout.numChunks = outerElements * layout.chunksPerSplit;
+      layout.chunkElements = layout.chunkDims[layout.splitDim] * layout.innerElements;
+
+      // Direct chunk writes need every chunk to be a contiguous part of the array and small enough for qCompress()
+      bool contiguous = layout.chunkElements * typeSize < static_cast<size_t>(std::numeric_limits<int>::max() - 16);
+      for(size_t i = 0; i < layout.dims.size(); i++)
+      {
+        contiguous = contiguous && ((i < layout.splitDim) ? layout.chunkDims[i] == 1 : (i == layout.splitDim || layout.chunkDims[i] == layout.dims[i]));
+      }
+      if(contiguous)
+      {
+        err = WriteEncodedChunks(datasetId, layout, static_cast<const char*>(data), options);
+        written = true;
+      }
+    }
+#endif
+    if(!written)
+    {
+      err = H5Dwrite(datasetId, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    }
+    H5Dclose(datasetId);
+  }
+
+  H5Pclose(dcplId);
+  H5Sclose(dataspaceId);
+  return err;
+}
@@ -0,0 +1,183 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <hdf5.h>
+
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "H5Support/H5Lite.h"
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The H5ChunkedDatasetWriter class writes numeric datasets with a chunked layout and, optionally,
+ * the HDF5 shuffle and deflate filters. The chunk shape is picked from the dataset dimensions: component
+ * dimensions are always kept whole and the fastest tuple dimensions are filled first, so the chunks of an
+ * Image Geometry array are whole XY slices (or runs of rows for very large slices). When the HDF5 library
+ * supports direct chunk writes the chunks are shuffled and compressed on all available threads while the
+ * previous batch is written to the file; otherwise HDF5 applies the filters itself. Files written this way
+ * are read back through the normal HDF5 API without any changes to the readers.
+ *
+ * The options in effect are thread local and are normally installed by DataContainerWriter with a
+ * ScopedOptions object for the duration of the write.
+ */
+class SIMPLib_EXPORT H5ChunkedDatasetWriter
+{
+public:
+  /**
+   * @brief Default number of bytes in each chunk
+   */
+  static constexpr size_t k_DefaultChunkBytes = 1024 * 1024;
+
+  /**
+   * @brief Approximate number of uncompressed bytes compressed together before they are written
+   */
+  static constexpr size_t k_BatchBytes = 64 * 1024 * 1024;
+
+  struct Options
+  {
+    bool chunked = false;
+    int compressionLevel = 0;
+    bool shuffle = false;
+    size_t chunkBytes = k_DefaultChunkBytes;
+
+    /**
+     * @brief Returns true if datasets should be written with a chunked layout. Compression implies chunking.
+     * @return
+     */
+    bool isEnabled() const;
+  };
+
+  /**
+   * @brief The ScopedOptions class installs a set of options for the current thread and restores the
+   * previous options when it goes out of scope.
+   */
+  class SIMPLib_EXPORT ScopedOptions
+  {
+  public:
+    ScopedOptions(const Options& options);
+    ~ScopedOptions();
+
+    ScopedOptions(const ScopedOptions&) = delete;            // Copy Constructor Not Implemented
+    ScopedOptions(ScopedOptions&&) = delete;                 // Move Constructor Not Implemented
+    ScopedOptions& operator=(const ScopedOptions&) = delete; // Copy Assignment Not Implemented
+    ScopedOptions& operator=(ScopedOptions&&) = delete;      // Move Assignment Not Implemented
+
+  private:
+    Options m_Options;
+    const Options* m_Previous = nullptr;
+  };
+
+  virtual ~H5ChunkedDatasetWriter();
+
+  /**
+   * @brief Returns the options in effect for the current thread
+   * @return
+   */
+  static const Options& CurrentOptions();
+
+  /**
+   * @brief Computes the chunk dimensions for a dataset. The dimensions are in HDF5 order (slowest first)
+   * and the last numComponentDims of them are the component dimensions. Every dimension faster than the
+   * split dimension is whole and every dimension slower than it has a chunk size of 1, so each chunk covers
+   * a contiguous range of the array. Returns an empty vector if the dataset should not be chunked.
+   * @param dims
+   * @param numComponentDims
+   * @param typeSize
+   * @param chunkBytes
+   * @return
+   */
+  static std::vector<hsize_t> ComputeChunkDimensions(const std::vector<hsize_t>& dims, size_t numComponentDims, size_t typeSize, size_t chunkBytes);
+
+  /**
+   * @brief Rearranges the bytes of numElements values so that byte 'b' of every value is stored together,
+   * which is the transformation the HDF5 shuffle filter applies.
+   * @param source
+   * @param numElements
+   * @param typeSize
+   * @param destination
+   */
+  static void ShuffleBytes(const char* source, size_t numElements, size_t typeSize, char* destination);
+
+  /**
+   * @brief Creates and writes a chunked dataset using the given options
+   * @param locId
+   * @param name
+   * @param rank
+   * @param dims Dimensions in HDF5 order
+   * @param data
+   * @param numComponentDims
+   * @param options
+   * @return
+   */
+  template <typename T>
+  static herr_t WriteDataset(hid_t locId, const QString& name, int rank, const hsize_t* dims, const T* data, size_t numComponentDims, const Options& options)
+  {
+    T value = static_cast<T>(0);
+    hid_t dataType = H5Lite::HDFTypeForPrimitive(value);
+    if(dataType == -1)
+    {
+      return -1;
+    }
+    return WriteDataset(locId, name, rank, dims, data, dataType, sizeof(T), numComponentDims, options);
+  }
+
+  /**
+   * @brief Creates and writes a chunked dataset of the given native type using the given options
+   * @param locId
+   * @param name
+   * @param rank
+   * @param dims Dimensions in HDF5 order
+   * @param data
+   * @param dataType
+   * @param typeSize
+   * @param numComponentDims
+   * @param options
+   * @return
+   */
+  static herr_t WriteDataset(hid_t locId, const QString& name, int rank, const hsize_t* dims, const void* data, hid_t dataType, size_t typeSize, size_t numComponentDims, const Options& options);
+
+protected:
+  H5ChunkedDatasetWriter();
+
+public:
+  H5ChunkedDatasetWriter(const H5ChunkedDatasetWriter&) = delete;            // Copy Constructor Not Implemented
+  H5ChunkedDatasetWriter(H5ChunkedDatasetWriter&&) = delete;                 // Move Constructor Not Implemented
+  H5ChunkedDatasetWriter& operator=(const H5ChunkedDatasetWriter&) = delete; // Copy Assignment Not Implemented
+  H5ChunkedDatasetWriter& operator=(H5ChunkedDatasetWriter&&) = delete;      // Move Assignment Not Implemented
+};
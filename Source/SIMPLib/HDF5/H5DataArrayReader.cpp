@@ -35,8 +35,11 @@
 
 #include "H5DataArrayReader.h"
 
+#include <functional>
+#include <numeric>
 #include <vector>
 
+#include "H5Support/H5Lite.h"
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
@@ -80,6 +83,88 @@ IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const
   }
   return ptr;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer readH5DatasetSubset(hid_t locId, const QString& datasetPath, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount, const std::vector<size_t>& cDims)
+{
+  IDataArray::Pointer ptr = DataArray<T>::CreateArray(tupleCount, cDims, datasetPath, true);
+  if(ptr->getNumberOfTuples() == 0)
+  {
+    return ptr;
+  }
+
+  hid_t datasetId = H5Dopen(locId, datasetPath.toStdString().c_str(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    qDebug() << "readH5DatasetSubset open error: " << __FILE__ << "(" << __LINE__ << ")";
+    return IDataArray::NullPointer();
+  }
+  hid_t fileSpaceId = H5Dget_space(datasetId);
+
+  // The file stores the tuple dimensions slowest to fastest (ZYX) followed by the reversed component dimensions.
+  // The component dimensions are always selected whole.
+  const size_t rank = tupleCount.size() + cDims.size();
+  if(fileSpaceId < 0 || H5Sget_simple_extent_ndims(fileSpaceId) != static_cast<int>(rank))
+  {
+    qDebug() << "readH5DatasetSubset rank mismatch: " << __FILE__ << "(" << __LINE__ << ")";
+    if(fileSpaceId >= 0)
+    {
+      H5Sclose(fileSpaceId);
+    }
+    H5Dclose(datasetId);
+    return IDataArray::NullPointer();
+  }
+  std::vector<hsize_t> offset(rank, 0);
+  std::vector<hsize_t> count(rank, 0);
+  for(size_t i = 0; i < tupleCount.size(); i++)
+  {
+    offset[tupleCount.size() - 1 - i] = tupleStart[i];
+    count[tupleCount.size() - 1 - i] = tupleCount[i];
+  }
+  for(size_t i = 0; i < cDims.size(); i++)
+  {
+    count[rank - 1 - i] = cDims[i];
+  }
+
+  herr_t err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+  if(err >= 0)
+  {
+    hid_t memSpaceId = H5Screate_simple(static_cast<int>(rank), count.data(), nullptr);
+    T* data = static_cast<T*>(ptr->getVoidPointer(0));
+    err = H5Dread(datasetId, H5Lite::HDFTypeForPrimitive(data[0]), memSpaceId, fileSpaceId, H5P_DEFAULT, data);
+    H5Sclose(memSpaceId);
+  }
+  if(err < 0)
+  {
+    qDebug() << "readH5DatasetSubset read error: " << __FILE__ << "(" << __LINE__ << ")";
+    ptr = IDataArray::NullPointer();
+  }
+  H5Sclose(fileSpaceId);
+  H5Dclose(datasetId);
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const std::vector<size_t>& tDims, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount,
+                                  const std::vector<size_t>& cDims, bool metaDataOnly)
+{
+  const bool subset = !tupleCount.empty();
+  if(metaDataOnly)
+  {
+    return DataArray<T>::CreateArray(subset ? tupleCount : tDims, cDims, datasetPath, false);
+  }
+  if(subset)
+  {
+    return readH5DatasetSubset<T>(locId, datasetPath, tupleStart, tupleCount, cDims);
+  }
+  return readH5Dataset<T>(locId, datasetPath, tDims, cDims);
+}
 } // namespace Detail
 
 // -----------------------------------------------------------------------------
@@ -121,6 +206,71 @@ int H5DataArrayReader::ReadRequiredAttributes(hid_t gid, const QString& name, QS
   return retErr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DataArrayReader::IsValidTupleSubset(const std::vector<size_t>& tDims, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount)
+{
+  if(tupleStart.size() != tDims.size() || tupleCount.size() != tDims.size())
+  {
+    return false;
+  }
+  for(size_t i = 0; i < tDims.size(); i++)
+  {
+    if(tupleStart[i] > tDims[i] || tupleCount[i] > tDims[i] - tupleStart[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ExtractTupleSubset(const IDataArray::Pointer& source, const std::vector<size_t>& tDims, const std::vector<size_t>& tupleStart,
+                                                          const std::vector<size_t>& tupleCount)
+{
+  if(nullptr == source.get() || !IsValidTupleSubset(tDims, tupleStart, tupleCount))
+  {
+    return IDataArray::NullPointer();
+  }
+  size_t numTuples = std::accumulate(tupleCount.begin(), tupleCount.end(), static_cast<size_t>(1), std::multiplies<>());
+  IDataArray::Pointer dest = source->createNewArray(numTuples, source->getComponentDimensions(), source->getName(), source->isAllocated());
+  if(numTuples == 0 || !source->isAllocated())
+  {
+    return dest;
+  }
+
+  // Copy one contiguous run along the fastest dimension at a time. 'index' walks the remaining dimensions.
+  const size_t rank = tDims.size();
+  const size_t runLength = tupleCount[0];
+  std::vector<size_t> index(rank, 0);
+  size_t destTuple = 0;
+  while(destTuple < numTuples)
+  {
+    size_t srcTuple = 0;
+    for(size_t d = rank; d-- > 0;)
+    {
+      srcTuple = srcTuple * tDims[d] + tupleStart[d] + index[d];
+    }
+    if(!dest->copyFromArray(destTuple, source, srcTuple, runLength))
+    {
+      return IDataArray::NullPointer();
+    }
+    destTuple += runLength;
+    for(size_t d = 1; d < rank; d++)
+    {
+      if(++index[d] < tupleCount[d])
+      {
+        break;
+      }
+      index[d] = 0;
+    }
+  }
+  return dest;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -198,6 +348,14 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
 //
 // -----------------------------------------------------------------------------
 IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly)
+{
+  return ReadIDataArray(gid, name, std::vector<size_t>(), std::vector<size_t>(), metaDataOnly);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString& name, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount, bool metaDataOnly)
 {
 
   herr_t err = -1;
@@ -233,18 +391,17 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
     {
       return ptr;
     }
+    if(!tupleCount.empty() && !IsValidTupleSubset(tDims, tupleStart, tupleCount))
+    {
+      qDebug() << "Tuple subset does not fit inside the tuple dimensions of " << name;
+      H5Tclose(typeId);
+      return ptr;
+    }
 
     // Check to see if we are reading a bool array and if so read it and return
     if(classType.compare("DataArray<bool>") == 0)
     {
-      if(!metaDataOnly)
-      {
-        ptr = Detail::readH5Dataset<bool>(gid, name, tDims, cDims);
-      }
-      else
-      {
-        ptr = DataArray<bool>::CreateArray(tDims, cDims, name, false);
-      }
+      ptr = Detail::readH5Dataset<bool>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       err = H5Tclose(typeId);
       return ptr; // <== Note early return here.
     }
@@ -258,91 +415,35 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       // qDebug() << "User Meta Data Type is Integer" ;
       if((H5Tequal(typeId, H5T_STD_U8BE) != 0) || (H5Tequal(typeId, H5T_STD_U8LE) != 0))
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<uint8_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<uint8_t>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<uint8_t>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else if((H5Tequal(typeId, H5T_STD_U16BE) != 0) || (H5Tequal(typeId, H5T_STD_U16LE) != 0))
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<uint16_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<uint16_t>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<uint16_t>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else if((H5Tequal(typeId, H5T_STD_U32BE) != 0) || (H5Tequal(typeId, H5T_STD_U32LE) != 0))
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<uint32_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<uint32_t>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<uint32_t>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else if((H5Tequal(typeId, H5T_STD_U64BE) != 0) || (H5Tequal(typeId, H5T_STD_U64LE) != 0))
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<uint64_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<uint64_t>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<uint64_t>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else if((H5Tequal(typeId, H5T_STD_I8BE) != 0) || (H5Tequal(typeId, H5T_STD_I8LE) != 0))
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<int8_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<int8_t>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<int8_t>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else if((H5Tequal(typeId, H5T_STD_I16BE) != 0) || (H5Tequal(typeId, H5T_STD_I16LE) != 0))
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<int16_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<int16_t>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<int16_t>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else if((H5Tequal(typeId, H5T_STD_I32BE) != 0) || (H5Tequal(typeId, H5T_STD_I32LE) != 0))
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<int32_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<int32_t>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<int32_t>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else if((H5Tequal(typeId, H5T_STD_I64BE) != 0) || (H5Tequal(typeId, H5T_STD_I64LE) != 0))
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<int64_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<int64_t>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<int64_t>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else
       {
@@ -353,25 +454,11 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
     case H5T_FLOAT:
       if(attr_size == 4)
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<float>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<float>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<float>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else if(attr_size == 8)
       {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<double>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<double>::CreateArray(tDims, cDims, name, false);
-        }
+        ptr = Detail::readH5Dataset<double>(gid, name, tDims, tupleStart, tupleCount, cDims, metaDataOnly);
       }
       else
       {
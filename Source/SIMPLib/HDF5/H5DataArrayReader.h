@@ -38,6 +38,7 @@
 #include <hdf5.h>
 
 #include <memory>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -77,6 +78,38 @@ public:
    */
   static IDataArrayShPtrType ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+  /**
+   * @brief ReadIDataArray Reads a box of tuples of an IDataArray subclass from the HDF5 file using a hyperslab
+   * selection so that only the selected tuples are read from disk. All components of each tuple are read.
+   * @param gid The HDF5 Group to read the data array from
+   * @param name The name of the data set
+   * @param tupleStart The first tuple along each tuple dimension (XYZ order). An empty vector reads the whole array.
+   * @param tupleCount The number of tuples along each tuple dimension (XYZ order). An empty vector reads the whole array.
+   * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+   * @return
+   */
+  static IDataArrayShPtrType ReadIDataArray(hid_t gid, const QString& name, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount, bool metaDataOnly = false);
+
+  /**
+   * @brief IsValidTupleSubset Returns true if the box described by tupleStart and tupleCount lies inside tDims
+   * @param tDims The Tuple Dimensions of the data array
+   * @param tupleStart The first tuple along each tuple dimension
+   * @param tupleCount The number of tuples along each tuple dimension
+   * @return
+   */
+  static bool IsValidTupleSubset(const std::vector<size_t>& tDims, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount);
+
+  /**
+   * @brief ExtractTupleSubset Copies a box of tuples out of an array that was read in full. This is used for the array
+   * types that can not be read with a hyperslab selection such as StringDataArray and NeighborList.
+   * @param source The fully read array
+   * @param tDims The Tuple Dimensions of the source array
+   * @param tupleStart The first tuple along each tuple dimension
+   * @param tupleCount The number of tuples along each tuple dimension
+   * @return The new array or a nullptr if the box does not fit inside tDims
+   */
+  static IDataArrayShPtrType ExtractTupleSubset(const IDataArrayShPtrType& source, const std::vector<size_t>& tDims, const std::vector<size_t>& tupleStart, const std::vector<size_t>& tupleCount);
+
   /**
    * @brief ReadNeighborListData
    * @param gid The HDF5 Group to read the data array from
@@ -43,6 +43,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/HDF5/H5ChunkedDatasetWriter.h"
 //#include "SIMPLib/DataArrays/DataArray.hpp"
 
 /**
@@ -167,9 +168,18 @@ public:
       h5Dims[i + tDims.size()] = cDims[i];
     }
 #endif
-    if(QH5Lite::datasetExists(gid, dataArray->getName()) == false)
+    const H5ChunkedDatasetWriter::Options& storageOptions = H5ChunkedDatasetWriter::CurrentOptions();
+    if(QH5Lite::datasetExists(gid, dataArray->getName()) == false && storageOptions.isEnabled())
     {
-      err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+      err = H5ChunkedDatasetWriter::WriteDataset(gid, dataArray->getName(), static_cast<int>(h5Rank), h5Dims.data(), dataArray->getConstPointer(0), cDims.size(), storageOptions);
+      if(err < 0)
+      {
+        return err;
+      }
+    }
+    else if(QH5Lite::datasetExists(gid, dataArray->getName()) == false)
+    {
+      err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getConstPointer(0));
       if(err < 0)
       {
         return err;
@@ -177,7 +187,7 @@ public:
     }
     else
     {
-      err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+      err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getConstPointer(0));
       if(err < 0)
       {
         return err;
@@ -3,6 +3,7 @@ set(SUBDIR_NAME HDF5)
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/HDF5/H5BoundaryStatsDataDelegate.h
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5ChunkedDatasetWriter.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayReader.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayWriter.hpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5Macros.h
@@ -17,6 +18,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/HDF5/H5BoundaryStatsDataDelegate.cpp
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5ChunkedDatasetWriter.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayReader.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5MatrixStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrecipitateStatsDataDelegate.cpp
@@ -35,9 +35,295 @@
 
 #include "RadialDistributionFunction.h"
 
+#include <algorithm>
 #include <cmath>
+#include <mutex>
+
+#include <QtCore/QDateTime>
 
 #include "SIMPLib/Math/SIMPLibRandom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+constexpr size_t k_PointsPerChunk = 4096;
+
+/**
+ * @brief The Histogram struct holds the binning parameters shared by all threads
+ */
+struct Histogram
+{
+  float minDistance = 0.0f;
+  float stepSize = 1.0f;
+  size_t lastBin = 0;
+
+  /**
+   * @brief Returns the bin of a distance. Distances below minDistance go into bin 0.
+   */
+  size_t binOf(float distance) const
+  {
+    if(distance < minDistance)
+    {
+      return 0;
+    }
+    return std::min(static_cast<size_t>((distance - minDistance) / stepSize) + 1, lastBin);
+  }
+};
+
+/**
+ * @brief Mixes the seed and the chunk index into the seed of the chunk's generator
+ */
+unsigned long chunkSeed(uint64_t seed, size_t chunk)
+{
+  uint64_t z = seed + (static_cast<uint64_t>(chunk) + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z = z ^ (z >> 31);
+  return static_cast<unsigned long>(z & 0xFFFFFFFFULL);
+}
+
+/**
+ * @brief Places the random points of a range of chunks on the voxel grid of the box
+ */
+class GeneratePointsImpl
+{
+public:
+  GeneratePointsImpl(std::vector<float>* points, size_t numPoints, uint64_t seed, const std::array<size_t, 3>& voxels, const std::array<float, 3>& boxres)
+  : m_Points(points)
+  , m_NumPoints(numPoints)
+  , m_Seed(seed)
+  , m_Voxels(voxels)
+  , m_BoxRes(boxres)
+  {
+  }
+  GeneratePointsImpl(const GeneratePointsImpl&) = default;
+  GeneratePointsImpl(GeneratePointsImpl&&) = default;
+  GeneratePointsImpl& operator=(const GeneratePointsImpl&) = delete;
+  GeneratePointsImpl& operator=(GeneratePointsImpl&&) = delete;
+  ~GeneratePointsImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const size_t totalPoints = m_Voxels[0] * m_Voxels[1] * m_Voxels[2];
+    float* points = m_Points->data();
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      SIMPLibRandom rg;
+      rg.init_genrand(chunkSeed(m_Seed, chunk));
+
+      const size_t end = std::min((chunk + 1) * k_PointsPerChunk, m_NumPoints);
+      for(size_t i = chunk * k_PointsPerChunk; i < end; i++)
+      {
+        size_t featureOwnerIdx = std::min(static_cast<size_t>(rg.genrand_res53() * totalPoints), totalPoints - 1);
+
+        size_t column = featureOwnerIdx % m_Voxels[0];
+        size_t row = (featureOwnerIdx / m_Voxels[0]) % m_Voxels[1];
+        size_t plane = featureOwnerIdx / (m_Voxels[0] * m_Voxels[1]);
+
+        points[3 * i] = static_cast<float>(column * m_BoxRes[0]);
+        points[3 * i + 1] = static_cast<float>(row * m_BoxRes[1]);
+        points[3 * i + 2] = static_cast<float>(plane * m_BoxRes[2]);
+      }
+    }
+  }
+
+private:
+  std::vector<float>* m_Points = nullptr;
+  size_t m_NumPoints = 0;
+  uint64_t m_Seed = 0;
+  std::array<size_t, 3> m_Voxels = {1, 1, 1};
+  std::array<float, 3> m_BoxRes = {1.0f, 1.0f, 1.0f};
+};
+
+/**
+ * @brief Bins the distances from each point in a range to every point after it. Each call fills its
+ * own histogram and adds it to the shared one when it is done.
+ */
+class BinAllPairsImpl
+{
+public:
+  BinAllPairsImpl(const std::vector<float>* points, const Histogram& histogram, std::vector<uint64_t>* counts, std::mutex* mutex)
+  : m_Points(points)
+  , m_Histogram(histogram)
+  , m_Counts(counts)
+  , m_Mutex(mutex)
+  {
+  }
+  BinAllPairsImpl(const BinAllPairsImpl&) = default;
+  BinAllPairsImpl(BinAllPairsImpl&&) = default;
+  BinAllPairsImpl& operator=(const BinAllPairsImpl&) = delete;
+  BinAllPairsImpl& operator=(BinAllPairsImpl&&) = delete;
+  ~BinAllPairsImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::vector<uint64_t> counts(m_Counts->size(), 0);
+    const float* points = m_Points->data();
+    const size_t numPoints = m_Points->size() / 3;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const float x = points[3 * i];
+      const float y = points[3 * i + 1];
+      const float z = points[3 * i + 2];
+      for(size_t j = i + 1; j < numPoints; j++)
+      {
+        const float dx = x - points[3 * j];
+        const float dy = y - points[3 * j + 1];
+        const float dz = z - points[3 * j + 2];
+        counts[m_Histogram.binOf(sqrtf(dx * dx + dy * dy + dz * dz))]++;
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(*m_Mutex);
+    for(size_t b = 0; b < counts.size(); b++)
+    {
+      (*m_Counts)[b] += counts[b];
+    }
+  }
+
+private:
+  const std::vector<float>* m_Points = nullptr;
+  Histogram m_Histogram;
+  std::vector<uint64_t>* m_Counts = nullptr;
+  std::mutex* m_Mutex = nullptr;
+};
+
+/**
+ * @brief Bins the pairs closer than the cutoff by comparing the points of each grid cell in a range
+ * with the points of the same cell and of the neighboring cells that come after it
+ */
+class BinCellPairsImpl
+{
+public:
+  BinCellPairsImpl(const std::vector<float>* sortedPoints, const std::vector<size_t>* cellStarts, const std::array<size_t, 3>& cells, float cutoff, const Histogram& histogram,
+                   std::vector<uint64_t>* counts, std::mutex* mutex)
+  : m_SortedPoints(sortedPoints)
+  , m_CellStarts(cellStarts)
+  , m_Cells(cells)
+  , m_Cutoff(cutoff)
+  , m_Histogram(histogram)
+  , m_Counts(counts)
+  , m_Mutex(mutex)
+  {
+  }
+  BinCellPairsImpl(const BinCellPairsImpl&) = default;
+  BinCellPairsImpl(BinCellPairsImpl&&) = default;
+  BinCellPairsImpl& operator=(const BinCellPairsImpl&) = delete;
+  BinCellPairsImpl& operator=(BinCellPairsImpl&&) = delete;
+  ~BinCellPairsImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::vector<uint64_t> counts(m_Counts->size(), 0);
+    const float* points = m_SortedPoints->data();
+    const std::vector<size_t>& cellStarts = *m_CellStarts;
+    const float cutoffSquared = m_Cutoff * m_Cutoff;
+
+    for(size_t cell = range.min(); cell < range.max(); cell++)
+    {
+      const size_t cx = cell % m_Cells[0];
+      const size_t cy = (cell / m_Cells[0]) % m_Cells[1];
+      const size_t cz = cell / (m_Cells[0] * m_Cells[1]);
+
+      for(size_t nz = (cz > 0 ? cz - 1 : 0); nz <= std::min(cz + 1, m_Cells[2] - 1); nz++)
+      {
+        for(size_t ny = (cy > 0 ? cy - 1 : 0); ny <= std::min(cy + 1, m_Cells[1] - 1); ny++)
+        {
+          for(size_t nx = (cx > 0 ? cx - 1 : 0); nx <= std::min(cx + 1, m_Cells[0] - 1); nx++)
+          {
+            const size_t neighbor = (nz * m_Cells[1] + ny) * m_Cells[0] + nx;
+            // Every pair of cells is visited once, from the cell with the lower index
+            if(neighbor < cell)
+            {
+              continue;
+            }
+            for(size_t i = cellStarts[cell]; i < cellStarts[cell + 1]; i++)
+            {
+              const float x = points[3 * i];
+              const float y = points[3 * i + 1];
+              const float z = points[3 * i + 2];
+              const size_t first = (neighbor == cell) ? i + 1 : cellStarts[neighbor];
+              for(size_t j = first; j < cellStarts[neighbor + 1]; j++)
+              {
+                const float dx = x - points[3 * j];
+                const float dy = y - points[3 * j + 1];
+                const float dz = z - points[3 * j + 2];
+                const float distanceSquared = dx * dx + dy * dy + dz * dz;
+                if(distanceSquared < cutoffSquared)
+                {
+                  counts[m_Histogram.binOf(sqrtf(distanceSquared))]++;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(*m_Mutex);
+    for(size_t b = 0; b < counts.size(); b++)
+    {
+      (*m_Counts)[b] += counts[b];
+    }
+  }
+
+private:
+  const std::vector<float>* m_SortedPoints = nullptr;
+  const std::vector<size_t>* m_CellStarts = nullptr;
+  std::array<size_t, 3> m_Cells = {1, 1, 1};
+  float m_Cutoff = 0.0f;
+  Histogram m_Histogram;
+  std::vector<uint64_t>* m_Counts = nullptr;
+  std::mutex* m_Mutex = nullptr;
+};
+
+/**
+ * @brief Bins the pairs closer than the cutoff. The points are sorted into a grid of cells at least
+ * cutoff wide so only points in the same or in neighboring cells have to be compared.
+ */
+void binPairsWithinCutoff(const std::vector<float>& points, const std::array<float, 3>& boxdims, float cutoff, const Histogram& histogram, std::vector<uint64_t>& counts)
+{
+  const size_t numPoints = points.size() / 3;
+  // Cells wider than the cutoff are still correct, so their number is capped to keep the grid small
+  const size_t maxCellsPerDim = std::max<size_t>(static_cast<size_t>(std::cbrt(static_cast<double>(numPoints))) * 2, 1);
+  std::array<size_t, 3> cells = {1, 1, 1};
+  for(size_t d = 0; d < 3; d++)
+  {
+    cells[d] = std::clamp<size_t>(static_cast<size_t>(boxdims[d] / cutoff), 1, maxCellsPerDim);
+  }
+  const size_t numCells = cells[0] * cells[1] * cells[2];
+
+  // Counting sort of the points by cell
+  std::vector<size_t> pointCells(numPoints, 0);
+  std::vector<size_t> cellStarts(numCells + 1, 0);
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    size_t index[3] = {0, 0, 0};
+    for(size_t d = 0; d < 3; d++)
+    {
+      index[d] = std::min(static_cast<size_t>(points[3 * i + d] / boxdims[d] * cells[d]), cells[d] - 1);
+    }
+    pointCells[i] = (index[2] * cells[1] + index[1]) * cells[0] + index[0];
+    cellStarts[pointCells[i] + 1]++;
+  }
+  for(size_t c = 0; c < numCells; c++)
+  {
+    cellStarts[c + 1] += cellStarts[c];
+  }
+  std::vector<size_t> nextSlot(cellStarts.begin(), cellStarts.end() - 1);
+  std::vector<float> sortedPoints(points.size());
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    size_t slot = nextSlot[pointCells[i]]++;
+    std::copy(points.begin() + 3 * i, points.begin() + 3 * i + 3, sortedPoints.begin() + 3 * slot);
+  }
+
+  std::mutex mutex;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numCells);
+  dataAlg.execute(BinCellPairsImpl(&sortedPoints, &cellStarts, cells, cutoff, histogram, &counts, &mutex));
+}
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -54,103 +340,68 @@ RadialDistributionFunction::~RadialDistributionFunction() = default;
 // -----------------------------------------------------------------------------
 std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::array<float, 3>& boxdims, std::array<float, 3>& boxres)
 {
-  std::vector<float> freq(numBins, 0);
-  std::vector<float> randomCentroids;
-  std::vector<std::vector<float>> distancelist;
-  size_t largeNumber = 1000;
-  size_t numDistances = largeNumber * (largeNumber - 1);
+  const uint64_t seed = static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch());
+  return GenerateRandomDistribution(minDistance, maxDistance, numBins, boxdims, boxres, 1000, seed, false);
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, const std::array<float, 3>& boxdims, const std::array<float, 3>& boxres,
+                                                                          size_t numPoints, uint64_t seed, bool limitToMaxDistance)
+{
   // boxdims are the dimensions of the box in microns
   // boxres is the resoultion of the box in microns
-  size_t xpoints = static_cast<size_t>(boxdims[0] / boxres[0]);
-  size_t ypoints = static_cast<size_t>(boxdims[1] / boxres[1]);
-  size_t zpoints = static_cast<size_t>(boxdims[2] / boxres[2]);
-
-  size_t totalpoints = xpoints * ypoints * zpoints;
-
-  float x, y, z;
-  float xn, yn, zn;
-  float xc, yc, zc;
-  float r;
+  std::array<size_t, 3> voxels = {0, 0, 0};
+  for(size_t d = 0; d < 3; d++)
+  {
+    voxels[d] = (boxres[d] > 0.0f) ? static_cast<size_t>(boxdims[d] / boxres[d]) : 0;
+  }
+  const size_t totalpoints = voxels[0] * voxels[1] * voxels[2];
 
-  size_t featureOwnerIdx = 0;
-  size_t column, row, plane;
+  const float stepsize = (maxDistance - minDistance) / static_cast<float>(numBins);
+  if(numBins <= 0 || !(stepsize > 0.0f) || totalpoints == 0 || numPoints < 2)
+  {
+    return std::vector<float>();
+  }
 
-  float stepsize = (maxDistance - minDistance) / numBins;
   float maxBoxDistance = sqrtf((boxdims[0] * boxdims[0]) + (boxdims[1] * boxdims[1]) + (boxdims[2] * boxdims[2]));
   size_t current_num_bins = static_cast<size_t>(ceil((maxBoxDistance - minDistance) / stepsize));
 
-  freq.resize(static_cast<size_t>(current_num_bins + 1));
-
-  SIMPL_RANDOMNG_NEW();
-
-  randomCentroids.resize(largeNumber * 3);
+  Histogram histogram;
+  histogram.minDistance = minDistance;
+  histogram.stepSize = stepsize;
+  histogram.lastBin = current_num_bins;
 
   // Generating all of the random points and storing their coordinates in randomCentroids
-  for(size_t i = 0; i < largeNumber; i++)
+  std::vector<float> randomCentroids(numPoints * 3);
   {
-    featureOwnerIdx = static_cast<size_t>(rg.genrand_res53() * totalpoints);
-
-    column = featureOwnerIdx % xpoints;
-    row = (featureOwnerIdx / xpoints) % ypoints;
-    plane = featureOwnerIdx / (xpoints * ypoints);
-
-    xc = static_cast<float>(column * boxres[0]);
-    yc = static_cast<float>(row * boxres[1]);
-    zc = static_cast<float>(plane * boxres[2]);
-
-    randomCentroids[3 * i] = xc;
-    randomCentroids[3 * i + 1] = yc;
-    randomCentroids[3 * i + 2] = zc;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, (numPoints + k_PointsPerChunk - 1) / k_PointsPerChunk);
+    dataAlg.execute(GeneratePointsImpl(&randomCentroids, numPoints, seed, voxels, boxres));
   }
 
-  distancelist.resize(largeNumber);
-
-  // Calculating all of the distances and storing them in the distance list
-  for(size_t i = 1; i < largeNumber; i++)
+  // Bin up the distance of every pair of points. The counts are integers so the result does not
+  // depend on the order the threads add them in.
+  std::vector<uint64_t> counts(current_num_bins + 1, 0);
+  if(limitToMaxDistance && maxDistance > 0.0f)
   {
-
-    x = randomCentroids[3 * i];
-    y = randomCentroids[3 * i + 1];
-    z = randomCentroids[3 * i + 2];
-
-    for(size_t j = i + 1; j < largeNumber; j++)
-    {
-
-      xn = randomCentroids[3 * j];
-      yn = randomCentroids[3 * j + 1];
-      zn = randomCentroids[3 * j + 2];
-
-      r = sqrtf((x - xn) * (x - xn) + (y - yn) * (y - yn) + (z - zn) * (z - zn));
-
-      distancelist[i].push_back(r);
-      distancelist[j].push_back(r);
-    }
+    binPairsWithinCutoff(randomCentroids, boxdims, maxDistance, histogram, counts);
   }
-
-  // bin up the distance list
-  for(size_t i = 0; i < largeNumber; i++)
+  else
   {
-    for(size_t j = 0; j < distancelist[i].size(); j++)
-    {
-      float distance = distancelist[i][j];
-      size_t bin = static_cast<size_t>((distance - minDistance) / stepsize);
-
-      if(distance < minDistance)
-      {
-        freq[0]++;
-      }
-      else
-      {
-        freq[bin + 1]++;
-      }
-    }
+    std::mutex mutex;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numPoints);
+    dataAlg.execute(BinAllPairsImpl(&randomCentroids, histogram, &counts, &mutex));
   }
 
-  // Normalize the frequencies
+  // Normalize the frequencies by the number of pairs
+  const double numDistances = static_cast<double>(numPoints) * static_cast<double>(numPoints - 1) / 2.0;
+  std::vector<float> freq(current_num_bins + 1, 0.0f);
   for(size_t i = 0; i < current_num_bins + 1; i++)
   {
-    freq[i] = freq[i] / (numDistances);
+    freq[i] = static_cast<float>(static_cast<double>(counts[i]) / numDistances);
   }
 
   return freq;
@@ -51,7 +51,7 @@ public:
 
   /**
    * @brief GenerateRandomDistribution This will generate a random distribution
-   * binned up and normalized.
+   * binned up and normalized. A sample of 1000 points seeded from the clock is used.
    * @param minDistance The minimum distance between objects
    * @param maxDistance The maximum distance between objects
    * @param numBins The number of bins to generate
@@ -61,6 +61,25 @@ public:
    */
   static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::array<float, 3>& boxdims, std::array<float, 3>& boxres);
 
+  /**
+   * @brief GenerateRandomDistribution This will generate a random distribution from a sample of
+   * numPoints random points, binned up and normalized by the number of point pairs. The points are
+   * generated in fixed size chunks that each have their own generator, so the same seed always gives
+   * the same result no matter how many threads do the work.
+   * @param minDistance The minimum distance between objects
+   * @param maxDistance The maximum distance between objects
+   * @param numBins The number of bins to generate
+   * @param boxdims
+   * @param boxres
+   * @param numPoints The number of random points
+   * @param seed The seed for the random points
+   * @param limitToMaxDistance Only bin pairs closer than maxDistance. The pairs are found with a grid of
+   * cells maxDistance wide instead of comparing every pair, and the bins past maxDistance stay 0.
+   * @return An array of values that are the frequency values for the histogram
+   */
+  static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, const std::array<float, 3>& boxdims, const std::array<float, 3>& boxres, size_t numPoints,
+                                                       uint64_t seed, bool limitToMaxDistance = false);
+
 protected:
   RadialDistributionFunction();
 
@@ -0,0 +1,131 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+#include "SIMPLib/Math/RadialDistributionFunction.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class RadialDistributionFunctionTest
+{
+
+public:
+  RadialDistributionFunctionTest() = default;
+
+  virtual ~RadialDistributionFunctionTest() = default;
+
+  const float k_MinDistance = 8.0f;
+  const float k_MaxDistance = 93.0f;
+  const int k_NumBins = 55;
+  const std::array<float, 3> k_BoxDims = {{98.0f, 98.0f, 98.0f}};
+  const std::array<float, 3> k_BoxRes = {{0.1f, 0.1f, 0.1f}};
+  const size_t k_NumPoints = 3000;
+  const uint64_t k_Seed = 5489;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSeededDistribution()
+  {
+    std::vector<float> first = RadialDistributionFunction::GenerateRandomDistribution(k_MinDistance, k_MaxDistance, k_NumBins, k_BoxDims, k_BoxRes, k_NumPoints, k_Seed);
+    std::vector<float> second = RadialDistributionFunction::GenerateRandomDistribution(k_MinDistance, k_MaxDistance, k_NumBins, k_BoxDims, k_BoxRes, k_NumPoints, k_Seed);
+
+    DREAM3D_REQUIRE(!first.empty())
+    DREAM3D_REQUIRE_EQUAL(first.size(), second.size())
+    for(size_t i = 0; i < first.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(first[i], second[i])
+    }
+
+    // Every unique pair lands in exactly one bin so the frequencies sum to 1
+    double sum = std::accumulate(first.begin(), first.end(), 0.0);
+    DREAM3D_REQUIRE(std::fabs(sum - 1.0) < 1.0E-4)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCutoffDistribution()
+  {
+    std::vector<float> allPairs = RadialDistributionFunction::GenerateRandomDistribution(k_MinDistance, k_MaxDistance, k_NumBins, k_BoxDims, k_BoxRes, k_NumPoints, k_Seed);
+    std::vector<float> cutoff = RadialDistributionFunction::GenerateRandomDistribution(k_MinDistance, k_MaxDistance, k_NumBins, k_BoxDims, k_BoxRes, k_NumPoints, k_Seed, true);
+
+    DREAM3D_REQUIRE_EQUAL(allPairs.size(), cutoff.size())
+    // Bins inside the cutoff see exactly the same pairs
+    for(int i = 0; i < k_NumBins; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(allPairs[i] - cutoff[i]) < 1.0E-6f)
+    }
+    // Pairs further apart than the cutoff are never visited
+    for(size_t i = k_NumBins + 1; i < cutoff.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(cutoff[i], 0.0f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInvalidInput()
+  {
+    std::vector<float> freq = RadialDistributionFunction::GenerateRandomDistribution(k_MinDistance, k_MaxDistance, 0, k_BoxDims, k_BoxRes, k_NumPoints, k_Seed);
+    DREAM3D_REQUIRE(freq.empty())
+
+    freq = RadialDistributionFunction::GenerateRandomDistribution(k_MaxDistance, k_MinDistance, k_NumBins, k_BoxDims, k_BoxRes, k_NumPoints, k_Seed);
+    DREAM3D_REQUIRE(freq.empty())
+
+    freq = RadialDistributionFunction::GenerateRandomDistribution(k_MinDistance, k_MaxDistance, k_NumBins, k_BoxDims, k_BoxRes, 1, k_Seed);
+    DREAM3D_REQUIRE(freq.empty())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### RadialDistributionFunctionTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestSeededDistribution())
+    DREAM3D_REGISTER_TEST(TestCutoffDistribution())
+    DREAM3D_REGISTER_TEST(TestInvalidInput())
+  }
+
+private:
+  RadialDistributionFunctionTest(const RadialDistributionFunctionTest&); // Copy Constructor Not Implemented
+  void operator=(const RadialDistributionFunctionTest&);                 // Move assignment Not Implemented
+};
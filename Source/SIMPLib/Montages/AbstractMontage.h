@@ -95,7 +95,7 @@ public:
    * @brief Returns a QStringList of the DataContainer names in the montage.
    * @return
    */
-  QStringList getDataContainerNames() const;
+  virtual QStringList getDataContainerNames() const;
 
   /**
    * @brief Returns a vector of DataArrayPaths for the Montage.
@@ -119,11 +119,12 @@ public:
   /**
    * @brief Creates and returns a copy of the montage with all DataContainer references
    * updated to the provided DataContainerArray.  If a DataContainer cannot be found,
-   * it is set to nullptr.
+   * it is set to nullptr. Copies made without values set forceNoAllocate.
    * @param dca
+   * @param forceNoAllocate
    * @return
    */
-  virtual Pointer propagate(const DataContainerArrayShPtr& dca) const = 0;
+  virtual Pointer propagate(const DataContainerArrayShPtr& dca, bool forceNoAllocate = false) const = 0;
 
   /**
    * @brief Write the montage to an HDF5 file.
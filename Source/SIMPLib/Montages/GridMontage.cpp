@@ -32,18 +32,230 @@
 
 #include "GridMontage.h"
 
+#include <algorithm>
+#include <iterator>
+#include <list>
 #include <memory>
 #include <typeinfo>
 
+#include <QtCore/QHash>
+
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Geometry/IGeometry3D.h"
 #include "SIMPLib/Geometry/IGeometryGrid.h"
 #include "SIMPLib/Utilities/ToolTipGenerator.h"
 
+/**
+ * @brief The LazyTiles struct holds the tile names, loader and least recently used
+ * ordering of a lazily loaded GridMontage.
+ */
+struct GridMontage::LazyTiles
+{
+  LazyTiles(const std::vector<QString>& dcNames, const TileLoaderType& tileLoader, size_t budget)
+  : loader(tileLoader)
+  , names(dcNames)
+  , memoryBudget(budget)
+  , recentPositions(dcNames.size(), recentlyUsed.end())
+  , tileSizes(dcNames.size(), 0)
+  , loaded(dcNames.size(), false)
+  , pinned(dcNames.size(), false)
+  , stamps(dcNames.size(), 0)
+  {
+    for(size_t i = 0; i < names.size(); i++)
+    {
+      if(!names[i].isEmpty() && !nameOffsets.contains(names[i]))
+      {
+        nameOffsets.insert(names[i], i);
+      }
+    }
+  }
+
+  LazyTiles(const LazyTiles& other)
+  : loader(other.loader)
+  , names(other.names)
+  , nameOffsets(other.nameOffsets)
+  , memoryBudget(other.memoryBudget)
+  , memorySize(other.memorySize)
+  , recentPositions(other.names.size(), recentlyUsed.end())
+  , tileSizes(other.tileSizes)
+  , loaded(other.loaded)
+  , pinned(other.pinned)
+  , stamps(other.stamps)
+  {
+    // List iterators cannot be copied between lists so the positions are rebuilt
+    for(size_t offset : other.recentlyUsed)
+    {
+      recentlyUsed.push_back(offset);
+      recentPositions[offset] = std::prev(recentlyUsed.end());
+    }
+  }
+
+  ~LazyTiles() = default;
+
+  LazyTiles(LazyTiles&&) = delete;                 // Move Constructor Not Implemented
+  LazyTiles& operator=(const LazyTiles&) = delete; // Copy Assignment Not Implemented
+  LazyTiles& operator=(LazyTiles&&) = delete;      // Move Assignment Not Implemented
+
+  TileLoaderType loader;
+  std::vector<QString> names;
+  QHash<QString, size_t> nameOffsets;
+  size_t memoryBudget = 0;
+  size_t memorySize = 0;
+  std::list<size_t> recentlyUsed; // Loaded tiles that may be released, most recently used first
+  std::vector<std::list<size_t>::iterator> recentPositions;
+  std::vector<size_t> tileSizes;
+  std::vector<bool> loaded;       // The tile holds its values instead of only its structure
+  std::vector<bool> pinned;       // Modified or assigned tiles cannot be read again and are never released
+  std::vector<size_t> stamps;     // Structure and write counts of each tile when it was read, used to find modified tiles
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t estimateDataContainerSize(const DataContainer& dc)
+{
+  size_t size = 0;
+  for(const auto& attrMat : dc)
+  {
+    for(const auto& array : *attrMat)
+    {
+      if(array->isAllocated())
+      {
+        size += array->getSize() * array->getTypeSize();
+      }
+    }
+  }
+  return size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void combineHash(size_t& seed, size_t value)
+{
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool computeTileStamp(const DataContainer& dc, size_t& stamp)
+{
+  stamp = 0;
+  IGeometry::Pointer geom = dc.getGeometry();
+  if(nullptr != geom)
+  {
+    combineHash(stamp, reinterpret_cast<size_t>(geom.get()));
+    combineHash(stamp, qHash(geom->getInfoString(SIMPL::HtmlFormat)));
+  }
+  for(const auto& attrMat : dc)
+  {
+    combineHash(stamp, reinterpret_cast<size_t>(attrMat.get()));
+    combineHash(stamp, attrMat->getNumberOfTuples());
+    for(const auto& array : *attrMat)
+    {
+      // Arrays that do not count their writes could change unnoticed
+      uint64_t writeCount = 0;
+      if(!array->getWriteCount(writeCount))
+      {
+        return false;
+      }
+      combineHash(stamp, reinterpret_cast<size_t>(array.get()));
+      combineHash(stamp, array->getSize());
+      combineHash(stamp, static_cast<size_t>(writeCount));
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool isTileInUse(const DataContainer& dc)
+{
+  // The DataContainer holds the only reference to each of its parts unless a caller still uses them
+  IGeometry::Pointer geom = dc.getGeometry();
+  if(nullptr != geom && geom.use_count() > 2)
+  {
+    return true;
+  }
+  for(const auto& attrMat : dc)
+  {
+    if(attrMat.use_count() > 1)
+    {
+      return true;
+    }
+    for(const auto& array : *attrMat)
+    {
+      if(array.use_count() > 1)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool hasTileValues(const DataContainer& dc)
+{
+  for(const auto& attrMat : dc)
+  {
+    for(const auto& array : *attrMat)
+    {
+      if(!array->isAllocated())
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void moveTileValues(DataContainer& tile, const DataContainer& loadedTile)
+{
+  tile.setGeometry(loadedTile.getGeometry());
+  // Each AttributeMatrix leaves the loaded DataContainer when it is added to the tile
+  const auto attrMatrices = loadedTile.getAttributeMatrices();
+  for(const auto& attrMat : attrMatrices)
+  {
+    tile.addOrReplaceAttributeMatrix(attrMat);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void releaseTileValues(DataContainer& tile)
+{
+  IGeometry::Pointer geom = tile.getGeometry();
+  if(nullptr != geom)
+  {
+    tile.setGeometry(geom->deepCopy(true));
+  }
+  // Replacing every AttributeMatrix in its current order keeps the order of the AttributeMatrices
+  const auto attrMatrices = tile.getAttributeMatrices();
+  for(const auto& attrMat : attrMatrices)
+  {
+    AttributeMatrix::Pointer structure = attrMat->deepCopy(true);
+    if(nullptr != structure)
+    {
+      tile.addOrReplaceAttributeMatrix(structure);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -84,12 +296,18 @@ bool GridMontage::isValid() const
     return false;
   }
 
+  std::lock_guard<std::mutex> lock(m_TileMutex);
   IGeometry::LengthUnit lengthUnit;
   IGeometry* geomType = nullptr;
   for(size_t i = 0; i < tileCount; i++)
   {
     if(nullptr == m_DataContainers[i])
     {
+      // Tiles that are not loaded yet only need a DataContainer to read
+      if(nullptr != m_LazyTiles && !m_LazyTiles->names[i].isEmpty())
+      {
+        continue;
+      }
       return false;
     }
     // Geometries Required
@@ -98,7 +316,7 @@ bool GridMontage::isValid() const
       return false;
     }
     // Identical length units and GeometryType required
-    if(i == 0)
+    if(nullptr == geomType)
     {
       lengthUnit = m_DataContainers[i]->getGeometry()->getUnits();
       geomType = m_DataContainers[i]->getGeometry().get();
@@ -161,15 +379,15 @@ size_t GridMontage::getTileCount() const
 // -----------------------------------------------------------------------------
 GridTileIndex GridMontage::getTileIndex(size_t row, size_t col, size_t depth) const
 {
-  if(row > m_Size[0])
+  if(row >= m_Size[0])
   {
     return GridTileIndex();
   }
-  if(col > m_Size[1])
+  if(col >= m_Size[1])
   {
     return GridTileIndex();
   }
-  if(depth > m_Size[2])
+  if(depth >= m_Size[2])
   {
     return GridTileIndex();
   }
@@ -183,27 +401,33 @@ GridTileIndex GridMontage::getTileIndex(size_t row, size_t col, size_t depth) co
 // -----------------------------------------------------------------------------
 GridTileIndex GridMontage::getTileIndexForDataContainer(const DataContainerShPtr& dc) const
 {
-  const size_t rowCount = getRowCount();
-  const size_t colCount = getColumnCount();
-  const size_t depthCount = getDepthCount();
+  if(nullptr == dc)
+  {
+    return GridTileIndex();
+  }
 
-  for(size_t row = 0; row < rowCount; row++)
+  size_t offset = 0;
   {
-    for(size_t col = 0; col < colCount; col++)
+    std::lock_guard<std::mutex> lock(m_TileMutex);
+    auto iter = m_TileOffsets.find(dc.get());
+    if(iter != m_TileOffsets.end())
     {
-      for(size_t depth = 0; depth < depthCount; depth++)
-      {
-        GridTileIndex index = getTileIndex(row, col, depth);
-        DataContainer::Pointer d = getDataContainer(index);
-        if(dc == d)
-        {
-          return index;
-        }
-      }
+      offset = iter->second;
+    }
+    else if(nullptr != m_LazyTiles && m_LazyTiles->nameOffsets.contains(dc->getName()))
+    {
+      // Released tiles are still found by the name they are read with
+      offset = m_LazyTiles->nameOffsets.value(dc->getName());
+    }
+    else
+    {
+      return GridTileIndex();
     }
   }
 
-  return GridTileIndex();
+  const size_t rowCount = getRowCount();
+  const size_t colCount = getColumnCount();
+  return getTileIndex(offset % rowCount, (offset / rowCount) % colCount, offset / (rowCount * colCount));
 }
 
 // -----------------------------------------------------------------------------
@@ -221,9 +445,29 @@ AbstractTileIndexShPtr GridMontage::getTileIndexFor(const DataContainerShPtr& dc
 // -----------------------------------------------------------------------------
 AbstractMontage::CollectionType GridMontage::getDataContainers() const
 {
+  std::lock_guard<std::mutex> lock(m_TileMutex);
   return m_DataContainers;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList GridMontage::getDataContainerNames() const
+{
+  if(nullptr == m_LazyTiles)
+  {
+    return AbstractMontage::getDataContainerNames();
+  }
+
+  std::lock_guard<std::mutex> lock(m_TileMutex);
+  QStringList dcNames;
+  for(size_t i = 0; i < m_DataContainers.size(); i++)
+  {
+    dcNames.push_back(getTileName(i));
+  }
+  return dcNames;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -235,10 +479,15 @@ DataContainer::Pointer GridMontage::getDataContainer(GridTileIndex index) const
   }
 
   size_t offset = getOffsetFromTileId(index.getTilePos());
+  std::unique_lock<std::mutex> lock(m_TileMutex);
   if(offset >= m_DataContainers.size())
   {
     return nullptr;
   }
+  if(nullptr != m_LazyTiles)
+  {
+    return loadTile(offset, lock);
+  }
   return m_DataContainers[offset];
 }
 
@@ -253,11 +502,37 @@ void GridMontage::setDataContainer(GridTileIndex index, const DataContainerShPtr
   }
 
   size_t offset = getOffsetFromTileId(index.getTilePos());
+  std::lock_guard<std::mutex> lock(m_TileMutex);
   if(offset >= m_DataContainers.size())
   {
     return;
   }
-  m_DataContainers[offset] = dc;
+  if(nullptr == m_LazyTiles)
+  {
+    assignTile(offset, dc);
+    return;
+  }
+
+  // The previous DataContainer is left as it is and the tile is looked up by its new name
+  forgetTile(offset);
+  LazyTiles& lazyTiles = *m_LazyTiles;
+  const QString oldName = lazyTiles.names[offset];
+  if(lazyTiles.nameOffsets.contains(oldName) && lazyTiles.nameOffsets.value(oldName) == offset)
+  {
+    lazyTiles.nameOffsets.remove(oldName);
+  }
+  lazyTiles.names[offset] = (nullptr == dc) ? QString() : dc->getName();
+  assignTile(offset, dc);
+  if(nullptr == dc)
+  {
+    return;
+  }
+  if(!lazyTiles.nameOffsets.contains(dc->getName()))
+  {
+    lazyTiles.nameOffsets.insert(dc->getName(), offset);
+  }
+  // An assigned DataContainer may differ from the one in the file so it is never released
+  insertLoadedTile(offset, true);
 }
 
 // -----------------------------------------------------------------------------
@@ -268,7 +543,7 @@ bool checkTileIdValid(GridMontage::TileIdType tileID, GridMontage::SizeType grid
   bool sizeCheck = true;
   for(size_t i = 0; i < 3; i++)
   {
-    sizeCheck &= tileID[i] <= gridSize[i];
+    sizeCheck &= tileID[i] < gridSize[i];
   }
 
   return sizeCheck;
@@ -303,11 +578,16 @@ size_t GridMontage::getOffsetFromTileId(TileIdType tileID) const
 // -----------------------------------------------------------------------------
 void GridMontage::resizeTileDims(size_t row, size_t col, size_t depth)
 {
+  std::lock_guard<std::mutex> lock(m_TileMutex);
   const SizeType oldSize = getGridSize();
   const CollectionType oldCollection = m_DataContainers;
+  const std::vector<QString> oldNames = (nullptr == m_LazyTiles) ? std::vector<QString>() : m_LazyTiles->names;
 
+  m_Size = SizeType(row, col, depth);
   m_DataContainers.resize(row * col * depth);
   std::fill(m_DataContainers.begin(), m_DataContainers.end(), nullptr);
+  std::vector<QString> newNames(oldNames.empty() ? 0 : m_DataContainers.size());
+  std::vector<size_t> newOffsets(oldCollection.size(), m_DataContainers.size());
 
   const SizeType newSize = getGridSize();
   for(size_t r = 0; r < oldSize[0]; r++)
@@ -322,10 +602,50 @@ void GridMontage::resizeTileDims(size_t row, size_t col, size_t depth)
           size_t oldOffset = getOffsetFromTileIdAndSize(oldId, oldSize);
           size_t newOffset = getOffsetFromTileId(oldId);
           m_DataContainers[newOffset] = oldCollection[oldOffset];
+          newOffsets[oldOffset] = newOffset;
+          if(!newNames.empty())
+          {
+            newNames[newOffset] = oldNames[oldOffset];
+          }
         }
       }
     }
   }
+
+  rebuildTileOffsets();
+  if(nullptr == m_LazyTiles)
+  {
+    return;
+  }
+
+  // Tiles that stay in the grid keep their values and their place in the usage order
+  const std::unique_ptr<LazyTiles> oldTiles = std::move(m_LazyTiles);
+  m_LazyTiles = std::make_unique<LazyTiles>(newNames, oldTiles->loader, oldTiles->memoryBudget);
+  m_TileGeneration++;
+  LazyTiles& lazyTiles = *m_LazyTiles;
+  for(size_t oldOffset = 0; oldOffset < newOffsets.size(); oldOffset++)
+  {
+    const size_t newOffset = newOffsets[oldOffset];
+    if(newOffset == m_DataContainers.size() || !oldTiles->loaded[oldOffset])
+    {
+      continue;
+    }
+    lazyTiles.loaded[newOffset] = true;
+    lazyTiles.pinned[newOffset] = oldTiles->pinned[oldOffset];
+    lazyTiles.stamps[newOffset] = oldTiles->stamps[oldOffset];
+    lazyTiles.tileSizes[newOffset] = oldTiles->tileSizes[oldOffset];
+    lazyTiles.memorySize += lazyTiles.tileSizes[newOffset];
+  }
+  for(size_t oldOffset : oldTiles->recentlyUsed)
+  {
+    const size_t newOffset = newOffsets[oldOffset];
+    if(newOffset != m_DataContainers.size())
+    {
+      lazyTiles.recentlyUsed.push_back(newOffset);
+      lazyTiles.recentPositions[newOffset] = std::prev(lazyTiles.recentlyUsed.end());
+    }
+  }
+  enforceMemoryBudget();
 }
 
 // -----------------------------------------------------------------------------
@@ -333,11 +653,43 @@ void GridMontage::resizeTileDims(size_t row, size_t col, size_t depth)
 // -----------------------------------------------------------------------------
 GridMontage::Pointer GridMontage::deepCopy() const
 {
-  Pointer ptr = Pointer(new GridMontage(getName(), getRowCount(), getColumnCount(), getDepthCount()));
-  const size_t tileCount = m_DataContainers.size();
+  Pointer ptr = copyTiles();
+  if(nullptr == ptr->m_LazyTiles)
+  {
+    return ptr;
+  }
+
+  // Lazily loaded tiles are filled and released in place so each copy needs its own DataContainers
+  std::lock_guard<std::mutex> lock(ptr->m_TileMutex);
+  const size_t tileCount = ptr->m_DataContainers.size();
   for(size_t i = 0; i < tileCount; i++)
   {
-    ptr->m_DataContainers[i] = m_DataContainers[i];
+    if(nullptr != ptr->m_DataContainers[i])
+    {
+      ptr->m_DataContainers[i] = ptr->m_DataContainers[i]->deepCopy(false);
+      // Unmodified tiles stay unmodified in the copy
+      if(ptr->m_LazyTiles->loaded[i] && !ptr->m_LazyTiles->pinned[i])
+      {
+        ptr->stampTile(i);
+      }
+    }
+  }
+  ptr->rebuildTileOffsets();
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+GridMontage::Pointer GridMontage::copyTiles() const
+{
+  Pointer ptr = Pointer(new GridMontage(getName(), getRowCount(), getColumnCount(), getDepthCount()));
+  std::lock_guard<std::mutex> lock(m_TileMutex);
+  ptr->m_DataContainers = m_DataContainers;
+  ptr->m_TileOffsets = m_TileOffsets;
+  if(nullptr != m_LazyTiles)
+  {
+    ptr->m_LazyTiles = std::make_unique<LazyTiles>(*m_LazyTiles);
   }
 
   return ptr;
@@ -346,20 +698,44 @@ GridMontage::Pointer GridMontage::deepCopy() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-AbstractMontage::Pointer GridMontage::propagate(const DataContainerArrayShPtr& dca) const
+AbstractMontage::Pointer GridMontage::propagate(const DataContainerArrayShPtr& dca, bool forceNoAllocate) const
 {
-  Pointer ptr = deepCopy();
+  Pointer ptr = copyTiles();
+  if(forceNoAllocate && nullptr != ptr->m_LazyTiles)
+  {
+    // Copies made without values never read tiles from the file
+    ptr->m_LazyTiles->loader = nullptr;
+  }
 
   // Use the DataContainer of the same name in the new DataContainerArray
-  const size_t tileCount = m_DataContainers.size();
+  std::lock_guard<std::mutex> lock(ptr->m_TileMutex);
+  const size_t tileCount = ptr->m_DataContainers.size();
   for(size_t i = 0; i < tileCount; i++)
   {
-    if(nullptr == m_DataContainers[i])
+    if(nullptr != ptr->m_LazyTiles)
     {
+      // Released tiles are looked up as well. The lookup must not read the tile from the file.
+      const QString dcName = ptr->getTileName(i);
+      DataContainerShPtr dc = dcName.isEmpty() ? nullptr : dca->getChildByName(dcName);
+      // Copies made without values only hold the structure of the tiles
+      if(forceNoAllocate || nullptr == dc || !hasTileValues(*dc))
+      {
+        ptr->forgetTile(i);
+      }
+      ptr->assignTile(i, dc);
+      if(ptr->m_LazyTiles->loaded[i] && !ptr->m_LazyTiles->pinned[i])
+      {
+        ptr->stampTile(i);
+      }
       continue;
     }
-    QString dcName = m_DataContainers[i]->getName();
-    ptr->m_DataContainers[i] = dca->getDataContainer(dcName);
+    if(nullptr == ptr->m_DataContainers[i])
+    {
+      continue;
+    }
+    QString dcName = ptr->m_DataContainers[i]->getName();
+    DataContainerShPtr dc = dca->getDataContainer(dcName);
+    ptr->assignTile(i, dc);
   }
 
   return ptr;
@@ -613,15 +989,11 @@ int GridMontage::writeH5Data(hid_t groupId) const
   // size_t count = static_cast<size_t>(m_DataContainers.size());
   QStringList dcNameList;
 
-  for(const auto& dc : m_DataContainers)
   {
-    if(nullptr == dc)
-    {
-      dcNameList << "";
-    }
-    else
+    std::lock_guard<std::mutex> lock(m_TileMutex);
+    for(size_t i = 0; i < m_DataContainers.size(); i++)
     {
-      dcNameList << dc->getName();
+      dcNameList << getTileName(i);
     }
   }
 
@@ -642,14 +1014,379 @@ int GridMontage::writeH5Data(hid_t groupId) const
 // -----------------------------------------------------------------------------
 bool GridMontage::setDataContainers(std::vector<DataContainerShPtr> dataContainers)
 {
+  std::lock_guard<std::mutex> lock(m_TileMutex);
   if(dataContainers.size() != m_DataContainers.size())
   {
     return false;
   }
+  m_LazyTiles.reset();
+  m_TileGeneration++;
   m_DataContainers = dataContainers;
+  rebuildTileOffsets();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool GridMontage::setLazyDataContainers(const std::vector<QString>& dcNames, const TileLoaderType& loader, size_t memoryBudget)
+{
+  std::lock_guard<std::mutex> lock(m_TileMutex);
+  if(dcNames.size() != m_DataContainers.size())
+  {
+    return false;
+  }
+  std::fill(m_DataContainers.begin(), m_DataContainers.end(), nullptr);
+  m_TileOffsets.clear();
+  m_LazyTiles = std::make_unique<LazyTiles>(dcNames, loader, memoryBudget);
+  m_TileGeneration++;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool GridMontage::setLazyDataContainers(const std::vector<DataContainerShPtr>& placeholders, const TileLoaderType& loader, size_t memoryBudget)
+{
+  std::lock_guard<std::mutex> lock(m_TileMutex);
+  if(placeholders.size() != m_DataContainers.size())
+  {
+    return false;
+  }
+  std::vector<QString> dcNames;
+  for(const auto& dc : placeholders)
+  {
+    dcNames.push_back((nullptr == dc) ? QString() : dc->getName());
+  }
+  m_DataContainers = placeholders;
+  rebuildTileOffsets();
+  m_LazyTiles = std::make_unique<LazyTiles>(dcNames, loader, memoryBudget);
+  m_TileGeneration++;
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool GridMontage::loadDataContainer(const DataContainerShPtr& dc) const
+{
+  if(nullptr == dc)
+  {
+    return false;
+  }
+
+  std::unique_lock<std::mutex> lock(m_TileMutex);
+  if(nullptr == m_LazyTiles)
+  {
+    return false;
+  }
+  auto iter = m_TileOffsets.find(dc.get());
+  if(iter == m_TileOffsets.end())
+  {
+    return false;
+  }
+  loadTile(iter->second, lock);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool GridMontage::isLazyLoading() const
+{
+  return nullptr != m_LazyTiles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool GridMontage::isTileLoaded(GridTileIndex index) const
+{
+  if(!index.isValid())
+  {
+    return false;
+  }
+
+  size_t offset = getOffsetFromTileId(index.getTilePos());
+  std::lock_guard<std::mutex> lock(m_TileMutex);
+  if(offset >= m_DataContainers.size())
+  {
+    return false;
+  }
+  if(nullptr != m_LazyTiles)
+  {
+    return m_LazyTiles->loaded[offset];
+  }
+  return nullptr != m_DataContainers[offset];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GridMontage::setMemoryBudget(size_t memoryBudget)
+{
+  std::lock_guard<std::mutex> lock(m_TileMutex);
+  if(nullptr == m_LazyTiles)
+  {
+    return;
+  }
+  m_LazyTiles->memoryBudget = memoryBudget;
+  enforceMemoryBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t GridMontage::getMemoryBudget() const
+{
+  std::lock_guard<std::mutex> lock(m_TileMutex);
+  return (nullptr == m_LazyTiles) ? 0 : m_LazyTiles->memoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t GridMontage::getLoadedMemorySize() const
+{
+  std::lock_guard<std::mutex> lock(m_TileMutex);
+  return (nullptr == m_LazyTiles) ? 0 : m_LazyTiles->memorySize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GridMontage::assignTile(size_t offset, const DataContainerShPtr& dc) const
+{
+  const DataContainerShPtr previous = m_DataContainers[offset];
+  if(previous == dc)
+  {
+    return;
+  }
+  m_DataContainers[offset] = dc;
+
+  if(nullptr != previous)
+  {
+    auto iter = m_TileOffsets.find(previous.get());
+    if(iter != m_TileOffsets.end() && iter->second == offset)
+    {
+      m_TileOffsets.erase(iter);
+      // The same DataContainer may still be used by another tile. Lazily loaded tiles fall back to their names instead.
+      auto other = (nullptr != m_LazyTiles) ? m_DataContainers.end() : std::find(m_DataContainers.begin(), m_DataContainers.end(), previous);
+      if(other != m_DataContainers.end())
+      {
+        m_TileOffsets.emplace(previous.get(), static_cast<size_t>(other - m_DataContainers.begin()));
+      }
+    }
+  }
+  if(nullptr != dc)
+  {
+    m_TileOffsets.emplace(dc.get(), offset);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GridMontage::rebuildTileOffsets() const
+{
+  m_TileOffsets.clear();
+  for(size_t i = 0; i < m_DataContainers.size(); i++)
+  {
+    if(nullptr != m_DataContainers[i])
+    {
+      m_TileOffsets.emplace(m_DataContainers[i].get(), i);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerShPtr GridMontage::loadTile(size_t offset, std::unique_lock<std::mutex>& lock) const
+{
+  LazyTiles& lazyTiles = *m_LazyTiles;
+  if(lazyTiles.loaded[offset])
+  {
+    touchTile(offset);
+    return m_DataContainers[offset];
+  }
+
+  const QString name = lazyTiles.names[offset];
+  const TileLoaderType loader = lazyTiles.loader;
+  const DataContainerShPtr tile = m_DataContainers[offset];
+  const size_t generation = m_TileGeneration;
+  if(name.isEmpty() || !loader)
+  {
+    return tile;
+  }
+
+  // The loader takes the HDF5 lock so it runs without the tile mutex. Otherwise a thread holding the
+  // HDF5 lock while it waits for the tile mutex would deadlock with this one.
+  lock.unlock();
+  DataContainerShPtr loadedTile = loader(name);
+  lock.lock();
+
+  // The montage may have changed or another caller may have read the tile in the meantime
+  if(generation != m_TileGeneration || m_DataContainers[offset] != tile || m_LazyTiles->names[offset] != name)
+  {
+    return m_DataContainers[offset];
+  }
+  if(m_LazyTiles->loaded[offset])
+  {
+    touchTile(offset);
+    return m_DataContainers[offset];
+  }
+  if(nullptr == loadedTile)
+  {
+    return tile;
+  }
+
+  // Placeholders keep their identity so the DataContainerArray and other callers see the values
+  if(nullptr == tile)
+  {
+    assignTile(offset, loadedTile);
+  }
+  else
+  {
+    moveTileValues(*tile, *loadedTile);
+  }
+  // Tiles that cannot be stamped are never released since their changes could not be found
+  insertLoadedTile(offset, !stampTile(offset));
+  return m_DataContainers[offset];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GridMontage::touchTile(size_t offset) const
+{
+  LazyTiles& lazyTiles = *m_LazyTiles;
+  if(lazyTiles.recentPositions[offset] != lazyTiles.recentlyUsed.end())
+  {
+    lazyTiles.recentlyUsed.splice(lazyTiles.recentlyUsed.begin(), lazyTiles.recentlyUsed, lazyTiles.recentPositions[offset]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GridMontage::insertLoadedTile(size_t offset, bool pinned) const
+{
+  LazyTiles& lazyTiles = *m_LazyTiles;
+  lazyTiles.loaded[offset] = true;
+  lazyTiles.tileSizes[offset] = estimateDataContainerSize(*m_DataContainers[offset]);
+  lazyTiles.memorySize += lazyTiles.tileSizes[offset];
+  if(pinned)
+  {
+    lazyTiles.pinned[offset] = true;
+  }
+  else
+  {
+    lazyTiles.recentlyUsed.push_front(offset);
+    lazyTiles.recentPositions[offset] = lazyTiles.recentlyUsed.begin();
+  }
+  enforceMemoryBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool GridMontage::stampTile(size_t offset) const
+{
+  size_t stamp = 0;
+  if(nullptr == m_DataContainers[offset] || !computeTileStamp(*m_DataContainers[offset], stamp))
+  {
+    return false;
+  }
+  m_LazyTiles->stamps[offset] = stamp;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GridMontage::forgetTile(size_t offset) const
+{
+  LazyTiles& lazyTiles = *m_LazyTiles;
+  auto position = lazyTiles.recentPositions[offset];
+  if(position != lazyTiles.recentlyUsed.end())
+  {
+    lazyTiles.recentlyUsed.erase(position);
+    lazyTiles.recentPositions[offset] = lazyTiles.recentlyUsed.end();
+  }
+  lazyTiles.memorySize -= lazyTiles.tileSizes[offset];
+  lazyTiles.tileSizes[offset] = 0;
+  lazyTiles.loaded[offset] = false;
+  lazyTiles.pinned[offset] = false;
+  lazyTiles.stamps[offset] = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GridMontage::releaseTile(size_t offset) const
+{
+  forgetTile(offset);
+  if(nullptr != m_DataContainers[offset])
+  {
+    releaseTileValues(*m_DataContainers[offset]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GridMontage::enforceMemoryBudget() const
+{
+  LazyTiles& lazyTiles = *m_LazyTiles;
+  if(lazyTiles.memoryBudget == 0 || lazyTiles.recentlyUsed.size() < 2)
+  {
+    return;
+  }
+
+  // Least recently used first. The most recently used tile is always kept.
+  const std::vector<size_t> candidates(lazyTiles.recentlyUsed.rbegin(), std::prev(lazyTiles.recentlyUsed.rend()));
+  for(size_t offset : candidates)
+  {
+    if(lazyTiles.memorySize <= lazyTiles.memoryBudget)
+    {
+      return;
+    }
+    const DataContainerShPtr& dc = m_DataContainers[offset];
+    size_t stamp = 0;
+    if(!computeTileStamp(*dc, stamp) || stamp != lazyTiles.stamps[offset])
+    {
+      // Reading a modified tile again would lose the changes so it stays loaded
+      lazyTiles.recentlyUsed.erase(lazyTiles.recentPositions[offset]);
+      lazyTiles.recentPositions[offset] = lazyTiles.recentlyUsed.end();
+      lazyTiles.pinned[offset] = true;
+      continue;
+    }
+    // Tiles whose parts are still referenced are released once the budget is enforced again
+    if(isTileInUse(*dc))
+    {
+      continue;
+    }
+    releaseTile(offset);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString GridMontage::getTileName(size_t offset) const
+{
+  if(nullptr != m_DataContainers[offset])
+  {
+    return m_DataContainers[offset]->getName();
+  }
+  if(nullptr != m_LazyTiles)
+  {
+    return m_LazyTiles->names[offset];
+  }
+  return QString();
+}
+
 // -----------------------------------------------------------------------------
 GridMontage::Pointer GridMontage::NullPointer()
 {
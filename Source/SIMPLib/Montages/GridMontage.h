@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <functional>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "SIMPLib/Geometry/IGeometry.h"
@@ -44,6 +47,12 @@
  * Tiles are saved in a vector with GridTileIndices used as a means to lookup a DataContainer.
  * The montage does not assign the origin of each DataContainer geometry based on
  * the tile's position in the montage.
+ *
+ * Montages with many tiles can be loaded lazily (see setLazyDataContainers). Each tile only
+ * holds the structure of its DataContainer until it is requested through getDataContainer,
+ * and the least recently used tiles are released again once the loaded tiles exceed the
+ * memory budget. Tiles are filled and released in place so the DataContainers stay the
+ * same objects. Modified tiles are never released.
  */
 class SIMPLib_EXPORT GridMontage : public AbstractMontage
 {
@@ -52,6 +61,7 @@ public:
   using TileIdType = SizeVec3Type;
   using DimensionsType = IVec3<double>;
   using BoundsType = IVec6<double>;
+  using TileLoaderType = std::function<DataContainerShPtr(const QString& dcName)>;
 
   using EnumType = uint32_t;
   enum class CollectionMethod : EnumType
@@ -138,8 +148,9 @@ public:
   GridTileIndex getTileIndex(size_t row, size_t col, size_t depth = 0) const;
 
   /**
-   * @brief Searches for and returns the GridTileIndex for the specified DataContainer.
+   * @brief Returns the GridTileIndex for the specified DataContainer.
    * If the DataContainer could not be found, return an invalid GridTileIndex.
+   * If the same DataContainer is used by several tiles, the first tile it was assigned to is returned.
    * @param dc
    * @return
    */
@@ -153,13 +164,23 @@ public:
   AbstractTileIndexShPtr getTileIndexFor(const DataContainerShPtr& dc) const override;
 
   /**
-   * @brief Returns a collection of DataContainers in the montage
+   * @brief Returns a collection of DataContainers in the montage.
+   * For lazily loaded montages, tiles that are not currently loaded only hold their structure,
+   * or are nullptr if the montage was only given the tile names.
    * @return
    */
   CollectionType getDataContainers() const override;
 
+  /**
+   * @brief Returns a QStringList of the DataContainer names in the montage.
+   * Lazily loaded montages return the names of all tiles without loading them.
+   * @return
+   */
+  QStringList getDataContainerNames() const override;
+
   /**
    * @brief Returns the DataContainer with the given GridTileIndex.
+   * Lazily loaded tiles are read when they are not currently loaded.
    * If the DataContainer is not found, return nullptr.
    * @param index
    * @return
@@ -175,16 +196,19 @@ public:
 
   /**
    * @brief Performs a deep copy of the current values.
+   * Lazily loaded montages also copy their tiles since tiles are filled and released in place.
    * @return
    */
   Pointer deepCopy() const;
 
   /**
    * @brief Creates a copy of the current montage and reassigns references
-   * to the given DataContainerArray's values.
+   * to the given DataContainerArray's values. Lazily loaded copies made without values
+   * only hold the structure of their tiles and never read them from the file.
    * @param dca
+   * @param forceNoAllocate
    */
-  AbstractMontage::Pointer propagate(const DataContainerArrayShPtr& dca) const override;
+  AbstractMontage::Pointer propagate(const DataContainerArrayShPtr& dca, bool forceNoAllocate = false) const override;
 
   /**
    * @brief Returns an HTML string with information about the montage with data laid out in a table.
@@ -257,6 +281,76 @@ public:
    */
   bool setDataContainers(std::vector<DataContainerShPtr> dataContainers);
 
+  /**
+   * @brief Switches the montage to lazy loading. Each tile only stores the name of its
+   * DataContainer until it is first requested, at which point the loader is called to read it.
+   * Once the loaded tiles exceed the memory budget, the least recently used tiles are released
+   * to their structure and read again on their next access. Only the tile accessors of the montage
+   * read tiles. Looking a tile up by name in the DataContainerArray returns its structure.
+   * Tiles whose arrays were written to since they were read (see IDataArray::getWriteCount),
+   * tiles holding arrays that do not count their writes and tiles assigned with setDataContainer
+   * are never released. Tiles whose AttributeMatrices, arrays or geometry are still referenced
+   * elsewhere are released later.
+   * A memory budget of 0 keeps every loaded tile.
+   * Returns false if the number of names does not match the tile count.
+   * @param dcNames
+   * @param loader
+   * @param memoryBudget Budget in bytes
+   * @return
+   */
+  bool setLazyDataContainers(const std::vector<QString>& dcNames, const TileLoaderType& loader, size_t memoryBudget = 0);
+
+  /**
+   * @brief Switches the montage to lazy loading with DataContainers that only hold the structure
+   * of each tile, such as the ones in the DataContainerArray. The loader reads a tile by the
+   * placeholder's name and its values are moved into the placeholder.
+   * Returns false if the number of placeholders does not match the tile count.
+   * @param placeholders
+   * @param loader
+   * @param memoryBudget Budget in bytes
+   * @return
+   */
+  bool setLazyDataContainers(const std::vector<DataContainerShPtr>& placeholders, const TileLoaderType& loader, size_t memoryBudget = 0);
+
+  /**
+   * @brief Reads the values of the given DataContainer if it is a lazily loaded tile that is not loaded.
+   * Returns true if the DataContainer is a tile of a lazily loaded montage.
+   * @param dc
+   * @return
+   */
+  bool loadDataContainer(const DataContainerShPtr& dc) const;
+
+  /**
+   * @brief Returns true if the tiles are loaded on demand.
+   * @return
+   */
+  bool isLazyLoading() const;
+
+  /**
+   * @brief Returns true if the tile at the given index currently holds its values.
+   * @param index
+   * @return
+   */
+  bool isTileLoaded(GridTileIndex index) const;
+
+  /**
+   * @brief Sets the memory budget in bytes for lazily loaded tiles and releases tiles until it is met.
+   * @param memoryBudget
+   */
+  void setMemoryBudget(size_t memoryBudget);
+
+  /**
+   * @brief Returns the memory budget in bytes for lazily loaded tiles.
+   * @return
+   */
+  size_t getMemoryBudget() const;
+
+  /**
+   * @brief Returns the estimated number of bytes used by the lazily loaded tiles.
+   * @return
+   */
+  size_t getLoadedMemorySize() const;
+
 protected:
   GridMontage(const QString& name, size_t row, size_t col, size_t depth);
 
@@ -268,6 +362,98 @@ protected:
   size_t getOffsetFromTileId(TileIdType tileID) const;
 
 private:
+  struct LazyTiles;
+
+  /**
+   * @brief Stores the DataContainer for the tile at the given offset and keeps the
+   * DataContainer to tile lookup in sync.
+   * The tile mutex must be locked by the caller.
+   * @param offset
+   * @param dc
+   */
+  void assignTile(size_t offset, const DataContainerShPtr& dc) const;
+
+  /**
+   * @brief Rebuilds the DataContainer to tile lookup from the current tiles.
+   * The tile mutex must be locked by the caller.
+   */
+  void rebuildTileOffsets() const;
+
+  /**
+   * @brief Copies the montage while sharing its DataContainers.
+   * @return
+   */
+  Pointer copyTiles() const;
+
+  /**
+   * @brief Returns the lazily loaded tile at the given offset, reading it if required.
+   * The lock must hold the tile mutex. It is released while the loader runs.
+   * @param offset
+   * @param lock
+   * @return
+   */
+  DataContainerShPtr loadTile(size_t offset, std::unique_lock<std::mutex>& lock) const;
+
+  /**
+   * @brief Marks the loaded tile at the given offset as the most recently used one.
+   * The tile mutex must be locked by the caller.
+   * @param offset
+   */
+  void touchTile(size_t offset) const;
+
+  /**
+   * @brief Marks the DataContainer at the given offset as loaded and releases older tiles if
+   * the memory budget is exceeded. Pinned tiles are never released.
+   * The tile mutex must be locked by the caller.
+   * @param offset
+   * @param pinned
+   */
+  void insertLoadedTile(size_t offset, bool pinned) const;
+
+  /**
+   * @brief Records the structure and write counts of the tile at the given offset so that later
+   * writes to it can be found. Returns false if the tile holds arrays that do not count their writes.
+   * The tile mutex must be locked by the caller.
+   * @param offset
+   * @return
+   */
+  bool stampTile(size_t offset) const;
+
+  /**
+   * @brief Marks the tile at the given offset as not loaded without changing its DataContainer.
+   * The tile mutex must be locked by the caller.
+   * @param offset
+   */
+  void forgetTile(size_t offset) const;
+
+  /**
+   * @brief Releases the values of the lazily loaded tile at the given offset and keeps its structure.
+   * The tile mutex must be locked by the caller.
+   * @param offset
+   */
+  void releaseTile(size_t offset) const;
+
+  /**
+   * @brief Releases the least recently used tiles until the memory budget is met.
+   * The most recently used tile is always kept. Modified tiles are pinned instead and tiles
+   * that are still in use are skipped.
+   * The tile mutex must be locked by the caller.
+   */
+  void enforceMemoryBudget() const;
+
+  /**
+   * @brief Returns the name of the DataContainer for the tile at the given offset.
+   * The tile mutex must be locked by the caller.
+   * @param offset
+   * @return
+   */
+  QString getTileName(size_t offset) const;
+
   SizeType m_Size;
-  CollectionType m_DataContainers;
+  // Lazily loaded tiles are read and released from const accessors
+  mutable CollectionType m_DataContainers;
+  mutable std::unordered_map<const DataContainer*, size_t> m_TileOffsets;
+  std::unique_ptr<LazyTiles> m_LazyTiles;
+  size_t m_TileGeneration = 0; // Changes whenever the lazy tiles are replaced
+  mutable std::mutex m_TileMutex;
 };
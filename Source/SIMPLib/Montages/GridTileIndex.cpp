@@ -117,7 +117,7 @@ bool GridTileIndex::isValid() const
   bool sizeCheck = true;
   for(size_t i = 0; i < 3; i++)
   {
-    sizeCheck &= m_TilePos[i] <= gridSize[i];
+    sizeCheck &= m_TilePos[i] < gridSize[i];
   }
 
   return AbstractTileIndex::isValid() && sizeCheck;
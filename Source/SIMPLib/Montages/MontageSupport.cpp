@@ -47,7 +47,7 @@
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-GridMontage::Pointer readGridMontageFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err)
+GridMontage::Pointer readGridMontageFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err, const GridMontage::TileLoaderType& tileLoader, size_t memoryBudget)
 {
   QString name;
   err = QH5Lite::readStringDataset(parentId, SIMPL::StringConstants::Name, name);
@@ -74,7 +74,7 @@ GridMontage::Pointer readGridMontageFromHDF5(hid_t parentId, const DataContainer
   }
 
   GridMontage::Pointer montage = GridMontage::New(name, dims[0], dims[1], dims[2]);
-  if(nullptr == dca)
+  if(nullptr == dca && !tileLoader)
   {
     return montage;
   }
@@ -85,6 +85,25 @@ GridMontage::Pointer readGridMontageFromHDF5(hid_t parentId, const DataContainer
   err = QH5Lite::readStringDataset(parentId, SIMPL::StringConstants::DataContainerNames, dcNameCollection);
   QStringList dcNames = dcNameCollection.split(sep, QSTRING_KEEP_EMPTY_PARTS);
 
+  if(tileLoader && nullptr == dca)
+  {
+    // Only the names are kept until each tile is requested
+    std::vector<QString> tileNames(dcNames.begin(), dcNames.end());
+    montage->setLazyDataContainers(tileNames, tileLoader, memoryBudget);
+    return montage;
+  }
+  if(tileLoader)
+  {
+    // The DataContainers in the DataContainerArray only hold the structure until each tile is requested
+    std::vector<DataContainerShPtr> placeholders;
+    for(const QString& dcName : dcNames)
+    {
+      placeholders.push_back(dca->getChildByName(dcName));
+    }
+    montage->setLazyDataContainers(placeholders, tileLoader, memoryBudget);
+    return montage;
+  }
+
   std::vector<DataContainerShPtr> dataContainers;
   for(const QString& dcName : dcNames)
   {
@@ -98,7 +117,7 @@ GridMontage::Pointer readGridMontageFromHDF5(hid_t parentId, const DataContainer
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-AbstractMontageShPtr MontageSupport::IO::ReadMontageFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err)
+AbstractMontageShPtr MontageSupport::IO::ReadMontageFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err, const GridMontage::TileLoaderType& tileLoader, size_t memoryBudget)
 {
   QString typeName;
   err = QH5Lite::readStringDataset(parentId, "Montage Type", typeName);
@@ -110,7 +129,7 @@ AbstractMontageShPtr MontageSupport::IO::ReadMontageFromHDF5(hid_t parentId, con
   // Create Montage of the correct type
   if(typeName == "GridMontage")
   {
-    return readGridMontageFromHDF5(parentId, dca, err);
+    return readGridMontageFromHDF5(parentId, dca, err, tileLoader, memoryBudget);
   }
 
   return nullptr;
@@ -119,7 +138,8 @@ AbstractMontageShPtr MontageSupport::IO::ReadMontageFromHDF5(hid_t parentId, con
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-DataContainerArray::MontageCollection MontageSupport::IO::ReadMontagesFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err)
+DataContainerArray::MontageCollection MontageSupport::IO::ReadMontagesFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err, const GridMontage::TileLoaderType& tileLoader,
+                                                                               size_t memoryBudget)
 {
   DataContainerArray::MontageCollection montageCollection;
 
@@ -133,7 +153,7 @@ DataContainerArray::MontageCollection MontageSupport::IO::ReadMontagesFromHDF5(h
     // This object will make sure the HDF5 Group id is closed when it goes out of scope.
     H5GroupAutoCloser bundleIdClose(montageId);
 
-    if(!montageCollection.insert(ReadMontageFromHDF5(montageId, dca, err)))
+    if(!montageCollection.insert(ReadMontageFromHDF5(montageId, dca, err, tileLoader, memoryBudget)))
     {
       return montageCollection;
     }
@@ -37,6 +37,7 @@
 #include "H5Support/H5SupportTypeDefs.h"
 
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Montages/GridMontage.h"
 
 class AbstractMontage;
 using AbstractMontageShPtr = std::shared_ptr<AbstractMontage>;
@@ -45,8 +46,30 @@ namespace MontageSupport
 {
 namespace IO
 {
-AbstractMontageShPtr ReadMontageFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err);
+/**
+ * @brief Reads the montage stored in the given HDF5 group. Tiles are looked up by name in the
+ * DataContainerArray. If a tile loader is given, those DataContainers only hold the structure of
+ * each tile and the loader reads the values when a tile is first accessed. Without a
+ * DataContainerArray the lazily loaded montage only stores the tile names.
+ * @param parentId
+ * @param dca
+ * @param err
+ * @param tileLoader
+ * @param memoryBudget Budget in bytes for lazily loaded tiles. 0 keeps every loaded tile.
+ * @return
+ */
+AbstractMontageShPtr ReadMontageFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err, const GridMontage::TileLoaderType& tileLoader = nullptr, size_t memoryBudget = 0);
 
-DataContainerArray::MontageCollection ReadMontagesFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err);
+/**
+ * @brief Reads all montages stored in the given HDF5 group. See ReadMontageFromHDF5.
+ * @param parentId
+ * @param dca
+ * @param err
+ * @param tileLoader
+ * @param memoryBudget Budget in bytes for lazily loaded tiles. 0 keeps every loaded tile.
+ * @return
+ */
+DataContainerArray::MontageCollection ReadMontagesFromHDF5(hid_t parentId, const DataContainerArrayShPtr& dca, int& err, const GridMontage::TileLoaderType& tileLoader = nullptr,
+                                                           size_t memoryBudget = 0);
 } // namespace IO
 } // namespace MontageSupport
@@ -0,0 +1,353 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Montages/GridMontage.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GridMontageTest
+{
+  const size_t k_TileBytes = 400;
+
+public:
+  GridMontageTest() = default;
+  ~GridMontageTest() = default;
+  GridMontageTest(const GridMontageTest&) = delete;            // Copy Constructor
+  GridMontageTest(GridMontageTest&&) = delete;                 // Move Constructor
+  GridMontageTest& operator=(const GridMontageTest&) = delete; // Copy Assignment
+  GridMontageTest& operator=(GridMontageTest&&) = delete;      // Move Assignment
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainer::Pointer createTile(const QString& name) const
+  {
+    DataContainer::Pointer dc = DataContainer::New(name);
+    std::vector<size_t> tDims = {k_TileBytes / sizeof(float)};
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->insertOrAssign(attrMat);
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(tDims[0], std::string("Data"), true);
+    attrMat->insertOrAssign(data);
+    return dc;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<QString> createTileNames(size_t count) const
+  {
+    std::vector<QString> names;
+    for(size_t i = 0; i < count; i++)
+    {
+      names.push_back(QString("Tile_%1").arg(i));
+    }
+    return names;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestTileIndexLookup()
+  {
+    GridMontage::Pointer montage = GridMontage::New("Montage", 3, 2, 1);
+    std::vector<DataContainer::Pointer> tiles;
+    for(const QString& name : createTileNames(montage->getTileCount()))
+    {
+      tiles.push_back(createTile(name));
+    }
+    DREAM3D_REQUIRE(montage->setDataContainers(tiles))
+    DREAM3D_REQUIRE(!montage->isLazyLoading())
+
+    // Tiles are stored row first
+    GridTileIndex index = montage->getTileIndexForDataContainer(tiles[4]);
+    DREAM3D_REQUIRE(index.isValid())
+    DREAM3D_REQUIRE_EQUAL(index.getRow(), 1)
+    DREAM3D_REQUIRE_EQUAL(index.getCol(), 1)
+    DREAM3D_REQUIRE(montage->getDataContainer(index) == tiles[4])
+
+    montage->setDataContainer(montage->getTileIndex(0, 0), tiles[4]);
+    montage->setDataContainer(index, nullptr);
+    index = montage->getTileIndexForDataContainer(tiles[4]);
+    DREAM3D_REQUIRE(index.isValid())
+    DREAM3D_REQUIRE_EQUAL(index.getRow(), 0)
+    DREAM3D_REQUIRE_EQUAL(index.getCol(), 0)
+    DREAM3D_REQUIRE(!montage->getTileIndexForDataContainer(tiles[0]).isValid())
+    DREAM3D_REQUIRE(!montage->getTileIndex(3, 0).isValid())
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLazyLoading()
+  {
+    size_t loadCount = 0;
+    GridMontage::TileLoaderType loader = [&](const QString& dcName) {
+      loadCount++;
+      return createTile(dcName);
+    };
+
+    // Room for two tiles
+    GridMontage::Pointer montage = GridMontage::New("Montage", 2, 3, 1);
+    DREAM3D_REQUIRE(montage->setLazyDataContainers(createTileNames(montage->getTileCount()), loader, 2 * k_TileBytes))
+    DREAM3D_REQUIRE(montage->isLazyLoading())
+    DREAM3D_REQUIRE_EQUAL(montage->getDataContainerNames().size(), 6)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 0)
+
+    GridTileIndex index0 = montage->getTileIndex(0, 0);
+    GridTileIndex index1 = montage->getTileIndex(1, 0);
+    GridTileIndex index2 = montage->getTileIndex(0, 1);
+    DataContainer::Pointer tile0 = montage->getDataContainer(index0);
+    DREAM3D_REQUIRE_VALID_POINTER(tile0)
+    DREAM3D_REQUIRE_EQUAL(tile0->getName(), QString("Tile_0"))
+    DREAM3D_REQUIRE(montage->getDataContainer(index0) == tile0)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+
+    montage->getDataContainer(index1);
+    DREAM3D_REQUIRE_EQUAL(montage->getLoadedMemorySize(), 2 * k_TileBytes)
+
+    // Using tile 0 again makes tile 1 the least recently used one
+    montage->getDataContainer(index0);
+    montage->getDataContainer(index2);
+    DREAM3D_REQUIRE_EQUAL(loadCount, 3)
+    DREAM3D_REQUIRE_EQUAL(montage->getLoadedMemorySize(), 2 * k_TileBytes)
+    DREAM3D_REQUIRE(montage->isTileLoaded(index0))
+    DREAM3D_REQUIRE(!montage->isTileLoaded(index1))
+    DREAM3D_REQUIRE(montage->isTileLoaded(index2))
+
+    // Released tiles are found by name and read again on their next access
+    GridTileIndex index = montage->getTileIndexForDataContainer(createTile("Tile_1"));
+    DREAM3D_REQUIRE(index.isValid())
+    DREAM3D_REQUIRE_EQUAL(index.getRow(), 1)
+    DREAM3D_REQUIRE_EQUAL(index.getCol(), 0)
+    DREAM3D_REQUIRE_VALID_POINTER(montage->getDataContainer(index1))
+    DREAM3D_REQUIRE_EQUAL(loadCount, 4)
+    DREAM3D_REQUIRE(!montage->isTileLoaded(index0))
+
+    montage->setMemoryBudget(k_TileBytes);
+    DREAM3D_REQUIRE_EQUAL(montage->getLoadedMemorySize(), k_TileBytes)
+    DREAM3D_REQUIRE(montage->isTileLoaded(index1))
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLazyDeepCopy()
+  {
+    GridMontage::TileLoaderType loader = [&](const QString& dcName) { return createTile(dcName); };
+
+    GridMontage::Pointer montage = GridMontage::New("Montage", 2, 2, 1);
+    DREAM3D_REQUIRE(montage->setLazyDataContainers(createTileNames(montage->getTileCount()), loader, 2 * k_TileBytes))
+    montage->getDataContainer(montage->getTileIndex(0, 0));
+    montage->getDataContainer(montage->getTileIndex(1, 0));
+
+    GridMontage::Pointer copy = montage->deepCopy();
+    DREAM3D_REQUIRE(copy->isLazyLoading())
+    DREAM3D_REQUIRE_EQUAL(copy->getLoadedMemorySize(), 2 * k_TileBytes)
+
+    // Each copy keeps its own usage order
+    copy->getDataContainer(copy->getTileIndex(0, 1));
+    DREAM3D_REQUIRE(!copy->isTileLoaded(copy->getTileIndex(0, 0)))
+    DREAM3D_REQUIRE(montage->isTileLoaded(montage->getTileIndex(0, 0)))
+
+    copy->resizeTileDims(1, 1, 1);
+    DREAM3D_REQUIRE_EQUAL(copy->getTileCount(), 1)
+    DREAM3D_REQUIRE_EQUAL(copy->getDataContainerNames().size(), 1)
+    DREAM3D_REQUIRE_EQUAL(copy->getDataContainer(copy->getTileIndex(0, 0))->getName(), QString("Tile_0"))
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLazyModifiedTiles()
+  {
+    GridMontage::TileLoaderType loader = [&](const QString& dcName) { return createTile(dcName); };
+
+    GridMontage::Pointer montage = GridMontage::New("Montage", 3, 1, 1);
+    DREAM3D_REQUIRE(montage->setLazyDataContainers(createTileNames(montage->getTileCount()), loader, 2 * k_TileBytes))
+    GridTileIndex index0 = montage->getTileIndex(0, 0);
+    GridTileIndex index1 = montage->getTileIndex(1, 0);
+    GridTileIndex index2 = montage->getTileIndex(2, 0);
+
+    DataContainer::Pointer tile0 = montage->getDataContainer(index0);
+    // Writable pointers count as writes to the array
+    tile0->getAttributeMatrix("CellData")->getAttributeArrayAs<FloatArrayType>("Data")->getPointer(0)[0] = 5.0f;
+    montage->getDataContainer(index1);
+    montage->getDataContainer(index2);
+
+    // The modified tile is kept even though it is the least recently used one
+    DREAM3D_REQUIRE(montage->isTileLoaded(index0))
+    DREAM3D_REQUIRE(!montage->isTileLoaded(index1))
+    DREAM3D_REQUIRE(montage->isTileLoaded(index2))
+
+    montage->getDataContainer(index1);
+    montage->setMemoryBudget(k_TileBytes);
+    DREAM3D_REQUIRE(montage->isTileLoaded(index0))
+    DREAM3D_REQUIRE(montage->isTileLoaded(index1))
+    DREAM3D_REQUIRE(!montage->isTileLoaded(index2))
+    DREAM3D_REQUIRE(montage->getDataContainer(index0) == tile0)
+    DREAM3D_REQUIRE_EQUAL(tile0->getAttributeMatrix("CellData")->getAttributeArrayAs<FloatArrayType>("Data")->getValue(0), 5.0f)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLazyTilesInUse()
+  {
+    size_t loadCount = 0;
+    GridMontage::TileLoaderType loader = [&](const QString& dcName) {
+      loadCount++;
+      return createTile(dcName);
+    };
+
+    GridMontage::Pointer montage = GridMontage::New("Montage", 3, 1, 1);
+    DREAM3D_REQUIRE(montage->setLazyDataContainers(createTileNames(montage->getTileCount()), loader, k_TileBytes))
+    GridTileIndex index0 = montage->getTileIndex(0, 0);
+    GridTileIndex index1 = montage->getTileIndex(1, 0);
+    GridTileIndex index2 = montage->getTileIndex(2, 0);
+
+    DataContainer::Pointer tile0 = montage->getDataContainer(index0);
+    IDataArray::Pointer data = tile0->getAttributeMatrix("CellData")->getAttributeArray("Data");
+    montage->getDataContainer(index1);
+    DREAM3D_REQUIRE(montage->isTileLoaded(index0))
+    DREAM3D_REQUIRE(data->isAllocated())
+
+    // Released tiles keep their structure and are filled again in place
+    data.reset();
+    montage->getDataContainer(index2);
+    DREAM3D_REQUIRE(!montage->isTileLoaded(index0))
+    DREAM3D_REQUIRE(!montage->isTileLoaded(index1))
+    DREAM3D_REQUIRE_EQUAL(montage->getLoadedMemorySize(), k_TileBytes)
+    data = tile0->getAttributeMatrix("CellData")->getAttributeArray("Data");
+    DREAM3D_REQUIRE_VALID_POINTER(data)
+    DREAM3D_REQUIRE(!data->isAllocated())
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), k_TileBytes / sizeof(float))
+
+    data.reset();
+    DREAM3D_REQUIRE(montage->getDataContainer(index0) == tile0)
+    DREAM3D_REQUIRE(tile0->getAttributeMatrix("CellData")->getAttributeArray("Data")->isAllocated())
+    DREAM3D_REQUIRE_EQUAL(loadCount, 4)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLazyDataContainerArray()
+  {
+    size_t loadCount = 0;
+    GridMontage::TileLoaderType loader = [&](const QString& dcName) {
+      loadCount++;
+      return createTile(dcName);
+    };
+
+    // The DataContainerArray holds the structure of every tile
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    GridMontage::Pointer montage = GridMontage::New("Montage", 2, 1, 1);
+    std::vector<DataContainer::Pointer> placeholders;
+    for(const QString& name : createTileNames(montage->getTileCount()))
+    {
+      placeholders.push_back(createTile(name)->deepCopy(true));
+      dca->addOrReplaceDataContainer(placeholders.back());
+    }
+    DREAM3D_REQUIRE(montage->setLazyDataContainers(placeholders, loader))
+    DREAM3D_REQUIRE(dca->addMontage(montage))
+    DREAM3D_REQUIRE(montage->getDataContainers() == placeholders)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 0)
+
+    // Looking a tile up in the DataContainerArray only returns its structure
+    DataContainer::Pointer tile0 = dca->getDataContainer("Tile_0");
+    DREAM3D_REQUIRE(tile0 == placeholders[0])
+    DREAM3D_REQUIRE(!montage->isTileLoaded(montage->getTileIndex(0, 0)))
+    DREAM3D_REQUIRE(!tile0->getAttributeMatrix("CellData")->getAttributeArray("Data")->isAllocated())
+    DREAM3D_REQUIRE_EQUAL(loadCount, 0)
+
+    // Asking the montage for a tile reads it into the same DataContainer
+    DREAM3D_REQUIRE(montage->loadDataContainer(tile0))
+    DREAM3D_REQUIRE(montage->getDataContainer(montage->getTileIndex(0, 0)) == tile0)
+    DREAM3D_REQUIRE(montage->isTileLoaded(montage->getTileIndex(0, 0)))
+    DREAM3D_REQUIRE(tile0->getAttributeMatrix("CellData")->getAttributeArray("Data")->isAllocated())
+    DREAM3D_REQUIRE(!montage->isTileLoaded(montage->getTileIndex(1, 0)))
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+
+    // Copies use the DataContainers of the new DataContainerArray and keep the loaded tiles that have values
+    DataContainerArray::Pointer dcaCopy = dca->deepCopy(false);
+    GridMontage::Pointer montageCopy = std::dynamic_pointer_cast<GridMontage>(dcaCopy->getMontage("Montage"));
+    DREAM3D_REQUIRE_VALID_POINTER(montageCopy)
+    DREAM3D_REQUIRE(montageCopy->isTileLoaded(montageCopy->getTileIndex(0, 0)))
+    DREAM3D_REQUIRE(montageCopy->getDataContainer(montageCopy->getTileIndex(0, 0)) == dcaCopy->getChildByName("Tile_0"))
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+
+    // Copies made without values, such as the ones used during preflight, never read tiles
+    DataContainerArray::Pointer structureCopy = dca->deepCopy(true);
+    montageCopy = std::dynamic_pointer_cast<GridMontage>(structureCopy->getMontage("Montage"));
+    DREAM3D_REQUIRE(!montageCopy->isTileLoaded(montageCopy->getTileIndex(0, 0)))
+    DataContainer::Pointer tileCopy = montageCopy->getDataContainer(montageCopy->getTileIndex(0, 0));
+    DREAM3D_REQUIRE(tileCopy == structureCopy->getChildByName("Tile_0"))
+    DREAM3D_REQUIRE(!tileCopy->getAttributeMatrix("CellData")->getAttributeArray("Data")->isAllocated())
+    DREAM3D_REQUIRE(!montageCopy->isTileLoaded(montageCopy->getTileIndex(0, 0)))
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestTileIndexLookup())
+    DREAM3D_REGISTER_TEST(TestLazyLoading())
+    DREAM3D_REGISTER_TEST(TestLazyDeepCopy())
+    DREAM3D_REGISTER_TEST(TestLazyModifiedTiles())
+    DREAM3D_REGISTER_TEST(TestLazyTilesInUse())
+    DREAM3D_REGISTER_TEST(TestLazyDataContainerArray())
+  }
+};
@@ -68,6 +68,28 @@ const QString FilterParameterHumanLabel("FilterParameterHumanLabel");
 const QString FilterParameterPropertyName("FilterParameterPropertyName");
 const QString FilterParameterReadOnly("FilterParameterReadOnly");
 const QString FilterParameters("FilterParameters");
+
+const QString JobId("JobId");
+const QString JobStatus("JobStatus");
+const QString Progress("Progress");
+const QString Messages("Messages");
+const QString MessageType("MessageType");
+const QString MessageOffset("MessageOffset");
+const QString SubmitTime("SubmitTime");
+const QString StartTime("StartTime");
+const QString EndTime("EndTime");
+const QString CancelRequested("CancelRequested");
+
+const QString DataContainerArray("DataContainerArray");
+const QString PreflightCache("PreflightCache");
+const QString JobQueue("JobQueue");
+const QString Hits("Hits");
+const QString Misses("Misses");
+const QString Entries("Entries");
+const QString MaxEntries("MaxEntries");
+const QString WorkerCount("WorkerCount");
+const QString QueuedJobs("QueuedJobs");
+const QString MaxQueuedJobs("MaxQueuedJobs");
 } // namespace JSON
 
 } // namespace SIMPL
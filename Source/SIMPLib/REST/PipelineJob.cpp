@@ -0,0 +1,366 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineJob.h"
+
+#include <algorithm>
+
+#include <QtCore/QMutexLocker>
+
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/Messages/AbstractMessageHandler.h"
+#include "SIMPLib/Messages/PipelineProgressMessage.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+#include "SIMPLib/REST/V1Controllers/ExecutePipelineMessageHandler.h"
+
+namespace
+{
+/**
+ * @brief Picks the overall pipeline progress out of the messages that a running job receives
+ */
+class PipelineJobProgressHandler : public AbstractMessageHandler
+{
+public:
+  explicit PipelineJobProgressHandler(int* progress)
+  : m_Progress(progress)
+  {
+  }
+
+  void processMessage(const PipelineProgressMessage* msg) const override
+  {
+    *m_Progress = msg->getProgressValue();
+  }
+
+private:
+  int* m_Progress = nullptr;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::PipelineJob(const FilterPipeline::Pointer& pipeline)
+: m_Id(QUuid::createUuid())
+, m_Pipeline(pipeline)
+, m_SubmitTime(QDateTime::currentDateTime())
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::~PipelineJob() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJob::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJob::New(const FilterPipeline::Pointer& pipeline)
+{
+  Pointer sharedPtr(new(PipelineJob)(pipeline));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineJob::getNameOfClass() const
+{
+  return QString("PipelineJob");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineJob::ClassName()
+{
+  return QString("PipelineJob");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineJob::StatusToString(Status status)
+{
+  switch(status)
+  {
+  case Status::Queued:
+    return QString("Queued");
+  case Status::Running:
+    return QString("Running");
+  case Status::Completed:
+    return QString("Completed");
+  case Status::Failed:
+    return QString("Failed");
+  case Status::Canceled:
+    return QString("Canceled");
+  }
+  return QString("Unknown");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid PipelineJob::getId() const
+{
+  return m_Id;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::Status PipelineJob::getStatus() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Status;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineJob::getProgress() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Progress;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJob::isFinished() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Status == Status::Completed || m_Status == Status::Failed || m_Status == Status::Canceled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::run()
+{
+  FilterPipeline::Pointer pipeline;
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(m_Status != Status::Queued)
+    {
+      // The job was canceled while it was waiting in the queue
+      return;
+    }
+    m_Status = Status::Running;
+    m_StartTime = QDateTime::currentDateTime();
+    pipeline = m_Pipeline;
+  }
+
+  // The pipeline emits its messages on this worker thread, so the job records them directly instead of
+  // relying on an event loop to deliver queued signals.
+  Observer obs; // Create an Observer to report errors/progress from the executing pipeline
+  pipeline->addMessageReceiver(&obs);
+  connect(pipeline.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), this, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)), Qt::DirectConnection);
+
+  int err = pipeline->preflightPipeline();
+
+  bool execute = false;
+  {
+    QMutexLocker locker(&m_Mutex);
+    execute = (err >= 0 && m_Errors.isEmpty() && !m_CancelRequested);
+  }
+
+  if(execute)
+  {
+    pipeline->execute();
+  }
+
+  disconnect(pipeline.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), this, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)));
+  pipeline->removeMessageReceiver(&obs);
+
+  Status status = Status::Failed;
+  bool cancelRequested = false;
+  {
+    QMutexLocker locker(&m_Mutex);
+    cancelRequested = m_CancelRequested;
+  }
+  // A cancel is never reported as a success, even if it arrived too late to stop the last filter
+  if(cancelRequested || pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Canceled)
+  {
+    status = Status::Canceled;
+  }
+  else if(execute && pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+  {
+    status = Status::Completed;
+  }
+  finish(status);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJob::cancel()
+{
+  FilterPipeline::Pointer pipeline;
+  bool forward = false;
+  {
+    QMutexLocker locker(&m_Mutex);
+    switch(m_Status)
+    {
+    case Status::Queued:
+      m_CancelRequested = true;
+      m_Status = Status::Canceled;
+      m_EndTime = QDateTime::currentDateTime();
+      m_Pipeline = FilterPipeline::NullPointer();
+      return true;
+    case Status::Running:
+      m_CancelRequested = true;
+      pipeline = m_Pipeline;
+      // Decided under the lock so that only one of cancel() and processPipelineMessage() forwards the request
+      forward = !m_CancelForwarded && pipeline->isExecuting();
+      m_CancelForwarded = m_CancelForwarded || forward;
+      break;
+    default:
+      return false;
+    }
+  }
+
+  // Only ask the pipeline to cancel when it is in a state that accepts the request. Otherwise the
+  // pipeline reports an error for the cancel itself. If the pipeline has not started to execute yet the
+  // request is forwarded by processPipelineMessage() once it has.
+  if(forward)
+  {
+    pipeline->cancel();
+  }
+  else
+  {
+    pipeline->cancelPreflight();
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::finish(Status status)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Status = status;
+  if(status == Status::Completed)
+  {
+    m_Progress = 100;
+  }
+  m_EndTime = QDateTime::currentDateTime();
+  m_Pipeline = FilterPipeline::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::processPipelineMessage(const AbstractMessage::Pointer& pm)
+{
+  QJsonObject msgObj;
+  msgObj[SIMPL::JSON::MessageType] = pm->getNameOfClass();
+  msgObj[SIMPL::JSON::Message] = pm->generateMessageString();
+
+  FilterPipeline::Pointer pipeline;
+  {
+    QMutexLocker locker(&m_Mutex);
+    m_Messages.append(msgObj);
+    if(m_Messages.size() > k_MaxMessages)
+    {
+      m_Messages.removeFirst();
+      m_DroppedMessages++;
+    }
+
+    ExecutePipelineMessageHandler msgHandler(&m_Errors, &m_Warnings);
+    pm->visit(&msgHandler);
+
+    PipelineJobProgressHandler progressHandler(&m_Progress);
+    pm->visit(&progressHandler);
+
+    // A cancel that arrived after the preflight but before the pipeline started to execute found nothing to
+    // cancel. The pipeline reports its start on this thread, so the request is passed on right away.
+    if(m_CancelRequested && !m_CancelForwarded && nullptr != m_Pipeline && m_Pipeline->isExecuting())
+    {
+      m_CancelForwarded = true;
+      pipeline = m_Pipeline;
+    }
+  }
+
+  if(nullptr != pipeline)
+  {
+    pipeline->cancel();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJob::toJson(int messageOffset) const
+{
+  QMutexLocker locker(&m_Mutex);
+
+  QJsonObject jobObj;
+  jobObj[SIMPL::JSON::JobId] = m_Id.toString();
+  jobObj[SIMPL::JSON::JobStatus] = StatusToString(m_Status);
+  jobObj[SIMPL::JSON::Progress] = m_Progress;
+  jobObj[SIMPL::JSON::SubmitTime] = m_SubmitTime.toString(Qt::ISODate);
+  if(m_StartTime.isValid())
+  {
+    jobObj[SIMPL::JSON::StartTime] = m_StartTime.toString(Qt::ISODate);
+  }
+  if(m_EndTime.isValid())
+  {
+    jobObj[SIMPL::JSON::EndTime] = m_EndTime.toString(Qt::ISODate);
+  }
+
+  // Offsets count every message the pipeline generated, including the ones that were dropped
+  int firstMessage = std::max(messageOffset - m_DroppedMessages, 0);
+  QJsonArray messages;
+  for(int i = firstMessage; i < m_Messages.size(); i++)
+  {
+    messages.append(m_Messages[i]);
+  }
+  jobObj[SIMPL::JSON::Messages] = messages;
+  jobObj[SIMPL::JSON::MessageOffset] = std::max(messageOffset, m_DroppedMessages + m_Messages.size());
+
+  jobObj[SIMPL::JSON::Completed] = (m_Status == Status::Completed);
+  jobObj[SIMPL::JSON::PipelineErrors] = m_Errors;
+  jobObj[SIMPL::JSON::PipelineWarnings] = m_Warnings;
+
+  return jobObj;
+}
@@ -0,0 +1,173 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/IObserver.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+/**
+ * @brief The PipelineJob class wraps a single pipeline that was submitted to the PipelineJobQueue. The
+ * pipeline is preflighted and executed on one of the queue's worker threads while REST requests poll the
+ * job for its status, progress and the messages generated so far. All accessors are thread safe.
+ */
+class SIMPLib_EXPORT PipelineJob : public QObject, public IObserver
+{
+  Q_OBJECT
+public:
+  using Self = PipelineJob;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Creates a new job for the given pipeline. The job is assigned a new unique id.
+   * @param pipeline
+   * @return
+   */
+  static Pointer New(const FilterPipeline::Pointer& pipeline);
+
+  ~PipelineJob() override;
+
+  /**
+   * @brief Returns the name of the class for PipelineJob
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for PipelineJob
+   */
+  static QString ClassName();
+
+  enum class Status : unsigned int
+  {
+    Queued = 0,
+    Running,
+    Completed,
+    Failed,
+    Canceled
+  };
+
+  /**
+   * @brief Returns the string that is used for the given status in the REST responses
+   * @param status
+   * @return
+   */
+  static QString StatusToString(Status status);
+
+  /**
+   * @brief The number of most recent messages a job keeps for the status requests
+   */
+  static const int k_MaxMessages = 1000;
+
+  QUuid getId() const;
+  Status getStatus() const;
+  int getProgress() const;
+
+  /**
+   * @brief Returns true if the job has reached the Completed, Failed or Canceled status
+   */
+  bool isFinished() const;
+
+  /**
+   * @brief Preflights and then executes the pipeline on the calling thread. This is called by the
+   * PipelineJobQueue worker threads and returns once the job has finished.
+   */
+  void run();
+
+  /**
+   * @brief Requests that the job be canceled. A running pipeline is asked to cancel and will stop after
+   * the current filter honors the request. A request that arrives before the pipeline has started to
+   * execute is passed on as soon as it starts, and the job always finishes as Canceled once a cancel was
+   * requested. Returns false if the job had already finished.
+   * @return
+   */
+  bool cancel();
+
+  /**
+   * @brief Writes the current state of the job into a JSON object. Only the messages starting at
+   * messageOffset are included so that clients can poll for the messages they have not seen yet.
+   * Only the last k_MaxMessages messages are kept; offsets keep counting all generated messages.
+   * @param messageOffset
+   * @return
+   */
+  QJsonObject toJson(int messageOffset = 0) const;
+
+public Q_SLOTS:
+  void processPipelineMessage(const AbstractMessage::Pointer& pm) override;
+
+protected:
+  PipelineJob(const FilterPipeline::Pointer& pipeline);
+
+  /**
+   * @brief Moves the job into a finished status and releases the pipeline
+   * @param status
+   */
+  void finish(Status status);
+
+private:
+  QUuid m_Id;
+  FilterPipeline::Pointer m_Pipeline;
+
+  mutable QMutex m_Mutex;
+  Status m_Status = Status::Queued;
+  bool m_CancelRequested = false;
+  bool m_CancelForwarded = false;
+  int m_Progress = 0;
+  QJsonArray m_Messages;
+  int m_DroppedMessages = 0;
+  QJsonArray m_Errors;
+  QJsonArray m_Warnings;
+
+  QDateTime m_SubmitTime;
+  QDateTime m_StartTime;
+  QDateTime m_EndTime;
+
+public:
+  PipelineJob(const PipelineJob&) = delete;            // Copy Constructor Not Implemented
+  PipelineJob(PipelineJob&&) = delete;                 // Move Constructor Not Implemented
+  PipelineJob& operator=(const PipelineJob&) = delete; // Copy Assignment Not Implemented
+  PipelineJob& operator=(PipelineJob&&) = delete;      // Move Assignment Not Implemented
+};
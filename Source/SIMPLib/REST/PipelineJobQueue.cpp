@@ -0,0 +1,285 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineJobQueue.h"
+
+#include <algorithm>
+
+#include <QtCore/QMutexLocker>
+#include <QtCore/QRunnable>
+#include <QtCore/QSettings>
+#include <QtCore/QThread>
+
+namespace
+{
+const int k_DefaultWorkerCount = 2;
+const int k_DefaultMaxQueuedJobs = 100;
+const int k_DefaultMaxRetainedJobs = 1000;
+
+QMutex s_InstanceMutex;
+} // namespace
+
+/**
+ * @brief Worker task that is handed to the thread pool once for every submitted job. Each task runs
+ * whichever job is at the front of the queue when the task starts.
+ */
+class PipelineJobTask : public QRunnable
+{
+public:
+  explicit PipelineJobTask(PipelineJobQueue* queue)
+  : m_Queue(queue)
+  {
+  }
+
+  void run() override
+  {
+    m_Queue->runNextJob();
+  }
+
+private:
+  PipelineJobQueue* m_Queue = nullptr;
+};
+
+PipelineJobQueue* PipelineJobQueue::m_Instance = nullptr;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue* PipelineJobQueue::Instance()
+{
+  QMutexLocker locker(&s_InstanceMutex);
+  if(m_Instance == nullptr)
+  {
+    m_Instance = new PipelineJobQueue(k_DefaultWorkerCount, k_DefaultMaxQueuedJobs, k_DefaultMaxRetainedJobs);
+  }
+  return m_Instance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::CreateInstance(QSettings& settings)
+{
+  settings.beginGroup("jobs");
+  int workerCount = settings.value("workerCount", k_DefaultWorkerCount).toInt();
+  int maxQueuedJobs = settings.value("maxQueuedJobs", k_DefaultMaxQueuedJobs).toInt();
+  int maxRetainedJobs = settings.value("maxRetainedJobs", k_DefaultMaxRetainedJobs).toInt();
+  settings.endGroup();
+
+  CreateInstance(workerCount, maxQueuedJobs, maxRetainedJobs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::CreateInstance(int workerCount, int maxQueuedJobs, int maxRetainedJobs)
+{
+  QMutexLocker locker(&s_InstanceMutex);
+  delete m_Instance;
+  m_Instance = new PipelineJobQueue(workerCount, maxQueuedJobs, maxRetainedJobs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue::PipelineJobQueue(int workerCount, int maxQueuedJobs, int maxRetainedJobs)
+: m_MaxQueuedJobs(std::max(maxQueuedJobs, 0))
+, m_MaxRetainedJobs(std::max(maxRetainedJobs, 0))
+{
+  if(workerCount < 1)
+  {
+    workerCount = QThread::idealThreadCount();
+  }
+  m_ThreadPool.setMaxThreadCount(workerCount);
+  // Pipelines typically run for a long time, so keep idle workers around instead of recreating them
+  m_ThreadPool.setExpiryTimeout(-1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue::~PipelineJobQueue()
+{
+  std::vector<PipelineJob::Pointer> jobs;
+  {
+    QMutexLocker locker(&m_Mutex);
+    for(const auto& job : m_Jobs)
+    {
+      jobs.push_back(job);
+    }
+  }
+  for(const auto& job : jobs)
+  {
+    job->cancel();
+  }
+  m_ThreadPool.waitForDone();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJobQueue::submit(const FilterPipeline::Pointer& pipeline)
+{
+  PipelineJob::Pointer job = PipelineJob::New(pipeline);
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(static_cast<int>(m_Pending.size()) >= m_MaxQueuedJobs)
+    {
+      return PipelineJob::NullPointer();
+    }
+    m_Pending.push_back(job);
+    m_Jobs.insert(job->getId(), job);
+    m_JobOrder.push_back(job->getId());
+  }
+
+  m_ThreadPool.start(new PipelineJobTask(this));
+  pruneFinishedJobs();
+  return job;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJobQueue::getJob(const QUuid& id) const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Jobs.value(id, PipelineJob::NullPointer());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJobQueue::cancel(const QUuid& id)
+{
+  PipelineJob::Pointer job;
+  {
+    QMutexLocker locker(&m_Mutex);
+    job = m_Jobs.value(id, PipelineJob::NullPointer());
+    if(job.get() == nullptr)
+    {
+      return false;
+    }
+    // A job that has not started yet gives its slot in the queue back right away
+    auto iter = std::find(m_Pending.begin(), m_Pending.end(), job);
+    if(iter != m_Pending.end())
+    {
+      m_Pending.erase(iter);
+    }
+  }
+  return job->cancel();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJobQueue::waitForDone(int msecs)
+{
+  return m_ThreadPool.waitForDone(msecs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::runNextJob()
+{
+  PipelineJob::Pointer job;
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(m_Pending.empty())
+    {
+      // The job this task was started for has been canceled while it was waiting
+      return;
+    }
+    job = m_Pending.front();
+    m_Pending.pop_front();
+  }
+
+  job->run();
+  pruneFinishedJobs();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::pruneFinishedJobs()
+{
+  QMutexLocker locker(&m_Mutex);
+  auto iter = m_JobOrder.begin();
+  while(m_Jobs.size() > m_MaxRetainedJobs && iter != m_JobOrder.end())
+  {
+    PipelineJob::Pointer job = m_Jobs.value(*iter, PipelineJob::NullPointer());
+    if(job.get() == nullptr || job->isFinished())
+    {
+      m_Jobs.remove(*iter);
+      iter = m_JobOrder.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineJobQueue::getWorkerCount() const
+{
+  return m_ThreadPool.maxThreadCount();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineJobQueue::getMaxQueuedJobs() const
+{
+  return m_MaxQueuedJobs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineJobQueue::getMaxRetainedJobs() const
+{
+  return m_MaxRetainedJobs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineJobQueue::getQueuedJobCount() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return static_cast<int>(m_Pending.size());
+}
@@ -0,0 +1,153 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <deque>
+
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QThreadPool>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/REST/PipelineJob.h"
+
+class QSettings;
+
+/**
+ * @brief The PipelineJobQueue class runs pipelines that were submitted to the REST server on a fixed
+ * number of worker threads. Submitting a pipeline returns a PipelineJob immediately so that the request
+ * thread is released while the pipeline runs. At most getMaxQueuedJobs() jobs may wait for a worker at the
+ * same time; further submissions are rejected until a worker becomes free. Finished jobs are kept so that
+ * clients can collect their results, with the oldest finished jobs being dropped once more than
+ * getMaxRetainedJobs() have accumulated.
+ */
+class SIMPLib_EXPORT PipelineJobQueue
+{
+public:
+  /**
+   * @brief Returns the queue used by the REST controllers. A queue with the default settings is created
+   * if CreateInstance() has not been called.
+   * @return
+   */
+  static PipelineJobQueue* Instance();
+
+  /**
+   * @brief Creates the queue used by the REST controllers from the [jobs] group of the server settings
+   * @param settings
+   */
+  static void CreateInstance(QSettings& settings);
+
+  /**
+   * @brief Creates the queue used by the REST controllers
+   * @param workerCount Number of pipelines that may execute at the same time. Values < 1 use the number of cores.
+   * @param maxQueuedJobs Number of submitted pipelines that may wait for a worker
+   * @param maxRetainedJobs Number of finished jobs whose results are kept
+   */
+  static void CreateInstance(int workerCount, int maxQueuedJobs, int maxRetainedJobs);
+
+  virtual ~PipelineJobQueue();
+
+  /**
+   * @brief Adds the pipeline to the queue. Returns a null pointer if the queue is full.
+   * @param pipeline
+   * @return
+   */
+  PipelineJob::Pointer submit(const FilterPipeline::Pointer& pipeline);
+
+  /**
+   * @brief Returns the job with the given id or a null pointer if no such job is known
+   * @param id
+   * @return
+   */
+  PipelineJob::Pointer getJob(const QUuid& id) const;
+
+  /**
+   * @brief Cancels the job with the given id. A job that is still waiting is removed from the queue.
+   * Returns false if the job is unknown or has already finished.
+   * @param id
+   * @return
+   */
+  bool cancel(const QUuid& id);
+
+  /**
+   * @brief Blocks until all submitted jobs have finished or until msecs have passed
+   * @param msecs
+   * @return
+   */
+  bool waitForDone(int msecs = -1);
+
+  int getWorkerCount() const;
+  int getMaxQueuedJobs() const;
+  int getMaxRetainedJobs() const;
+
+  /**
+   * @brief Returns the number of jobs that are waiting for a worker
+   */
+  int getQueuedJobCount() const;
+
+protected:
+  PipelineJobQueue(int workerCount, int maxQueuedJobs, int maxRetainedJobs);
+
+  /**
+   * @brief Takes the next waiting job off the queue and runs it. This is the body of each worker task.
+   */
+  void runNextJob();
+
+  /**
+   * @brief Drops the oldest finished jobs once more than getMaxRetainedJobs() have accumulated
+   */
+  void pruneFinishedJobs();
+
+private:
+  static PipelineJobQueue* m_Instance;
+
+  int m_MaxQueuedJobs = 0;
+  int m_MaxRetainedJobs = 0;
+  QThreadPool m_ThreadPool;
+
+  mutable QMutex m_Mutex;
+  std::deque<PipelineJob::Pointer> m_Pending;
+  QHash<QUuid, PipelineJob::Pointer> m_Jobs;
+  std::deque<QUuid> m_JobOrder;
+
+  friend class PipelineJobTask;
+
+public:
+  PipelineJobQueue(const PipelineJobQueue&) = delete;            // Copy Constructor Not Implemented
+  PipelineJobQueue(PipelineJobQueue&&) = delete;                 // Move Constructor Not Implemented
+  PipelineJobQueue& operator=(const PipelineJobQueue&) = delete; // Copy Assignment Not Implemented
+  PipelineJobQueue& operator=(PipelineJobQueue&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,258 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PreflightResultCache.h"
+
+#include <algorithm>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QSettings>
+
+#include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputPathFilterParameter.h"
+#include "SIMPLib/FilterParameters/MultiInputFileFilterParameter.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+namespace
+{
+const int k_DefaultMaxEntries = 256;
+
+QMutex s_InstanceMutex;
+
+/**
+ * @brief Collects the paths of all files and directories that the filter reads during preflight
+ */
+void collectInputPaths(const AbstractFilter::Pointer& filter, QStringList& paths)
+{
+  FilterParameterVectorType parameters = filter->getFilterParameters();
+  for(const auto& parameter : parameters)
+  {
+    if(auto* inputFile = dynamic_cast<InputFileFilterParameter*>(parameter.get()))
+    {
+      if(inputFile->getGetterCallback())
+      {
+        paths.push_back(inputFile->getGetterCallback()());
+      }
+    }
+    else if(auto* inputPath = dynamic_cast<InputPathFilterParameter*>(parameter.get()))
+    {
+      if(inputPath->getGetterCallback())
+      {
+        paths.push_back(inputPath->getGetterCallback()());
+      }
+    }
+    else if(auto* multiInputFile = dynamic_cast<MultiInputFileFilterParameter*>(parameter.get()))
+    {
+      if(multiInputFile->getGetterCallback())
+      {
+        for(const std::string& path : multiInputFile->getGetterCallback()())
+        {
+          paths.push_back(QString::fromStdString(path));
+        }
+      }
+    }
+    else if(auto* reader = dynamic_cast<DataContainerReaderFilterParameter*>(parameter.get()))
+    {
+      paths.push_back(filter->property(reader->getInputFileProperty().toLatin1().constData()).toString());
+    }
+  }
+}
+} // namespace
+
+PreflightResultCache* PreflightResultCache::m_Instance = nullptr;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PreflightResultCache* PreflightResultCache::Instance()
+{
+  QMutexLocker locker(&s_InstanceMutex);
+  if(m_Instance == nullptr)
+  {
+    m_Instance = new PreflightResultCache(k_DefaultMaxEntries);
+  }
+  return m_Instance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightResultCache::CreateInstance(QSettings& settings)
+{
+  settings.beginGroup("preflightCache");
+  int maxEntries = settings.value("maxEntries", k_DefaultMaxEntries).toInt();
+  settings.endGroup();
+
+  CreateInstance(maxEntries);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightResultCache::CreateInstance(int maxEntries)
+{
+  QMutexLocker locker(&s_InstanceMutex);
+  delete m_Instance;
+  m_Instance = new PreflightResultCache(maxEntries);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PreflightResultCache::PreflightResultCache(int maxEntries)
+{
+  // Every entry has a cost of 1 so the maximum cost is the maximum number of entries
+  m_Cache.setMaxCost(std::max(maxEntries, 0));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PreflightResultCache::~PreflightResultCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PreflightResultCache::CreateKey(const QJsonObject& pipelineObj, const FilterPipeline::Pointer& pipeline)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData(QJsonDocument(pipelineObj).toJson(QJsonDocument::Compact));
+
+  QStringList inputPaths;
+  for(const auto& filter : pipeline->getFilterContainer())
+  {
+    collectInputPaths(filter, inputPaths);
+  }
+
+  for(const QString& path : inputPaths)
+  {
+    QFileInfo fi(path);
+    qint64 modified = fi.exists() ? fi.lastModified().toMSecsSinceEpoch() : -1;
+    hash.addData(path.toUtf8());
+    hash.addData(QByteArray::number(modified));
+    hash.addData(QByteArray::number(fi.size()));
+  }
+
+  return hash.result();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PreflightResultCache::find(const QByteArray& key, QJsonObject& result)
+{
+  QMutexLocker locker(&m_Mutex);
+  QJsonObject* entry = m_Cache.object(key);
+  if(entry == nullptr)
+  {
+    m_MissCount++;
+    return false;
+  }
+  m_HitCount++;
+  result = *entry;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightResultCache::insert(const QByteArray& key, const QJsonObject& result)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Cache.insert(key, new QJsonObject(result), 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightResultCache::clear()
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Cache.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PreflightResultCache::getHitCount() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_HitCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PreflightResultCache::getMissCount() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_MissCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PreflightResultCache::getEntryCount() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Cache.count();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PreflightResultCache::getMaxEntries() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Cache.maxCost();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PreflightResultCache::toJson() const
+{
+  QMutexLocker locker(&m_Mutex);
+  QJsonObject obj;
+  obj[SIMPL::JSON::Hits] = m_HitCount;
+  obj[SIMPL::JSON::Misses] = m_MissCount;
+  obj[SIMPL::JSON::Entries] = m_Cache.count();
+  obj[SIMPL::JSON::MaxEntries] = m_Cache.maxCost();
+  return obj;
+}
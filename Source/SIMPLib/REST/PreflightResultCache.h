@@ -0,0 +1,137 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCache>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+class QSettings;
+
+/**
+ * @brief The PreflightResultCache class remembers the responses of the PreflightPipeline end point so that
+ * clients which preflight the same pipeline over and over again, such as a web front end that preflights on
+ * every edit, are answered without running the preflight again. Entries are keyed by a hash of the
+ * pipeline JSON and the modification times of the files and directories the pipeline reads, so editing an
+ * input file invalidates the entry. The least recently used entries are dropped once more than
+ * getMaxEntries() results are cached.
+ */
+class SIMPLib_EXPORT PreflightResultCache
+{
+public:
+  /**
+   * @brief Returns the cache used by the REST controllers. A cache with the default settings is created
+   * if CreateInstance() has not been called.
+   * @return
+   */
+  static PreflightResultCache* Instance();
+
+  /**
+   * @brief Creates the cache used by the REST controllers from the [preflightCache] group of the server settings
+   * @param settings
+   */
+  static void CreateInstance(QSettings& settings);
+
+  /**
+   * @brief Creates the cache used by the REST controllers
+   * @param maxEntries Number of preflight results to keep. A value of 0 disables the cache.
+   */
+  static void CreateInstance(int maxEntries);
+
+  virtual ~PreflightResultCache();
+
+  /**
+   * @brief Computes the cache key for a pipeline. The JSON is hashed in its compact form, in which the
+   * object keys are always sorted, so that semantically equal requests map to the same key. The path,
+   * size and modification time of every input file or directory referenced by the pipeline's filters
+   * are hashed as well.
+   * @param pipelineObj The JSON the pipeline was created from
+   * @param pipeline The pipeline created from pipelineObj
+   * @return
+   */
+  static QByteArray CreateKey(const QJsonObject& pipelineObj, const FilterPipeline::Pointer& pipeline);
+
+  /**
+   * @brief Looks up a cached preflight result and updates the hit and miss counters
+   * @param key
+   * @param result Set to the cached result if one was found
+   * @return
+   */
+  bool find(const QByteArray& key, QJsonObject& result);
+
+  /**
+   * @brief Stores a preflight result
+   * @param key
+   * @param result
+   */
+  void insert(const QByteArray& key, const QJsonObject& result);
+
+  /**
+   * @brief Removes all cached results. The hit and miss counters are kept.
+   */
+  void clear();
+
+  qint64 getHitCount() const;
+  qint64 getMissCount() const;
+  int getEntryCount() const;
+  int getMaxEntries() const;
+
+  /**
+   * @brief Writes the hit and miss counters and the cache size into a JSON object
+   * @return
+   */
+  QJsonObject toJson() const;
+
+protected:
+  explicit PreflightResultCache(int maxEntries);
+
+private:
+  static PreflightResultCache* m_Instance;
+
+  mutable QMutex m_Mutex;
+  QCache<QByteArray, QJsonObject> m_Cache;
+  qint64 m_HitCount = 0;
+  qint64 m_MissCount = 0;
+
+public:
+  PreflightResultCache(const PreflightResultCache&) = delete;            // Copy Constructor Not Implemented
+  PreflightResultCache(PreflightResultCache&&) = delete;                 // Move Constructor Not Implemented
+  PreflightResultCache& operator=(const PreflightResultCache&) = delete; // Copy Assignment Not Implemented
+  PreflightResultCache& operator=(PreflightResultCache&&) = delete;      // Move Assignment Not Implemented
+};
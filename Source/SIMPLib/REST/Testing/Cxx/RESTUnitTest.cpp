@@ -38,7 +38,9 @@
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonParseError>
 #include <QtCore/QMimeDatabase>
+#include <QtCore/QThread>
 #include <QtCore/QUrl>
+#include <QtCore/QUuid>
 
 #include <QtNetwork/QHostAddress>
 #include <QtNetwork/QHttpMultiPart>
@@ -826,6 +828,125 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QJsonObject sendJsonRequest(const QString& endPoint, const QJsonObject& requestObj)
+  {
+    QUrl url = getConnectionURL();
+    url.setPath("/api/v1/" + endPoint);
+
+    QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", QJsonDocument(requestObj).toJson());
+
+    QJsonParseError jsonParseError;
+    QJsonDocument doc = QJsonDocument::fromJson(reply->readAll(), &jsonParseError);
+    DREAM3D_REQUIRE_EQUAL(jsonParseError.error, QJsonParseError::ParseError::NoError);
+    return doc.object();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSubmitPipeline()
+  {
+    QUrl url = getConnectionURL();
+
+    url.setPath("/api/v1/SubmitPipeline");
+
+    // Test 'Incorrect Content Type'
+    {
+      QByteArray data;
+
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "text/plain", data);
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::ProtocolInvalidOperationError);
+
+      QJsonParseError jsonParseError;
+      QJsonDocument doc = QJsonDocument::fromJson(reply->readAll(), &jsonParseError);
+      DREAM3D_REQUIRE_EQUAL(jsonParseError.error, QJsonParseError::ParseError::NoError);
+
+      QJsonObject responseObject = doc.object();
+      DREAM3D_REQUIRE_EQUAL(responseObject.size(), 3);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -20);
+    }
+
+    // Test 'Pipeline Could Not Be Created'
+    {
+      QJsonObject rootObj;
+      rootObj[SIMPL::JSON::Pipeline] = 2;
+      QJsonObject responseObject = sendJsonRequest("SubmitPipeline", rootObj);
+      DREAM3D_REQUIRE_EQUAL(responseObject.size(), 3);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -50);
+    }
+
+    // Test 'Unknown Job'
+    {
+      QJsonObject rootObj;
+      rootObj[SIMPL::JSON::JobId] = QUuid::createUuid().toString();
+      QJsonObject responseObject = sendJsonRequest("PipelineJobStatus", rootObj);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -80);
+
+      responseObject = sendJsonRequest("CancelPipelineJob", rootObj);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -80);
+
+      rootObj[SIMPL::JSON::JobId] = QString("Foo");
+      responseObject = sendJsonRequest("PipelineJobStatus", rootObj);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -70);
+    }
+
+    // Test Pipeline Submission and Polling
+    {
+      QFile file(UnitTest::RestUnitTest::RESTPipelineFilePath);
+      DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly), true);
+
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", file.readAll());
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::NoError);
+
+      QJsonParseError jsonParseError;
+      QJsonDocument doc = QJsonDocument::fromJson(reply->readAll(), &jsonParseError);
+      DREAM3D_REQUIRE_EQUAL(jsonParseError.error, QJsonParseError::ParseError::NoError);
+
+      QJsonObject responseObject = doc.object();
+      DREAM3D_REQUIRE_EQUAL(responseObject.contains(SIMPL::JSON::JobId), true);
+      QString jobId = responseObject[SIMPL::JSON::JobId].toString();
+      DREAM3D_REQUIRE_EQUAL(QUuid(jobId).isNull(), false);
+
+      // Poll until the job has finished, collecting the messages incrementally
+      QJsonObject statusRequest;
+      statusRequest[SIMPL::JSON::JobId] = jobId;
+      statusRequest[SIMPL::JSON::MessageOffset] = 0;
+      int messageCount = 0;
+      QString status;
+      for(int i = 0; i < 600; i++)
+      {
+        responseObject = sendJsonRequest("PipelineJobStatus", statusRequest);
+        DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::JobId].toString(), jobId);
+        messageCount += responseObject[SIMPL::JSON::Messages].toArray().size();
+        DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::MessageOffset].toInt(), messageCount);
+        statusRequest[SIMPL::JSON::MessageOffset] = messageCount;
+
+        status = responseObject[SIMPL::JSON::JobStatus].toString();
+        if(status != "Queued" && status != "Running")
+        {
+          break;
+        }
+        QThread::msleep(100);
+      }
+
+      DREAM3D_REQUIRE_EQUAL(status, QString("Completed"));
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].toBool(), true);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Progress].toInt(), 100);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::PipelineErrors].toArray().size(), 0);
+      DREAM3D_REQUIRE(messageCount > 0);
+
+      // A finished job cannot be canceled
+      QJsonObject cancelRequest;
+      cancelRequest[SIMPL::JSON::JobId] = jobId;
+      responseObject = sendJsonRequest("CancelPipelineJob", cancelRequest);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::CancelRequested].toBool(), false);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::JobStatus].toString(), QString("Completed"));
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1504,7 +1625,8 @@ public:
       DREAM3D_REQUIRE_EQUAL(jsonParseError.error, QJsonParseError::ParseError::NoError);
 
       QJsonObject responseObject = doc.object();
-      DREAM3D_REQUIRE_EQUAL(responseObject.size(), 4);
+      DREAM3D_REQUIRE_EQUAL(responseObject.size(), 5);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::DataContainerArray].isObject(), true);
       DREAM3D_REQUIRE_EQUAL(responseObject.contains(SIMPL::JSON::Completed), true);
       DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].isBool(), true);
       DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].toBool(), false);
@@ -1574,7 +1696,8 @@ public:
       DREAM3D_REQUIRE_EQUAL(jsonParseError.error, QJsonParseError::ParseError::NoError);
 
       QJsonObject responseObject = doc.object();
-      DREAM3D_REQUIRE_EQUAL(responseObject.size(), 4);
+      DREAM3D_REQUIRE_EQUAL(responseObject.size(), 5);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::DataContainerArray].isObject(), true);
       DREAM3D_REQUIRE_EQUAL(responseObject.contains(SIMPL::JSON::Completed), true);
       DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].isBool(), true);
       DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].toBool(), true);
@@ -1605,6 +1728,38 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestServerStats()
+  {
+    QJsonObject statsObj = sendJsonRequest("ServerStats", QJsonObject());
+    DREAM3D_REQUIRE_EQUAL(statsObj[SIMPL::JSON::ErrorCode].toInt(), 0);
+    DREAM3D_REQUIRE_EQUAL(statsObj[SIMPL::JSON::PreflightCache].isObject(), true);
+    DREAM3D_REQUIRE_EQUAL(statsObj[SIMPL::JSON::JobQueue].isObject(), true);
+    QJsonObject cacheObj = statsObj[SIMPL::JSON::PreflightCache].toObject();
+    int hits = cacheObj[SIMPL::JSON::Hits].toInt();
+    int misses = cacheObj[SIMPL::JSON::Misses].toInt();
+
+    QFile file(UnitTest::RestUnitTest::RESTPipelineFilePath);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly), true);
+    QJsonObject requestObj;
+    requestObj[SIMPL::JSON::Pipeline] = QJsonDocument::fromJson(file.readAll()).object();
+
+    // The second identical preflight must be answered from the cache with the same result
+    QJsonObject firstResponse = sendJsonRequest("PreflightPipeline", requestObj);
+    QJsonObject secondResponse = sendJsonRequest("PreflightPipeline", requestObj);
+    firstResponse.remove(SIMPL::JSON::SessionID);
+    secondResponse.remove(SIMPL::JSON::SessionID);
+    DREAM3D_REQUIRE_EQUAL(secondResponse.size(), 4);
+    DREAM3D_REQUIRE(firstResponse == secondResponse);
+
+    cacheObj = sendJsonRequest("ServerStats", QJsonObject())[SIMPL::JSON::PreflightCache].toObject();
+    DREAM3D_REQUIRE_EQUAL(cacheObj[SIMPL::JSON::Hits].toInt() + cacheObj[SIMPL::JSON::Misses].toInt(), hits + misses + 2);
+    DREAM3D_REQUIRED(cacheObj[SIMPL::JSON::Hits].toInt(), >=, hits + 1);
+    DREAM3D_REQUIRED(cacheObj[SIMPL::JSON::Entries].toInt(), >, 0);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1735,6 +1890,7 @@ public:
 
     DREAM3D_REGISTER_TEST(TestExecutePipelineWithFiles());
     DREAM3D_REGISTER_TEST(TestExecutePipeline());
+    DREAM3D_REGISTER_TEST(TestSubmitPipeline());
 
     DREAM3D_REGISTER_TEST(TestListFilterParameters());
     DREAM3D_REGISTER_TEST(TestLoadedPlugins());
@@ -1742,6 +1898,7 @@ public:
     DREAM3D_REGISTER_TEST(TestNumFilters());
     DREAM3D_REGISTER_TEST(TestPluginInfo());
     DREAM3D_REGISTER_TEST(TestPreflightPipeline());
+    DREAM3D_REGISTER_TEST(TestServerStats());
     DREAM3D_REGISTER_TEST(TestSIMPLibVersion());
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
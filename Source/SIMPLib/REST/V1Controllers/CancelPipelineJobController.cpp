@@ -0,0 +1,132 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "CancelPipelineJobController.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QUuid>
+
+#include "QtWebApp/httpserver/httpsessionstore.h"
+
+#include "SIMPLib/REST/PipelineJobQueue.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CancelPipelineJobController::CancelPipelineJobController(const QHostAddress& hostAddress, const int hostPort)
+{
+  setListenHost(hostAddress, hostPort);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CancelPipelineJobController::service(HttpRequest& request, HttpResponse& response)
+{
+  // Get current session, or create a new one
+  HttpSessionStore* sessionStore = HttpSessionStore::Instance();
+  HttpSession session = sessionStore->getSession(request, response);
+
+  QString content_type = request.getHeader(QByteArray("content-type"));
+
+  QJsonObject rootObj;
+  rootObj[SIMPL::JSON::SessionID] = QString(session.getId());
+
+  response.setHeader("Content-Type", "application/json");
+
+  if(content_type.compare("application/json") != 0)
+  {
+    // Form Error response
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    rootObj[SIMPL::JSON::ErrorMessage] = EndPoint() + ": Content Type is not application/json";
+    rootObj[SIMPL::JSON::ErrorCode] = -20;
+    QJsonDocument jdoc(rootObj);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  QJsonParseError jsonParseError;
+  QString requestBody = request.getBody();
+  QJsonDocument requestDoc = QJsonDocument::fromJson(requestBody.toUtf8(), &jsonParseError);
+  if(jsonParseError.error != QJsonParseError::ParseError::NoError)
+  {
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: JSON Request Parsing Error - %2").arg(EndPoint()).arg(jsonParseError.errorString());
+    rootObj[SIMPL::JSON::ErrorCode] = -30;
+    QJsonDocument jdoc(rootObj);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  QJsonObject requestObj = requestDoc.object();
+  QUuid jobId(requestObj.value(SIMPL::JSON::JobId).toString());
+  if(jobId.isNull())
+  {
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: No valid JobId found in the JSON request body.").arg(EndPoint());
+    rootObj[SIMPL::JSON::ErrorCode] = -70;
+    QJsonDocument jdoc(rootObj);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  PipelineJob::Pointer job = PipelineJobQueue::Instance()->getJob(jobId);
+  if(job.get() == nullptr)
+  {
+    response.setStatusCode(HttpResponse::HttpStatusCode::NotFound);
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: No job with id %2 exists. It may have been removed after it finished.").arg(EndPoint()).arg(jobId.toString());
+    rootObj[SIMPL::JSON::ErrorCode] = -80;
+    QJsonDocument jdoc(rootObj);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  bool canceled = PipelineJobQueue::Instance()->cancel(jobId);
+
+  rootObj[SIMPL::JSON::JobId] = jobId.toString();
+  rootObj[SIMPL::JSON::CancelRequested] = canceled;
+  rootObj[SIMPL::JSON::JobStatus] = PipelineJob::StatusToString(job->getStatus());
+
+  QJsonDocument jdoc(rootObj);
+  response.write(jdoc.toJson(), true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString CancelPipelineJobController::EndPoint()
+{
+  return QString("CancelPipelineJob");
+}
@@ -37,6 +37,7 @@
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Plugin/PluginManager.h"
@@ -47,6 +48,7 @@
 #include "QtWebApp/httpserver/httpsessionstore.h"
 
 #include "SIMPLib/REST/PipelineListener.h"
+#include "SIMPLib/REST/PreflightResultCache.h"
 #include "SIMPLib/REST/V1Controllers/PreflightPipelineMessageHandler.h"
 #include "SIMPLib/REST/V1Controllers/SIMPLStaticFileController.h"
 
@@ -125,6 +127,21 @@ void PreflightPipelineController::service(HttpRequest& request, HttpResponse& re
     return;
   }
 
+  // Repeated preflights of an unchanged pipeline are answered from the cache
+  PreflightResultCache* cache = PreflightResultCache::Instance();
+  QByteArray cacheKey = PreflightResultCache::CreateKey(pipelineObj, pipeline);
+  QJsonObject resultObj;
+  if(cache->find(cacheKey, resultObj))
+  {
+    for(auto iter = resultObj.constBegin(); iter != resultObj.constEnd(); ++iter)
+    {
+      rootObj[iter.key()] = iter.value();
+    }
+    QJsonDocument jdoc(rootObj);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
   PipelineListener listener(nullptr);
   pipeline->addMessageReceiver(&listener);
 
@@ -189,6 +206,25 @@ void PreflightPipelineController::service(HttpRequest& request, HttpResponse& re
   rootObj[SIMPL::JSON::PipelineErrors] = errors;
   rootObj[SIMPL::JSON::PipelineWarnings] = warnings;
 
+  // Describe the data structure that the pipeline would produce
+  QJsonObject dcaObj;
+  FilterPipeline::FilterContainerType& filters = pipeline->getFilterContainer();
+  for(auto iter = filters.rbegin(); iter != filters.rend(); ++iter)
+  {
+    if((*iter)->getEnabled() && (*iter)->getDataContainerArray().get() != nullptr)
+    {
+      DataContainerArrayProxy proxy((*iter)->getDataContainerArray().get());
+      proxy.writeJson(dcaObj);
+      break;
+    }
+  }
+  rootObj[SIMPL::JSON::DataContainerArray] = dcaObj;
+
+  // Cache everything but the session id, which belongs to this request
+  resultObj = rootObj;
+  resultObj.remove(SIMPL::JSON::SessionID);
+  cache->insert(cacheKey, resultObj);
+
   QJsonDocument jdoc(rootObj);
 
   response.write(jdoc.toJson(), true);
@@ -0,0 +1,138 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SubmitPipelineController.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "QtWebApp/httpserver/httpsessionstore.h"
+
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/REST/PipelineJobQueue.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SubmitPipelineController::SubmitPipelineController(const QHostAddress& hostAddress, const int hostPort)
+{
+  setListenHost(hostAddress, hostPort);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SubmitPipelineController::service(HttpRequest& request, HttpResponse& response)
+{
+  // Get current session, or create a new one
+  HttpSessionStore* sessionStore = HttpSessionStore::Instance();
+  HttpSession session = sessionStore->getSession(request, response);
+
+  QString content_type = request.getHeader(QByteArray("content-type"));
+
+  QJsonObject rootObj;
+  rootObj[SIMPL::JSON::SessionID] = QString(session.getId());
+
+  response.setHeader("Content-Type", "application/json");
+
+  if(content_type.compare("application/json") != 0)
+  {
+    // Form Error response
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    rootObj[SIMPL::JSON::ErrorMessage] = EndPoint() + ": Content Type is not application/json";
+    rootObj[SIMPL::JSON::ErrorCode] = -20;
+    QJsonDocument jdoc(rootObj);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  QJsonParseError jsonParseError;
+  QString requestBody = request.getBody();
+  QJsonDocument requestDoc = QJsonDocument::fromJson(requestBody.toUtf8(), &jsonParseError);
+  if(jsonParseError.error != QJsonParseError::ParseError::NoError)
+  {
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: Error Parsing JSON Request Body - %2").arg(EndPoint()).arg(jsonParseError.errorString());
+    rootObj[SIMPL::JSON::ErrorCode] = -40;
+    QJsonDocument jdoc(rootObj);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  // The pipeline may either be the request body itself, as for ExecutePipeline, or be wrapped in a
+  // Pipeline object, as for PreflightPipeline.
+  QJsonObject pipelineObj = requestDoc.object();
+  if(pipelineObj.value(SIMPL::JSON::Pipeline).isObject())
+  {
+    pipelineObj = pipelineObj.value(SIMPL::JSON::Pipeline).toObject();
+  }
+
+  FilterPipeline::Pointer pipeline = FilterPipeline::FromJson(pipelineObj);
+  if(pipeline.get() == nullptr)
+  {
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: Pipeline object could not be created from the provided JSON pipeline data.").arg(EndPoint());
+    rootObj[SIMPL::JSON::ErrorCode] = -50;
+    QJsonDocument jdoc(rootObj);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  PipelineJobQueue* queue = PipelineJobQueue::Instance();
+  PipelineJob::Pointer job = queue->submit(pipeline);
+  if(job.get() == nullptr)
+  {
+    response.setStatusCode(HttpResponse::HttpStatusCode::ServiceUnavailable);
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: The job queue is full. %2 pipelines are already waiting to be executed.").arg(EndPoint()).arg(queue->getMaxQueuedJobs());
+    rootObj[SIMPL::JSON::ErrorCode] = -60;
+    QJsonDocument jdoc(rootObj);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  response.setStatusCode(HttpResponse::HttpStatusCode::Accepted);
+  rootObj[SIMPL::JSON::JobId] = job->getId().toString();
+  rootObj[SIMPL::JSON::JobStatus] = PipelineJob::StatusToString(job->getStatus());
+
+  QJsonDocument jdoc(rootObj);
+  response.write(jdoc.toJson(), true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SubmitPipelineController::EndPoint()
+{
+  return QString("SubmitPipeline");
+}
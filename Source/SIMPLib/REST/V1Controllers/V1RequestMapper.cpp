@@ -34,15 +34,19 @@
 #include "QtWebApp/logging/filelogger.h"
 
 #include "ApiNotFoundController.h"
+#include "CancelPipelineJobController.h"
 #include "ExecutePipelineController.h"
 #include "ListFilterParametersController.h"
 #include "LoadedPluginsController.h"
 #include "NamesOfFiltersController.h"
 #include "NumFiltersController.h"
+#include "PipelineJobStatusController.h"
 #include "PluginInfoController.h"
 #include "PreflightPipelineController.h"
 #include "SIMPLStaticFileController.h"
 #include "SIMPLibVersionController.h"
+#include "ServerStatsController.h"
+#include "SubmitPipelineController.h"
 
 /** Redirects log messages to a file */
 extern FileLogger* logger;
@@ -80,6 +84,18 @@ void V1RequestMapper::service(HttpRequest& request, HttpResponse& response)
   {
     ExecutePipelineController(getListenHost(), getListenPort()).service(request, response);
   }
+  else if(path.endsWith(SubmitPipelineController::EndPoint()))
+  {
+    SubmitPipelineController(getListenHost(), getListenPort()).service(request, response);
+  }
+  else if(path.endsWith(PipelineJobStatusController::EndPoint()))
+  {
+    PipelineJobStatusController(getListenHost(), getListenPort()).service(request, response);
+  }
+  else if(path.endsWith(CancelPipelineJobController::EndPoint()))
+  {
+    CancelPipelineJobController(getListenHost(), getListenPort()).service(request, response);
+  }
   else if(path.endsWith(ListFilterParametersController::EndPoint()))
   {
     ListFilterParametersController(getListenHost(), getListenPort()).service(request, response);
@@ -108,6 +124,10 @@ void V1RequestMapper::service(HttpRequest& request, HttpResponse& response)
   {
     PreflightPipelineController(getListenHost(), getListenPort()).service(request, response);
   }
+  else if(path.endsWith(ServerStatsController::EndPoint()))
+  {
+    ServerStatsController(getListenHost(), getListenPort()).service(request, response);
+  }
   // All other pathes are mapped to the static file controller.
   // In this case, a single instance is used for multiple requests.
   else
@@ -35,14 +35,19 @@
 #include "ParallelTaskAlgorithm.h"
 
 #include <algorithm>
+#include <numeric>
 #include <thread>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 ParallelTaskAlgorithm::ParallelTaskAlgorithm()
 : m_Parallelization(true)
-, m_MaxThreads(std::thread::hardware_concurrency())
+, m_MaxThreads(std::max(std::thread::hardware_concurrency(), 1U))
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 , m_TaskGroup(new tbb::task_group)
 #endif
@@ -92,7 +97,12 @@ uint32_t ParallelTaskAlgorithm::getMaxThreads() const
 // -----------------------------------------------------------------------------
 void ParallelTaskAlgorithm::setMaxThreads(uint32_t threads)
 {
-  m_MaxThreads = std::min(threads, std::thread::hardware_concurrency());
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_MaxThreads = std::max(std::min(threads, std::thread::hardware_concurrency()), 1U);
+  }
+  // Raising the limit may unblock a caller waiting in execute()
+  m_SlotAvailable.notify_all();
 }
 
 // -----------------------------------------------------------------------------
@@ -101,8 +111,141 @@ void ParallelTaskAlgorithm::setMaxThreads(uint32_t threads)
 void ParallelTaskAlgorithm::wait()
 {
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  // This will spill over if the number of files to process does not divide evenly by the number of threads.
   m_TaskGroup->wait();
-  m_CurThreads = 0;
 #endif
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<ParallelTaskAlgorithm::Duration> ParallelTaskAlgorithm::getTaskTimings() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_TaskTimings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelTaskAlgorithm::Duration ParallelTaskAlgorithm::getElapsedTime() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(!m_TimingStarted || m_TaskTimings.empty())
+  {
+    return Duration::zero();
+  }
+  return m_LastTaskEnd - m_FirstTaskStart;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelTaskAlgorithm::Duration ParallelTaskAlgorithm::getIdleTime() const
+{
+  Duration elapsed = getElapsedTime();
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  Duration busy = std::accumulate(m_TaskTimings.begin(), m_TaskTimings.end(), Duration::zero());
+  Duration available = elapsed * m_TimedThreads;
+  if(busy >= available)
+  {
+    return Duration::zero();
+  }
+  return available - busy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelTaskAlgorithm::resetTaskTimings()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_TaskTimings.clear();
+  m_TimingStarted = false;
+  m_TimedThreads = 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ParallelTaskAlgorithm::canRunParallel() const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // A single slot, or an arena without worker threads, would leave the submitting
+  // thread blocked on a task that nobody can run.
+  return m_Parallelization && m_MaxThreads > 1 && tbb::this_task_arena::max_concurrency() > 1;
+#else
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint32_t ParallelTaskAlgorithm::getTaskLimit() const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // The submitting thread holds one arena slot while it waits for a free task slot, so only the
+  // remaining worker threads can run tasks. Allowing more tasks in flight than there are workers
+  // would queue a task that nobody runs until another one finishes.
+  uint32_t workers = static_cast<uint32_t>(std::max(tbb::this_task_arena::max_concurrency() - 1, 1));
+  return std::min(m_MaxThreads, workers);
+#else
+  return 1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelTaskAlgorithm::acquireTaskSlot()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  m_SlotAvailable.wait(lock, [this] { return m_CurThreads < getTaskLimit(); });
+  m_CurThreads++;
+
+  if(!m_TimingStarted)
+  {
+    m_TimingStarted = true;
+    m_FirstTaskStart = Clock::now();
+  }
+  m_TimedThreads = std::max(m_TimedThreads, getTaskLimit());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelTaskAlgorithm::releaseTaskSlot(const Clock::time_point& start)
+{
+  recordTaskTime(start);
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_CurThreads--;
+  }
+  m_SlotAvailable.notify_one();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelTaskAlgorithm::startTiming(const Clock::time_point& start)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(!m_TimingStarted)
+  {
+    m_TimingStarted = true;
+    m_FirstTaskStart = start;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelTaskAlgorithm::recordTaskTime(const Clock::time_point& start)
+{
+  Clock::time_point end = Clock::now();
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_TaskTimings.push_back(end - start);
+  m_LastTaskEnd = std::max(m_LastTaskEnd, end);
+}
@@ -34,7 +34,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 
@@ -50,10 +54,20 @@
  * An object with a function operator is required to operate the task.  This class utilizes
  * TBB for parallelization and will fallback to non-parallelization if it is not available
  * or the parallelization is disabled.
+ *
+ * Tasks are handed to TBB's work-stealing scheduler as soon as they are submitted. Back-pressure
+ * is applied per task instead of per batch: execute() only blocks while getMaxThreads() tasks are
+ * in flight and resumes as soon as any one of them finishes, so a single slow task no longer holds
+ * the remaining cores idle. The number of tasks in flight is also capped at the number of TBB
+ * worker threads, since the submitting thread does not run tasks while it is blocked. The wall time of every task is recorded so callers can compare the
+ * time spent in task bodies against the available thread time.
  */
 class SIMPLib_EXPORT ParallelTaskAlgorithm
 {
 public:
+  using Clock = std::chrono::steady_clock;
+  using Duration = Clock::duration;
+
   ParallelTaskAlgorithm();
   virtual ~ParallelTaskAlgorithm();
 
@@ -87,38 +101,127 @@ public:
    * @brief Executes the given object's function operator.  If parallel algorithms
    * is enabled, this process is multi-threaded.  Otherwise, this process is done
    * in a single thread.
+   *
+   * When running in parallel, this call blocks only until fewer than getMaxThreads()
+   * tasks, and no more tasks than there are worker threads, are in flight. Call wait() to wait for all submitted tasks to finish.
    * @param body
    */
   template <typename Body>
   void execute(const Body& body)
   {
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    bool doParallel = false;
-    doParallel = m_Parallelization;
-    if(doParallel)
+    if(canRunParallel())
     {
-      m_TaskGroup->run(body);
-      m_CurThreads++;
-      if(m_CurThreads >= m_MaxThreads)
-      {
-        wait();
-      }
+      acquireTaskSlot();
+      m_TaskGroup->run([this, body]() {
+        Clock::time_point start = Clock::now();
+        try
+        {
+          body();
+        } catch(...)
+        {
+          releaseTaskSlot(start);
+          throw;
+        }
+        releaseTaskSlot(start);
+      });
+      return;
     }
-#else
-    body();
 #endif
+    Clock::time_point start = Clock::now();
+    startTiming(start);
+    body();
+    recordTaskTime(start);
   }
 
   /**
-   * @brief Waits for the threads to finish and resets the current thread count.
+   * @brief Waits for the threads to finish.
    */
   void wait();
 
+  /**
+   * @brief Returns the wall time of every task completed since the last call to
+   * resetTaskTimings(), in order of completion.
+   * @return
+   */
+  std::vector<Duration> getTaskTimings() const;
+
+  /**
+   * @brief Returns the wall time between the start of the first task and the end of the
+   * last completed task since the last call to resetTaskTimings().
+   * @return
+   */
+  Duration getElapsedTime() const;
+
+  /**
+   * @brief Returns the thread time that was available during getElapsedTime() but not
+   * spent inside a task body.  This is the elapsed time multiplied by the number of
+   * threads in use minus the sum of getTaskTimings().
+   * @return
+   */
+  Duration getIdleTime() const;
+
+  /**
+   * @brief Clears the recorded task timings.  Should not be called while tasks are in flight.
+   */
+  void resetTaskTimings();
+
 private:
+  /**
+   * @brief Returns true if tasks should be submitted to the task group.
+   * @return
+   */
+  bool canRunParallel() const;
+
+  /**
+   * @brief Returns the number of tasks that may be in flight at once.  This is getMaxThreads()
+   * capped at the number of worker threads in the current task arena.
+   * @return
+   */
+  uint32_t getTaskLimit() const;
+
+  /**
+   * @brief Blocks until fewer than getTaskLimit() tasks are in flight and then
+   * reserves a slot for a new task.
+   */
+  void acquireTaskSlot();
+
+  /**
+   * @brief Records the timing of a task that started at the given time and frees its slot.
+   * @param start
+   */
+  void releaseTaskSlot(const Clock::time_point& start);
+
+  /**
+   * @brief Marks the given time as the start of the timed interval if no task has run since
+   * the last reset.
+   * @param start
+   */
+  void startTiming(const Clock::time_point& start);
+
+  /**
+   * @brief Records the timing of a task that started at the given time.
+   * @param start
+   */
+  void recordTaskTime(const Clock::time_point& start);
+
   bool m_Parallelization = false;
   uint32_t m_MaxThreads = 1;
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   uint32_t m_CurThreads = 0;
+  mutable std::mutex m_Mutex;
+  std::condition_variable m_SlotAvailable;
+  std::vector<Duration> m_TaskTimings;
+  bool m_TimingStarted = false;
+  Clock::time_point m_FirstTaskStart;
+  Clock::time_point m_LastTaskEnd;
+  uint32_t m_TimedThreads = 1;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   std::shared_ptr<tbb::task_group> m_TaskGroup;
 #endif
+
+public:
+  ParallelTaskAlgorithm(const ParallelTaskAlgorithm&) = delete;            // Copy Constructor Not Implemented
+  ParallelTaskAlgorithm(ParallelTaskAlgorithm&&) = delete;                 // Move Constructor Not Implemented
+  ParallelTaskAlgorithm& operator=(const ParallelTaskAlgorithm&) = delete; // Copy Assignment Not Implemented
+  ParallelTaskAlgorithm& operator=(ParallelTaskAlgorithm&&) = delete;      // Move Assignment Not Implemented
 };
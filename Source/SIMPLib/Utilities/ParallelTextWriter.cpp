@@ -0,0 +1,219 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ParallelTextWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <QtCore/QThread>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Formats each block of rows into its own buffer
+ */
+class FormatBlocksImpl
+{
+public:
+  FormatBlocksImpl(std::vector<std::string>* buffers, size_t firstRow, size_t endRow, size_t rowsPerBlock, const ParallelTextWriter::RowFormatter* formatter)
+  : m_Buffers(buffers)
+  , m_FirstRow(firstRow)
+  , m_EndRow(endRow)
+  , m_RowsPerBlock(rowsPerBlock)
+  , m_Formatter(formatter)
+  {
+  }
+  FormatBlocksImpl(const FormatBlocksImpl&) = default;
+  FormatBlocksImpl(FormatBlocksImpl&&) = default;
+  FormatBlocksImpl& operator=(const FormatBlocksImpl&) = delete;
+  FormatBlocksImpl& operator=(FormatBlocksImpl&&) = delete;
+  ~FormatBlocksImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      std::string& buffer = (*m_Buffers)[block];
+      buffer.clear();
+      const size_t start = m_FirstRow + block * m_RowsPerBlock;
+      const size_t end = std::min(start + m_RowsPerBlock, m_EndRow);
+      for(size_t row = start; row < end; row++)
+      {
+        (*m_Formatter)(row, buffer);
+      }
+    }
+  }
+
+private:
+  std::vector<std::string>* m_Buffers = nullptr;
+  size_t m_FirstRow = 0;
+  size_t m_EndRow = 0;
+  size_t m_RowsPerBlock = 1;
+  const ParallelTextWriter::RowFormatter* m_Formatter = nullptr;
+};
+
+/**
+ * @brief Appends the QTextStream spelling of a non finite value. Returns false for finite values.
+ */
+bool appendNonFinite(std::string& buffer, double value)
+{
+  if(std::isnan(value))
+  {
+    buffer.append("nan");
+    return true;
+  }
+  if(std::isinf(value))
+  {
+    buffer.append(value < 0.0 ? "-inf" : "inf");
+    return true;
+  }
+  return false;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+ParallelTextWriter::ParallelTextWriter() = default;
+
+// -----------------------------------------------------------------------------
+ParallelTextWriter::~ParallelTextWriter() = default;
+
+// -----------------------------------------------------------------------------
+void ParallelTextWriter::setRowsPerBlock(size_t rows)
+{
+  m_RowsPerBlock = std::max<size_t>(rows, 1);
+}
+
+// -----------------------------------------------------------------------------
+size_t ParallelTextWriter::getRowsPerBlock() const
+{
+  return m_RowsPerBlock;
+}
+
+// -----------------------------------------------------------------------------
+void ParallelTextWriter::setParallelizationEnabled(bool doParallel)
+{
+  m_ParallelizationEnabled = doParallel;
+}
+
+// -----------------------------------------------------------------------------
+bool ParallelTextWriter::getParallelizationEnabled() const
+{
+  return m_ParallelizationEnabled;
+}
+
+// -----------------------------------------------------------------------------
+bool ParallelTextWriter::writeRows(QIODevice& device, size_t startRow, size_t endRow, const RowFormatter& formatter, const ProgressCallback& progress) const
+{
+  if(endRow <= startRow)
+  {
+    return true;
+  }
+
+  const size_t numBlocks = (endRow - startRow + m_RowsPerBlock - 1) / m_RowsPerBlock;
+  // Enough blocks to keep every thread busy while the previous group is written out
+  const size_t blocksPerGroup = static_cast<size_t>(std::max(QThread::idealThreadCount(), 1)) * 4;
+  std::vector<std::string> buffers(std::min(numBlocks, blocksPerGroup));
+
+  for(size_t firstBlock = 0; firstBlock < numBlocks; firstBlock += buffers.size())
+  {
+    const size_t groupBlocks = std::min(buffers.size(), numBlocks - firstBlock);
+    const size_t groupFirstRow = startRow + firstBlock * m_RowsPerBlock;
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setParallelizationEnabled(dataAlg.getParallelizationEnabled() && m_ParallelizationEnabled);
+    dataAlg.setRange(0, groupBlocks);
+    dataAlg.execute(FormatBlocksImpl(&buffers, groupFirstRow, endRow, m_RowsPerBlock, &formatter));
+
+    for(size_t block = 0; block < groupBlocks; block++)
+    {
+      const std::string& buffer = buffers[block];
+      if(!buffer.empty() && device.write(buffer.data(), static_cast<qint64>(buffer.size())) != static_cast<qint64>(buffer.size()))
+      {
+        return false;
+      }
+    }
+
+    if(progress)
+    {
+      progress(std::min(groupFirstRow + groupBlocks * m_RowsPerBlock, endRow) - startRow);
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+void ParallelTextWriter::AppendGeneral(std::string& buffer, double value, int32_t precision)
+{
+  if(appendNonFinite(buffer, value))
+  {
+    return;
+  }
+  char chars[64];
+#if defined(__cpp_lib_to_chars)
+  std::to_chars_result result = std::to_chars(chars, chars + sizeof(chars), value, std::chars_format::general, precision);
+  buffer.append(chars, result.ptr);
+#else
+  // Standard libraries without floating point to_chars fall back to the equivalent printf format
+  int count = std::snprintf(chars, sizeof(chars), "%.*g", precision, value);
+  buffer.append(chars, static_cast<size_t>(std::max(count, 0)));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+void ParallelTextWriter::AppendFixed(std::string& buffer, double value, int32_t precision, int32_t fieldWidth)
+{
+  std::string text;
+  if(!appendNonFinite(text, value))
+  {
+    // Fixed notation of very large values needs up to 309 integer digits
+    char chars[400];
+#if defined(__cpp_lib_to_chars)
+    std::to_chars_result result = std::to_chars(chars, chars + sizeof(chars), value, std::chars_format::fixed, precision);
+    text.assign(chars, result.ptr);
+#else
+    int count = std::snprintf(chars, sizeof(chars), "%.*f", precision, value);
+    text.assign(chars, static_cast<size_t>(std::max(count, 0)));
+#endif
+  }
+  if(static_cast<int32_t>(text.size()) < fieldWidth)
+  {
+    buffer.append(static_cast<size_t>(fieldWidth) - text.size(), ' ');
+  }
+  buffer.append(text);
+}
@@ -0,0 +1,162 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <charconv>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include <QtCore/QIODevice>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ParallelTextWriter class writes text files whose rows can be formatted independently of each
+ * other. Blocks of rows are formatted into memory buffers on worker threads and then written to the device
+ * in order, so the file is identical to one written row by row. The Append helpers format numbers without
+ * going through QTextStream and produce the same text QTextStream does for SmartNotation and FixedNotation.
+ */
+class SIMPLib_EXPORT ParallelTextWriter
+{
+public:
+  /**
+   * @brief Appends the text of one row, including its line ending, to the buffer. It is called from
+   * several threads at once so it must only read shared data.
+   */
+  using RowFormatter = std::function<void(size_t row, std::string& buffer)>;
+
+  /**
+   * @brief Called on the calling thread with the number of rows written so far
+   */
+  using ProgressCallback = std::function<void(size_t rowsWritten)>;
+
+  ParallelTextWriter();
+  ~ParallelTextWriter();
+
+  /**
+   * @brief Sets how many rows each worker formats into one buffer
+   * @param rows
+   */
+  void setRowsPerBlock(size_t rows);
+
+  /**
+   * @brief Returns how many rows each worker formats into one buffer
+   * @return
+   */
+  size_t getRowsPerBlock() const;
+
+  /**
+   * @brief Sets whether blocks are formatted on multiple threads
+   * @param doParallel
+   */
+  void setParallelizationEnabled(bool doParallel);
+
+  /**
+   * @brief Returns whether blocks are formatted on multiple threads
+   * @return
+   */
+  bool getParallelizationEnabled() const;
+
+  /**
+   * @brief Formats the rows [startRow, endRow) and writes them to the device in order. Only a bounded
+   * number of formatted blocks is held in memory at any time.
+   * @param device An open device. Anything buffered in a QTextStream on the same device must be flushed first.
+   * @param startRow
+   * @param endRow
+   * @param formatter
+   * @param progress
+   * @return false if the device reported a write error
+   */
+  bool writeRows(QIODevice& device, size_t startRow, size_t endRow, const RowFormatter& formatter, const ProgressCallback& progress = ProgressCallback()) const;
+
+  /**
+   * @brief Appends a value the way QTextStream::operator<<() writes it with the given real number precision.
+   * Booleans are written as 0 or 1, char as a character and floating point values in SmartNotation.
+   * @param buffer
+   * @param value
+   * @param precision Number of significant digits for floating point values
+   */
+  template <typename T>
+  static void AppendValue(std::string& buffer, T value, int32_t precision = 6)
+  {
+    if constexpr(std::is_same_v<T, bool>)
+    {
+      buffer.push_back(value ? '1' : '0');
+    }
+    else if constexpr(std::is_same_v<T, char>)
+    {
+      buffer.push_back(value);
+    }
+    else if constexpr(std::is_floating_point_v<T>)
+    {
+      AppendGeneral(buffer, static_cast<double>(value), precision);
+    }
+    else
+    {
+      char chars[24];
+      std::to_chars_result result = std::to_chars(chars, chars + sizeof(chars), value);
+      buffer.append(chars, result.ptr);
+    }
+  }
+
+  /**
+   * @brief Appends a floating point value with the given significant digits like printf's %g
+   * @param buffer
+   * @param value
+   * @param precision
+   */
+  static void AppendGeneral(std::string& buffer, double value, int32_t precision);
+
+  /**
+   * @brief Appends a floating point value with a fixed number of decimals, right aligned in a field of
+   * at least fieldWidth characters, like printf's %*.*f
+   * @param buffer
+   * @param value
+   * @param precision
+   * @param fieldWidth
+   */
+  static void AppendFixed(std::string& buffer, double value, int32_t precision, int32_t fieldWidth = 0);
+
+private:
+  size_t m_RowsPerBlock = 4096;
+  bool m_ParallelizationEnabled = true;
+
+public:
+  ParallelTextWriter(const ParallelTextWriter&) = delete;            // Copy Constructor Not Implemented
+  ParallelTextWriter(ParallelTextWriter&&) = delete;                 // Move Constructor Not Implemented
+  ParallelTextWriter& operator=(const ParallelTextWriter&) = delete; // Copy Assignment Not Implemented
+  ParallelTextWriter& operator=(ParallelTextWriter&&) = delete;      // Move Assignment Not Implemented
+};
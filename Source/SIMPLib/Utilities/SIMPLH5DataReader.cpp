@@ -76,12 +76,14 @@ bool SIMPLH5DataReader::openFile(const QString& filePath)
     return false;
   }
 
+  m_H5Lock = SIMPLH5Mutex::Lock();
   m_FileId = QH5Utilities::openFile(filePath, true); // Open the file Read Only
   if(m_FileId < 0)
   {
     QString ss = QObject::tr("Error opening input file '%1'.").arg(filePath);
     Q_EMIT errorGenerated(Title, ss, -149);
     m_FileId = -1;
+    m_H5Lock.unlock();
     return false;
   }
 
@@ -104,6 +106,10 @@ bool SIMPLH5DataReader::closeFile()
 
   m_CurrentFilePath.clear();
   m_FileId = -1;
+  if(m_H5Lock.owns_lock())
+  {
+    m_H5Lock.unlock();
+  }
   return true;
 }
 
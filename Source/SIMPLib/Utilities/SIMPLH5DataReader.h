@@ -37,6 +37,7 @@
 
 #include "SIMPLib/Common/Observable.h"
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/Utilities/SIMPLH5Mutex.h"
 
 class IObserver;
 class DataContainerArrayProxy;
@@ -75,7 +76,8 @@ public:
   ~SIMPLH5DataReader() override;
 
   /**
-   * @brief openFile
+   * @brief Opens the file read only. The reader holds SIMPLH5Mutex from here until closeFile() so that no other
+   * thread uses HDF5 while the file is open. The file must be closed on the thread that opened it.
    * @param filePath
    * @return
    */
@@ -122,6 +124,7 @@ Q_SIGNALS:
 private:
   QString m_CurrentFilePath = "";
   hid_t m_FileId = -1;
+  SIMPLH5Mutex::LockType m_H5Lock;
 
   /**
    * @brief readDataContainerBundles
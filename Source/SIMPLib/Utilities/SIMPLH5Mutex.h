@@ -0,0 +1,72 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <mutex>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The SIMPLH5Mutex class provides the process wide lock that serializes access to the HDF5
+ * library. HDF5 is not built thread safe, so any code that may touch HDF5 while another thread could
+ * do the same (pipeline worker threads, preflights running in the background, GUI widgets reading file
+ * structures, lazily loaded montage tiles) must hold this lock for the whole time a file is open. The
+ * mutex is recursive so that a filter holding the lock can call helpers that take it again.
+ */
+class SIMPLib_EXPORT SIMPLH5Mutex
+{
+public:
+  using MutexType = std::recursive_mutex;
+  using LockType = std::unique_lock<MutexType>;
+
+  /**
+   * @brief Returns the mutex shared by every HDF5 user in the process
+   * @return
+   */
+  static MutexType& Instance();
+
+  /**
+   * @brief Locks the shared mutex until the returned lock goes out of scope
+   * @return
+   */
+  static LockType Lock();
+
+public:
+  SIMPLH5Mutex() = delete;                               // Not Implemented
+  SIMPLH5Mutex(const SIMPLH5Mutex&) = delete;            // Copy Constructor Not Implemented
+  SIMPLH5Mutex(SIMPLH5Mutex&&) = delete;                 // Move Constructor Not Implemented
+  SIMPLH5Mutex& operator=(const SIMPLH5Mutex&) = delete; // Copy Assignment Not Implemented
+  SIMPLH5Mutex& operator=(SIMPLH5Mutex&&) = delete;      // Move Assignment Not Implemented
+};
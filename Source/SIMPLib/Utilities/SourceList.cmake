@@ -27,9 +27,11 @@ set(SIMPLib_Utilities_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelData2DAlgorithm.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelData3DAlgorithm.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelTaskAlgorithm.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelTextWriter.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PythonSupport.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLDataPathValidator.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLH5DataReaderRequirements.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLH5Mutex.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibEndian.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringOperations.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/TimeUtilities.h
@@ -51,10 +53,12 @@ set(SIMPLib_Utilities_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelData2DAlgorithm.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelData3DAlgorithm.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelTaskAlgorithm.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ParallelTextWriter.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PythonSupport.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLDataPathValidator.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLH5DataReader.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLH5DataReaderRequirements.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLH5Mutex.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringOperations.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/TestObserver.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ToolTipGenerator.cpp
@@ -0,0 +1,295 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
+
+/**
+ * @brief The ParallelTaskAlgorithmTest class
+ */
+class ParallelTaskAlgorithmTest
+{
+public:
+  using Clock = ParallelTaskAlgorithm::Clock;
+
+  ParallelTaskAlgorithmTest() = default;
+  virtual ~ParallelTaskAlgorithmTest() = default;
+
+  /**
+   * @brief The SleepTask class sleeps for a given number of milliseconds and counts its invocations.
+   */
+  class SleepTask
+  {
+  public:
+    SleepTask(std::atomic<int32_t>& counter, int32_t millis)
+    : m_Counter(counter)
+    , m_Millis(millis)
+    {
+    }
+
+    void operator()() const
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(m_Millis));
+      m_Counter++;
+    }
+
+  private:
+    std::atomic<int32_t>& m_Counter;
+    int32_t m_Millis = 0;
+  };
+
+  /**
+   * @brief The Gate class lets a test hold tasks until it opens the gate. Waiting times out
+   * so that a failing test cannot hang the test run.
+   */
+  class Gate
+  {
+  public:
+    void open()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Open = true;
+      }
+      m_Condition.notify_all();
+    }
+
+    bool waitForOpen(std::chrono::milliseconds timeout)
+    {
+      std::unique_lock<std::mutex> lock(m_Mutex);
+      return m_Condition.wait_for(lock, timeout, [this] { return m_Open; });
+    }
+
+  private:
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    bool m_Open = false;
+  };
+
+  const std::chrono::milliseconds k_GateTimeout = std::chrono::milliseconds(10000);
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool canTestConcurrency() const
+  {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // The tests below need two tasks running at the same time while the submitting thread is
+    // blocked, which takes two worker threads besides the submitting thread
+    return std::thread::hardware_concurrency() > 2 && tbb::this_task_arena::max_concurrency() > 2;
+#else
+    return false;
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RunUnevenTasks(ParallelTaskAlgorithm& taskAlg, std::atomic<int32_t>& counter, int32_t numTasks)
+  {
+    for(int32_t i = 0; i < numTasks; i++)
+    {
+      // Every fourth task is much slower than the rest
+      int32_t millis = (i % 4 == 0) ? 40 : 5;
+      taskAlg.execute(SleepTask(counter, millis));
+    }
+    taskAlg.wait();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAllTasksRun()
+  {
+    const int32_t numTasks = 32;
+    std::atomic<int32_t> counter(0);
+
+    ParallelTaskAlgorithm taskAlg;
+    RunUnevenTasks(taskAlg, counter, numTasks);
+
+    DREAM3D_REQUIRE_EQUAL(counter.load(), numTasks)
+    DREAM3D_REQUIRE_EQUAL(taskAlg.getTaskTimings().size(), numTasks)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSerialFallback()
+  {
+    const int32_t numTasks = 8;
+    std::atomic<int32_t> counter(0);
+
+    ParallelTaskAlgorithm taskAlg;
+    taskAlg.setParallelizationEnabled(false);
+    RunUnevenTasks(taskAlg, counter, numTasks);
+
+    DREAM3D_REQUIRE_EQUAL(counter.load(), numTasks)
+    DREAM3D_REQUIRE_EQUAL(taskAlg.getTaskTimings().size(), numTasks)
+
+    // A serial run only accounts for a single thread, so the idle time is exactly the time
+    // spent between tasks
+    ParallelTaskAlgorithm::Duration busy = ParallelTaskAlgorithm::Duration::zero();
+    for(const auto& timing : taskAlg.getTaskTimings())
+    {
+      busy += timing;
+    }
+    DREAM3D_REQUIRE(busy <= taskAlg.getElapsedTime())
+    DREAM3D_REQUIRE(taskAlg.getIdleTime() == taskAlg.getElapsedTime() - busy)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTimingReset()
+  {
+    std::atomic<int32_t> counter(0);
+
+    ParallelTaskAlgorithm taskAlg;
+    RunUnevenTasks(taskAlg, counter, 4);
+    DREAM3D_REQUIRE_EQUAL(taskAlg.getTaskTimings().size(), 4)
+    DREAM3D_REQUIRE(taskAlg.getElapsedTime() > ParallelTaskAlgorithm::Duration::zero())
+
+    taskAlg.resetTaskTimings();
+    DREAM3D_REQUIRE_EQUAL(taskAlg.getTaskTimings().size(), 0)
+    DREAM3D_REQUIRE(taskAlg.getElapsedTime() == ParallelTaskAlgorithm::Duration::zero())
+    DREAM3D_REQUIRE(taskAlg.getIdleTime() == ParallelTaskAlgorithm::Duration::zero())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNoBatchBarrier()
+  {
+    if(!canTestConcurrency())
+    {
+      return;
+    }
+
+    ParallelTaskAlgorithm taskAlg;
+    taskAlg.setMaxThreads(2);
+
+    Gate releaseSlowTask;
+    Gate thirdTaskStarted;
+    std::atomic<bool> slowTaskFinished(false);
+
+    // The slow task holds one slot until the third task has started. With a batch barrier the
+    // third task would wait for the whole first batch, including the slow task, and time out.
+    taskAlg.execute([&]() {
+      releaseSlowTask.waitForOpen(k_GateTimeout);
+      slowTaskFinished = true;
+    });
+    taskAlg.execute([]() {});
+    taskAlg.execute([&]() { thirdTaskStarted.open(); });
+
+    bool started = thirdTaskStarted.waitForOpen(k_GateTimeout);
+    bool slowTaskStillRunning = !slowTaskFinished.load();
+    releaseSlowTask.open();
+    taskAlg.wait();
+
+    DREAM3D_REQUIRE(started)
+    DREAM3D_REQUIRE(slowTaskStillRunning)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBackPressure()
+  {
+    if(!canTestConcurrency())
+    {
+      return;
+    }
+
+    ParallelTaskAlgorithm taskAlg;
+    taskAlg.setMaxThreads(2);
+
+    Gate releaseFirst;
+    Gate releaseSecond;
+    std::atomic<bool> secondReleased(false);
+
+    taskAlg.execute([&]() { releaseFirst.waitForOpen(k_GateTimeout); });
+    taskAlg.execute([&]() { releaseSecond.waitForOpen(k_GateTimeout); });
+
+    // Both slots are taken, so submitting a third task must block until the helper thread
+    // lets one of them finish
+    std::thread releaser([&]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(200));
+      secondReleased = true;
+      releaseSecond.open();
+    });
+
+    taskAlg.execute([]() {});
+    bool blockedUntilRelease = secondReleased.load();
+
+    releaseFirst.open();
+    releaser.join();
+    taskAlg.wait();
+
+    DREAM3D_REQUIRE(blockedUntilRelease)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ParallelTaskAlgorithmTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestAllTasksRun());
+    DREAM3D_REGISTER_TEST(TestSerialFallback());
+    DREAM3D_REGISTER_TEST(TestTimingReset());
+    DREAM3D_REGISTER_TEST(TestNoBatchBarrier());
+    DREAM3D_REGISTER_TEST(TestBackPressure());
+  }
+
+public:
+  ParallelTaskAlgorithmTest(const ParallelTaskAlgorithmTest&) = delete;            // Copy Constructor Not Implemented
+  ParallelTaskAlgorithmTest(ParallelTaskAlgorithmTest&&) = delete;                 // Move Constructor Not Implemented
+  ParallelTaskAlgorithmTest& operator=(const ParallelTaskAlgorithmTest&) = delete; // Copy Assignment Not Implemented
+  ParallelTaskAlgorithmTest& operator=(ParallelTaskAlgorithmTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,188 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <QtCore/QBuffer>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ParallelTextWriter.h"
+
+/**
+ * @brief The ParallelTextWriterTest class
+ */
+class ParallelTextWriterTest
+{
+public:
+  ParallelTextWriterTest() = default;
+  virtual ~ParallelTextWriterTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void CompareWithTextStream(const std::vector<T>& values, int32_t precision)
+  {
+    for(const auto& value : values)
+    {
+      QString expected;
+      QTextStream out(&expected);
+      out.setRealNumberPrecision(precision);
+      out << value;
+      out.flush();
+
+      std::string buffer;
+      ParallelTextWriter::AppendValue(buffer, value, precision);
+      DREAM3D_REQUIRE_EQUAL(QString::fromStdString(buffer), expected)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAppendValue()
+  {
+    CompareWithTextStream<int32_t>({0, 1, -1, 42, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min()}, 6);
+    CompareWithTextStream<uint64_t>({0, 7, std::numeric_limits<uint64_t>::max()}, 6);
+    CompareWithTextStream<float>({0.0f, 1.0f, -2.5f, 0.1f, 3.14159265f, 1.0e-7f, 6.02e23f}, 8);
+    CompareWithTextStream<double>({0.0, -1.0, 0.1, 1.0 / 3.0, 123456789.123, 1.0e-300, 2.0e200}, 16);
+    CompareWithTextStream<double>({0.785398163, 1234567.0, 0.0001}, 6);
+
+    // int8_t is written as a number, not a character
+    std::string buffer;
+    ParallelTextWriter::AppendValue(buffer, static_cast<int8_t>(-5));
+    ParallelTextWriter::AppendValue(buffer, true);
+    DREAM3D_REQUIRE_EQUAL(buffer, std::string("-51"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAppendFixed()
+  {
+    std::vector<float> values = {0.0f, 0.5f, -12.25f, 1234.5f, 123456.789f};
+    for(const auto& value : values)
+    {
+      QString expected;
+      QTextStream out(&expected);
+      out.setRealNumberPrecision(5);
+      out.setRealNumberNotation(QTextStream::FixedNotation);
+      out << qSetFieldWidth(8) << value;
+      out.flush();
+
+      std::string buffer;
+      ParallelTextWriter::AppendFixed(buffer, value, 5, 8);
+      DREAM3D_REQUIRE_EQUAL(QString::fromStdString(buffer), expected)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteRows(ParallelTextWriter& textWriter, size_t numRows, QByteArray& contents)
+  {
+    QBuffer device(&contents);
+    device.open(QIODevice::WriteOnly);
+
+    size_t lastProgress = 0;
+    bool written = textWriter.writeRows(device, 0, numRows,
+                                        [](size_t row, std::string& buffer) {
+                                          ParallelTextWriter::AppendValue(buffer, row);
+                                          buffer.push_back(',');
+                                          ParallelTextWriter::AppendValue(buffer, static_cast<double>(row) / 7.0);
+                                          buffer.push_back('\n');
+                                        },
+                                        [&lastProgress](size_t rowsWritten) {
+                                          DREAM3D_REQUIRE(rowsWritten > lastProgress)
+                                          lastProgress = rowsWritten;
+                                        });
+    DREAM3D_REQUIRE(written)
+    DREAM3D_REQUIRE_EQUAL(lastProgress, numRows)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRowOrder()
+  {
+    const size_t numRows = 100003;
+
+    ParallelTextWriter parallelWriter;
+    parallelWriter.setRowsPerBlock(97);
+    QByteArray parallelContents;
+    WriteRows(parallelWriter, numRows, parallelContents);
+
+    ParallelTextWriter serialWriter;
+    serialWriter.setParallelizationEnabled(false);
+    QByteArray serialContents;
+    WriteRows(serialWriter, numRows, serialContents);
+
+    QByteArray expected;
+    QTextStream out(&expected);
+    for(size_t row = 0; row < numRows; row++)
+    {
+      out << row << "," << static_cast<double>(row) / 7.0 << "\n";
+    }
+    out.flush();
+
+    DREAM3D_REQUIRE(parallelContents == expected)
+    DREAM3D_REQUIRE(serialContents == expected)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ParallelTextWriterTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestAppendValue());
+    DREAM3D_REGISTER_TEST(TestAppendFixed());
+    DREAM3D_REGISTER_TEST(TestRowOrder());
+  }
+
+public:
+  ParallelTextWriterTest(const ParallelTextWriterTest&) = delete;            // Copy Constructor Not Implemented
+  ParallelTextWriterTest(ParallelTextWriterTest&&) = delete;                 // Move Constructor Not Implemented
+  ParallelTextWriterTest& operator=(const ParallelTextWriterTest&) = delete; // Copy Assignment Not Implemented
+  ParallelTextWriterTest& operator=(ParallelTextWriterTest&&) = delete;      // Move Assignment Not Implemented
+};
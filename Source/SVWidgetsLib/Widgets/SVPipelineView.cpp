@@ -43,7 +43,9 @@
 #include <QtCore/QJsonObject>
 #include <QtCore/QMimeData>
 #include <QtCore/QThread>
+#include <QtCore/QTimer>
 #include <QtCore/QUrl>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include <QtGui/QClipboard>
 #include <QtGui/QDrag>
@@ -113,6 +115,7 @@ SVPipelineView::SVPipelineView(QWidget* parent)
 // -----------------------------------------------------------------------------
 SVPipelineView::~SVPipelineView()
 {
+  stopPreflight();
   delete m_WorkerThread;
   delete m_ActionEnableFilter;
 }
@@ -152,6 +155,12 @@ void SVPipelineView::setupGui()
   setFocusPolicy(Qt::StrongFocus);
   setDropIndicatorShown(false);
 
+  // Requests that arrive before the timer fires are merged into a single preflight
+  m_PreflightTimer = new QTimer(this);
+  m_PreflightTimer->setSingleShot(true);
+  m_PreflightTimer->setInterval(50);
+  m_PreflightWatcher = new QFutureWatcher<int>(this);
+
   connectSignalsSlots();
 }
 
@@ -162,6 +171,9 @@ void SVPipelineView::connectSignalsSlots()
 {
   connect(this, SIGNAL(customContextMenuRequested(const QPoint&)), this, SLOT(requestContextMenu(const QPoint&)));
 
+  connect(m_PreflightTimer, &QTimer::timeout, this, &SVPipelineView::startPreflight);
+  connect(m_PreflightWatcher, &QFutureWatcher<int>::finished, this, &SVPipelineView::finishPreflight);
+
   connect(this, &SVPipelineView::deleteKeyPressed, this, &SVPipelineView::listenDeleteKeyTriggered);
 
   connect(m_ActionCut, &QAction::triggered, this, &SVPipelineView::listenCutTriggered);
@@ -321,7 +333,27 @@ void SVPipelineView::preflightPipeline()
   {
     return;
   }
-  Q_EMIT clearIssuesTriggered();
+
+  m_PreflightPending = true;
+  if(nullptr != m_PreflightInFlight)
+  {
+    // The running preflight is out of date. finishPreflight() starts the next one once it has stopped.
+    m_PreflightInFlight->cancelPreflight();
+    return;
+  }
+  m_PreflightTimer->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::startPreflight()
+{
+  if(nullptr != m_PreflightInFlight || !m_PreflightPending)
+  {
+    return;
+  }
+  m_PreflightPending = false;
 
   PipelineModel* model = getPipelineModel();
   if(nullptr == model)
@@ -331,59 +363,186 @@ void SVPipelineView::preflightPipeline()
 
   // Create a Pipeline Object and fill it with the filters from this View
   FilterPipeline::Pointer pipeline = getFilterPipeline();
+  m_PreflightSources = pipeline->getFilterContainer();
 
-  // qDebug() << "Prepping Filters for preflight... ";
+  // The worker preflights copies of the filters so that it never touches an object the GUI thread is using.
+  // The filter input widgets write their latest values into the filters before the copies are updated.
+  FilterPipeline::Pointer workerPipeline = FilterPipeline::New();
+  workerPipeline->setName(pipeline->getName());
+  workerPipeline->setPreflightCache(m_PreflightCache);
+  std::map<AbstractFilter*, PreflightCopy> copies;
+  for(const auto& filter : m_PreflightSources)
+  {
+    Q_EMIT filter->updateFilterParameters(filter.get());
+    AbstractFilter::Pointer copy = getPreflightCopy(filter, m_PreflightCopies);
+    copies[filter.get()] = {filter, copy};
+    workerPipeline->pushBack(copy);
+  }
+  m_PreflightCopies = copies;
 
-  FilterPipeline::FilterContainerType filters = pipeline->getFilterContainer();
-  for(int i = 0; i < filters.size(); i++)
+  // HDF5 is not thread safe. Filters that access files hold SIMPLH5Mutex while they preflight, and parameter
+  // widgets reading file structures on this thread take the same lock through SIMPLH5DataReader.
+  m_PreflightInFlight = workerPipeline;
+  m_PreflightWatcher->setFuture(QtConcurrent::run([workerPipeline]() { return workerPipeline->preflightPipeline(); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer SVPipelineView::getPreflightCopy(const AbstractFilter::Pointer& filter, const std::map<AbstractFilter*, PreflightCopy>& copies)
+{
+  AbstractFilter::Pointer copy;
+  auto iter = copies.find(filter.get());
+  if(iter != copies.end() && iter->second.source.lock() == filter)
+  {
+    copy = iter->second.copy;
+    if(copy->getEnabled() == filter->getEnabled() && PipelinePreflightCache::Fingerprint(copy.get()) == PipelinePreflightCache::Fingerprint(filter.get()))
+    {
+      return copy;
+    }
+  }
+  else
   {
-    filters.at(i)->clearErrorCode();
-    filters.at(i)->setCancel(false);
+    copy = filter->newFilterInstance(false);
+  }
 
-    QModelIndex childIndex = model->index(i, PipelineItem::Contents);
-    if(childIndex.isValid())
+  QJsonObject json = filter->toJson();
+  copy->setEnabled(filter->getEnabled());
+  copy->readFilterParameters(json);
+  return copy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::finishPreflight()
+{
+  FilterPipeline::Pointer workerPipeline = m_PreflightInFlight;
+  m_PreflightInFlight = FilterPipeline::NullPointer();
+  if(nullptr == workerPipeline)
+  {
+    return;
+  }
+
+  PipelineModel* model = getPipelineModel();
+  int count = m_PreflightSources.size();
+  bool superseded = m_PreflightPending || nullptr == model || m_PreflightCache->size() != static_cast<size_t>(count);
+  if(superseded || m_BlockPreflight)
+  {
+    // The pipeline was edited while the preflight was running. The results are dropped and, unless preflights
+    // are blocked, a new preflight is started. Its unchanged leading filters come from the cache.
+    m_PreflightPending = true;
+    m_PreflightSources.clear();
+    if(!m_BlockPreflight)
     {
-      model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Ok), PipelineModel::ErrorStateRole);
-      AbstractFilter::Pointer filter = model->filter(childIndex);
-      if(filter && filter->getEnabled())
-      {
-        model->setData(childIndex, static_cast<int>(PipelineItem::WidgetState::Ready), PipelineModel::WidgetStateRole);
-      }
+      m_PreflightTimer->start();
     }
+    return;
   }
 
-  int err = pipeline->preflightPipeline();
-  if(err < 0)
+  int err = m_PreflightWatcher->result();
+  Q_EMIT clearIssuesTriggered();
+
+  std::map<AbstractFilter*, QModelIndex> modelIndices;
+  for(int row = 0; row < model->rowCount(); row++)
   {
-    // FIXME: Implement error handling.
+    QModelIndex childIndex = model->index(row, PipelineItem::Contents);
+    modelIndices[model->filter(childIndex).get()] = childIndex;
   }
-  int count = pipeline->getFilterContainer().size();
-  // Now that the preflight has been executed loop through the filters and check their error condition and set the
-  // outline on the filter widget if there were errors or warnings
-  for(qint32 i = 0; i < count; ++i)
+
+  // Give every filter its preflight results as if it had been preflighted in place. The widgets are
+  // notified so they update from the structure before and after the filter.
+  DataContainerArray::Pointer previous = DataContainerArray::New();
+  for(int i = 0; i < count; i++)
   {
-    QModelIndex childIndex = model->index(i, PipelineItem::Contents);
+    const AbstractFilter::Pointer& filter = m_PreflightSources.at(i);
+    const AbstractFilter::Pointer& copy = workerPipeline->getFilterContainer().at(i);
+    const PipelinePreflightCache::Snapshot& snapshot = m_PreflightCache->at(static_cast<size_t>(i));
+
+    filter->clearErrorCode();
+    filter->clearWarningCode();
+    filter->setCancel(false);
+
+    QModelIndex childIndex = modelIndices[filter.get()];
     if(childIndex.isValid())
     {
-      AbstractFilter::Pointer filter = model->filter(childIndex);
-      if(filter.get() != nullptr)
+      model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Ok), PipelineModel::ErrorStateRole);
+    }
+    if(!filter->getEnabled())
+    {
+      filter->setDataContainerArray(snapshot.dataContainerArray);
+      continue;
+    }
+    if(childIndex.isValid())
+    {
+      model->setData(childIndex, static_cast<int>(PipelineItem::WidgetState::Ready), PipelineModel::WidgetStateRole);
+    }
+
+    filter->setDataContainerArray(previous);
+    Q_EMIT filter->preflightAboutToExecute();
+
+    // Renamed DataArrayPaths were applied to the copy during the preflight
+    if(PipelinePreflightCache::Fingerprint(copy.get()) != PipelinePreflightCache::Fingerprint(filter.get()))
+    {
+      QJsonObject json = copy->toJson();
+      filter->readFilterParameters(json);
+    }
+    filter->setDataContainerArray(snapshot.dataContainerArray);
+
+    FilterPipeline::Pointer reporter = FilterPipeline::New();
+    for(const auto& observer : m_PipelineMessageObservers)
+    {
+      reporter->addMessageReceiver(observer);
+    }
+    reporter->connectFilterNotifications(filter.get());
+    for(const PipelinePreflightCache::Issue& issue : snapshot.issues)
+    {
+      if(issue.isError)
+      {
+        filter->setErrorCondition(issue.code, issue.messageText);
+      }
+      else
       {
-        if(filter->getWarningCode() < 0)
-        {
-          model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Warning), PipelineModel::ErrorStateRole);
-        }
-        if(filter->getErrorCode() < 0)
-        {
-          model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Error), PipelineModel::ErrorStateRole);
-        }
+        filter->setWarningCondition(issue.code, issue.messageText);
       }
     }
+    reporter->disconnectFilterNotifications(filter.get());
+    Q_EMIT filter->preflightExecuted();
+
+    // Now that the preflight has been executed check the error condition and set the
+    // outline on the filter widget if there were errors or warnings
+    if(childIndex.isValid() && filter->getWarningCode() < 0)
+    {
+      model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Warning), PipelineModel::ErrorStateRole);
+    }
+    if(childIndex.isValid() && filter->getErrorCode() < 0)
+    {
+      model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Error), PipelineModel::ErrorStateRole);
+    }
+    previous = snapshot.dataContainerArray;
   }
+  m_PreflightSources.clear();
 
   Q_EMIT preflightFinished(count, err);
   updateFilterInputWidgetIndices();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::stopPreflight()
+{
+  m_PreflightTimer->stop();
+  m_PreflightPending = false;
+  if(nullptr != m_PreflightInFlight)
+  {
+    m_PreflightInFlight->cancelPreflight();
+    m_PreflightWatcher->waitForFinished();
+    m_PreflightInFlight = FilterPipeline::NullPointer();
+  }
+  m_PreflightSources.clear();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -409,7 +568,10 @@ void SVPipelineView::executePipeline()
 
   Q_EMIT stdOutMessage(SVStyle::Instance()->WrapTextWithHtmlStyle("Preflight Pipeline.....", true));
 
-  // Give the pipeline one last chance to preflight and get all the latest values from the GUI
+  // Give the pipeline one last chance to preflight and get all the latest values from the GUI. Input files
+  // may have changed on disk so the cached preflight snapshots are not trusted here.
+  stopPreflight();
+  m_PreflightCache->invalidate();
   int err = m_PipelineInFlight->preflightPipeline();
   if(err < 0)
   {
@@ -35,11 +35,13 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 
 #include <stack>
 #include <vector>
 
+#include <QtCore/QFutureWatcher>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QListView>
 
@@ -67,6 +69,7 @@ class PipelineFilterObject;
 class DataStructureWidget;
 class PipelineModel;
 class QSignalMapper;
+class QTimer;
 
 /*
  *
@@ -303,8 +306,10 @@ public Q_SLOTS:
   void pasteFilters(int insertIndex = -1, bool useAnimationOnFirstRun = true);
 
   /**
-   * @brief preflightPipeline
-   * @param pipelineIndex
+   * @brief Schedules a preflight of the pipeline. The preflight runs on a worker thread on copies of the filters.
+   * Calls that arrive in a burst are merged into one preflight, and a call that arrives while a preflight is
+   * running cancels it and starts a new one once it has stopped. HDF5 access by the worker and the GUI thread
+   * is serialized through SIMPLH5Mutex.
    */
   void preflightPipeline();
 
@@ -447,11 +452,50 @@ private Q_SLOTS:
    */
   void finishPipeline();
 
+  /**
+   * @brief Copies the filters and starts the preflight on a worker thread
+   */
+  void startPreflight();
+
+  /**
+   * @brief Applies the results of a finished preflight to the filters and the model, or starts another
+   * preflight if the pipeline was edited while it ran
+   */
+  void finishPreflight();
+
 private:
+  struct PreflightCopy
+  {
+    AbstractFilter::WeakPointer source;
+    AbstractFilter::Pointer copy;
+  };
+
+  /**
+   * @brief Cancels a running preflight, waits until it has stopped and drops its results
+   */
+  void stopPreflight();
+
+  /**
+   * @brief Returns the copy of the filter that the preflight worker uses. The copy is kept between preflights
+   * so the preflight cache can recognize it, and its parameters are updated from the filter when they differ.
+   * @param filter
+   * @param copies The copies of the last preflight
+   * @return
+   */
+  AbstractFilter::Pointer getPreflightCopy(const AbstractFilter::Pointer& filter, const std::map<AbstractFilter*, PreflightCopy>& copies);
+
   SVPipelineView::PipelineViewState m_PipelineState = {};
 
   QThread* m_WorkerThread = nullptr;
   FilterPipeline::Pointer m_PipelineInFlight;
+
+  QTimer* m_PreflightTimer = nullptr;
+  QFutureWatcher<int>* m_PreflightWatcher = nullptr;
+  FilterPipeline::Pointer m_PreflightInFlight;
+  FilterPipeline::FilterContainerType m_PreflightSources;
+  std::map<AbstractFilter*, PreflightCopy> m_PreflightCopies;
+  bool m_PreflightPending = false;
+  PipelinePreflightCache::Pointer m_PreflightCache = PipelinePreflightCache::New();
   QVector<DataContainerArrayShPtrType> m_PreflightDataContainerArrays;
   QList<QObject*> m_PipelineMessageObservers;
 
@@ -15,6 +15,21 @@ registerDataArray<double>(mod, "DoubleArray");
 
 registerDataArray<bool>(mod, "BoolArray");
 
+registerNeighborList<int8_t>(mod, "Int8NeighborList");
+registerNeighborList<uint8_t>(mod, "UInt8NeighborList");
+
+registerNeighborList<int16_t>(mod, "Int16NeighborList");
+registerNeighborList<uint16_t>(mod, "UInt16NeighborList");
+
+registerNeighborList<int32_t>(mod, "Int32NeighborList");
+registerNeighborList<uint32_t>(mod, "UInt32NeighborList");
+
+registerNeighborList<int64_t>(mod, "Int64NeighborList");
+registerNeighborList<uint64_t>(mod, "UInt64NeighborList");
+
+registerNeighborList<float>(mod, "FloatNeighborList");
+registerNeighborList<double>(mod, "DoubleNeighborList");
+
 registerSIMPLArray<float, 2>(mod, "FloatVec2");
 registerSIMPLArray<int32_t, 2>(mod, "IntVec2");
 registerSIMPLArray<size_t, 2>(mod, "SizeVec2");
@@ -227,6 +242,7 @@ py::class_<MultiDataContainerSelectionFilterParameter::RequirementType>(instance
 registerDataContainerArray(instanceDataContainerArray);
 registerDataContainer(instanceDataContainer);
 registerAttributeMatrix(instanceAttributeMatrix);
+registerStringDataArray(instanceStringDataArray);
 registerDataArrayPath(instanceDataArrayPath);
 
 #ifdef SIMPL_EMBED_PYTHON
@@ -9,6 +9,9 @@
 
 #include "SIMPLib/Common/SIMPLArray.hpp"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/FlatNeighborList.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -63,7 +66,21 @@ void registerDataArray(pybind11::module& mod, const char* name)
             cDims[e] = static_cast<size_t>(shape[e + 1]);
           }
         }
-        return DataArrayType::WrapPointer(reinterpret_cast<T*>(data.mutable_data(0)), numTuples, cDims, name, ownsData);
+        T* ptr = reinterpret_cast<T*>(data.mutable_data(0));
+        if(!ownsData)
+        {
+          // The caller keeps the NumPy array alive for as long as the DataArray is used
+          return DataArrayType::WrapPointer(ptr, numTuples, cDims, name, false);
+        }
+        // Share the NumPy memory instead of copying it. The DataArray holds a reference to the NumPy array
+        // and gives it back when the values are released, so the memory is never freed by the wrong owner.
+        py::handle owner = data;
+        owner.inc_ref();
+        std::shared_ptr<T> buffer(ptr, [owner](T*) {
+          py::gil_scoped_acquire gil;
+          owner.dec_ref();
+        });
+        return DataArrayType::WrapSharedBuffer(buffer, numTuples, cDims, name);
       }))
       .def_property("name", &DataArrayType::getName, &DataArrayType::setName)
       .def("__getitem__", [](const DataArrayType& dataArray, size_t i) { return dataArray.at(i); })
@@ -84,7 +101,8 @@ void registerDataArray(pybind11::module& mod, const char* name)
       .def_property_readonly_static("dtype", []([[maybe_unused]] py::object self) { return py::dtype::of<T>(); })
       .def(
           "__iter__", [](const DataArrayType& dataArray) { return py::make_iterator(dataArray.begin(), dataArray.end()); }, py::keep_alive<0, 1>())
-      .def_buffer([](const DataArrayType& dataArray) -> py::buffer_info {
+      // The buffer is writable so the values are never shared with deep copies while Python can reach them
+      .def_buffer([](DataArrayType& dataArray) -> py::buffer_info {
         int nComp = dataArray.getNumberOfComponents();
         size_t numTuples = dataArray.getNumberOfTuples();
         ssize_t ndim = 0;
@@ -118,10 +136,17 @@ void registerDataArray(pybind11::module& mod, const char* name)
           strides.insert(strides.begin(), sizeof(T));
           std::reverse(strides.begin(), strides.end());
         }
+        dataArray.exposeValues();
         return py::buffer_info(dataArray.getPointer(0), sizeof(T), py::format_descriptor<T>::format(), ndim, shape, strides);
       })
       .def(
-          "npview", [](DataArrayType& dataArray) { return py::array_t<T, py::array::c_style>(dataArray.size(), dataArray.data(), py::cast(dataArray)); }, py::return_value_policy::reference_internal)
+          "npview",
+          [](DataArrayType& dataArray) {
+            // The view outlives the current filter so the values must never be shared with deep copies
+            dataArray.exposeValues();
+            return py::array_t<T, py::array::c_style>(dataArray.size(), dataArray.data(), py::cast(dataArray));
+          },
+          py::return_value_policy::reference_internal)
       .def("__repr__", [](const DataArrayType& a) {
         std::stringstream ss;
         ss << "<'" << a.getFullNameOfClass().toStdString() << "  NAME=" << a.getName().toStdString() << ": TUPLES: " << a.getNumberOfTuples() << "  COMPONENTS: [";
@@ -141,6 +166,41 @@ void registerDataArray(pybind11::module& mod, const char* name)
       });
 }
 
+template <class T>
+void registerNeighborList(pybind11::module& mod, const char* name)
+{
+  namespace py = pybind11;
+  using namespace py::literals;
+  using NeighborListType = NeighborList<T>;
+  using FlatNeighborListType = FlatNeighborList<T>;
+  py::class_<NeighborListType, IDataArray, std::shared_ptr<NeighborListType>>(mod, name)
+      .def_property("name", &NeighborListType::getName, &NeighborListType::setName)
+      .def("__len__", &NeighborListType::getNumberOfLists)
+      .def("getListSize", &NeighborListType::getListSize, "index"_a)
+      .def(
+          "npcopy",
+          [](const NeighborListType& neighborList) {
+            // NeighborList keeps one vector per list so the lists are copied into flat offsets and values buffers
+            // that both NumPy arrays share. Writes would never reach the NeighborList so the arrays are read only.
+            auto flatList = new typename FlatNeighborListType::Pointer(FlatNeighborListType::FromNeighborList(neighborList));
+            py::capsule owner(flatList, [](void* ptr) { delete reinterpret_cast<typename FlatNeighborListType::Pointer*>(ptr); });
+            const std::vector<size_t>& offsets = (*flatList)->getOffsets();
+            const std::vector<T>& values = (*flatList)->getValues();
+            py::array_t<size_t> offsetsArray(offsets.size(), offsets.data(), owner);
+            py::array_t<T> valuesArray(values.size(), values.data(), owner);
+            offsetsArray.attr("setflags")("write"_a = false);
+            valuesArray.attr("setflags")("write"_a = false);
+            return py::make_tuple(offsetsArray, valuesArray);
+          },
+          "Returns a read only copy of the lists as an (offsets, values) pair of NumPy arrays. List i holds "
+          "values[offsets[i]:offsets[i + 1]]. Changes to the NeighborList after the call are not reflected.")
+      .def("__repr__", [](const NeighborListType& a) {
+        std::stringstream ss;
+        ss << "<'" << a.getFullNameOfClass().toStdString() << "  NAME=" << a.getName().toStdString() << ": LISTS: " << a.getNumberOfLists() << "'>";
+        return ss.str();
+      });
+}
+
 template <class T, unsigned int Dim_>
 struct IVecType
 {
@@ -337,6 +397,55 @@ void registerAttributeMatrix(pybind11::class_<AttributeMatrix, std::shared_ptr<A
     }
     return am.getAttributeArray(name);
   });
+
+  instance.def(
+      "arrays",
+      [](const AttributeMatrix& am) {
+        // Every array that exposes its values through the buffer protocol is handed out as a NumPy view of that buffer
+        py::dict views;
+        for(const auto& array : am)
+        {
+          py::object pyArray = py::cast(array);
+          if(PyObject_CheckBuffer(pyArray.ptr()) != 0)
+          {
+            views[py::cast(array->getName())] = py::array::ensure(pyArray);
+          }
+        }
+        return views;
+      },
+      "Returns a dict of NumPy views keyed by array name. Arrays without a buffer, such as strings and neighbor lists, are left out.");
+}
+
+void registerStringDataArray(pybind11::class_<StringDataArray, IDataArray, std::shared_ptr<StringDataArray>>& instance)
+{
+  namespace py = pybind11;
+  using namespace py::literals;
+
+  instance.def("__len__", &StringDataArray::getSize);
+
+  instance.def(
+      "arrow_buffers",
+      [](const StringDataArray& stringArray) {
+        size_t numValues = stringArray.getSize();
+        py::array_t<int64_t> offsets(static_cast<ssize_t>(numValues + 1));
+        int64_t* offsetsPtr = offsets.mutable_data();
+        auto bytes = new std::vector<uint8_t>();
+        py::capsule owner(bytes, [](void* ptr) { delete reinterpret_cast<std::vector<uint8_t>*>(ptr); });
+        offsetsPtr[0] = 0;
+        for(size_t i = 0; i < numValues; i++)
+        {
+          QByteArray utf8 = stringArray.getValue(i).toUtf8();
+          bytes->insert(bytes->end(), utf8.constBegin(), utf8.constEnd());
+          offsetsPtr[i + 1] = static_cast<int64_t>(bytes->size());
+        }
+        py::array_t<uint8_t> data(bytes->size(), bytes->data(), owner);
+        // Both arrays hold an encoded copy of the strings, so they are read only to make clear that writes are not kept
+        offsets.attr("setflags")("write"_a = false);
+        data.attr("setflags")("write"_a = false);
+        return py::make_tuple(offsets, data);
+      },
+      "Returns a read only copy of the strings in the Arrow large_string layout as an (offsets, data) pair of NumPy arrays. "
+      "String i is the UTF-8 encoded data[offsets[i]:offsets[i + 1]].");
 }
 
 void registerDataArrayPath(py::class_<DataArrayPath>& instance)
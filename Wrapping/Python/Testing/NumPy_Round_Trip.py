@@ -131,8 +131,47 @@ def Test3():
   err = sh.WriteDREAM3DFile(sd.GetBuildDirectory() + '/Data/Output/Python_RoundTrip/RoundTripTest.dream3d', dca)
   assert err == 0, f'WriteDREAM3DFile ErrorCondition: {err}'
 
+def Test4():
+  '''
+  This will test handing a numpy array over to a simpl.DataArray without copying it,
+  reading the AttributeMatrix back as a dict of numpy views and reading a
+  simpl.StringDataArray through its Arrow style buffers.
+  '''
+  print('===================== Test 4 =====================')
+  shape = simpl.VectorSizeT([4, 3, 2])
+  cellAm = sh.CreateAttributeMatrix(shape, 'CAM', simpl.AttributeMatrix.Type.Cell)
+
+  # The DataArray shares the numpy memory and keeps it alive after the numpy array goes out of scope
+  z = np.arange(24 * 3, dtype=np.float32).reshape(24, 3)
+  adopted = simpl.FloatArray(z, 'Adopted', True)
+  z[0, 0] = 42.0
+  assert np.asarray(adopted)[0, 0] == 42.0
+  del z
+  cellAm.addOrReplaceAttributeArray(adopted)
+  adopted = None
+
+  names = simpl.StringDataArray.CreateArray(3, 'Names', True)
+  names.setValue(0, 'a')
+  names.setValue(1, '')
+  names.setValue(2, 'grain')
+  cellAm.addOrReplaceAttributeArray(names)
+
+  views = cellAm.arrays()
+  assert list(views.keys()) == ['Adopted'], f'Unexpected views: {list(views.keys())}'
+  assert views['Adopted'].shape == (24, 3)
+  assert views['Adopted'][0, 0] == 42.0
+  assert views['Adopted'][23, 2] == 71.0
+
+  offsets, data = names.arrow_buffers()
+  assert offsets.tolist() == [0, 1, 1, 6]
+  assert data.tobytes() == b'agrain'
+  # The buffers are an encoded copy of the strings so writing to them is refused
+  assert not offsets.flags.writeable
+  assert not data.flags.writeable
+
 if __name__ == '__main__':
   Test1()
   Test2()
   Test3()
+  Test4()
   print('[NumPy_Round_Trip] Complete')